@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\ArrayView.h
+/// @brief Contains the declaration of the ArrayView class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_ARRAY_VIEW_HEADER
+#define NIK_ARRAY_VIEW_HEADER
+
+#include <Util/Span.h>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ArrayView ArrayView.h <Util/ArrayView.h>
+/// @brief N dimensional, strided view of elements owned by someone else
+/// @details A view is a pointer plus a size and a stride, in elements, for
+///     each dimension.  Element (i0, ..., iN-1) is at
+///     Data()[i0 * Stride(0) + ... + iN-1 * Stride(N-1)].  Sub-blocks,
+///     slices and transposes are views of the same elements; nothing is
+///     copied, so a view can be handed to another thread as long as the
+///     owner outlives it.
+/// @tparam TYPE The element type, const for a read only view
+/// @tparam N The number of dimensions
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE, size_t N>
+class ArrayView
+{
+public:
+
+    static_assert(N > 0, "A view needs at least one dimension");
+
+    static const size_t DIMENSIONS = N;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Creates an empty view.
+    ///////////////////////////////////////////////////////////////////////////
+    ArrayView()
+    :
+    m_Data(0)
+    {
+        std::fill(m_Size, m_Size + N, size_t(0));
+        std::fill(m_Stride, m_Stride + N, ptrdiff_t(0));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] data Element (0, ..., 0)
+    /// @param[in] sizes The size of each dimension
+    /// @param[in] strides The distance between consecutive elements of each
+    ///     dimension, in elements
+    ///////////////////////////////////////////////////////////////////////////
+    ArrayView(TYPE* data, const size_t (&sizes)[N], const ptrdiff_t (&strides)[N])
+    :
+    m_Data(data)
+    {
+        std::copy(sizes, sizes + N, m_Size);
+        std::copy(strides, strides + N, m_Stride);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Converts a view, e.g. to a read only view.
+    /// @param[in] other The view to refer to the elements of
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OTHER>
+    ArrayView(const ArrayView<OTHER, N>& other)
+    :
+    m_Data(other.Data())
+    {
+        for(size_t d = 0; d < N; ++d)
+        {
+            m_Size[d] = other.Size(d);
+            m_Stride[d] = other.Stride(d);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the element at the given index
+    /// @param[in] idx One index per dimension
+    /// @return Reference to the element
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    TYPE& operator()(ARGS... idx) const
+    {
+        static_assert(sizeof...(ARGS) == N, "One index per dimension");
+        const size_t index[N] = { size_t(idx)... };
+        ptrdiff_t offset = 0;
+        for(size_t d = 0; d < N; ++d)
+        {
+            assert(index[d] < m_Size[d]);
+            offset += ptrdiff_t(index[d]) * m_Stride[d];
+        }
+        return m_Data[offset];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a row of the view
+    /// @param[in] idx One index for each dimension but the last
+    /// @return The elements along the last dimension, which must be
+    ///     contiguous
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    Span<TYPE> Row(ARGS... idx) const
+    {
+        static_assert(sizeof...(ARGS) == N - 1, "One index per dimension but the last");
+        assert(m_Stride[N - 1] == 1 || m_Size[N - 1] <= 1);
+        const size_t index[N] = { size_t(idx)..., 0 };
+        ptrdiff_t offset = 0;
+        for(size_t d = 0; d + 1 < N; ++d)
+        {
+            assert(index[d] < m_Size[d]);
+            offset += ptrdiff_t(index[d]) * m_Stride[d];
+        }
+        return Span<TYPE>(m_Data + offset, m_Size[N - 1]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get part of one dimension
+    /// @param[in] dim The dimension
+    /// @param[in] first The first index kept
+    /// @param[in] count The number of indexes kept
+    /// @param[in] step Keep every step-th index
+    /// @return The view of indexes first, first + step, ... of dim
+    ///////////////////////////////////////////////////////////////////////////
+    ArrayView Slice(size_t dim, size_t first, size_t count, size_t step = 1) const
+    {
+        assert(dim < N && step > 0);
+        assert(count == 0 || first + (count - 1) * step < m_Size[dim]);
+        ArrayView view(*this);
+        view.m_Data += ptrdiff_t(first) * m_Stride[dim];
+        view.m_Size[dim] = count;
+        view.m_Stride[dim] *= ptrdiff_t(step);
+        return view;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a sub-block
+    /// @param[in] first The first index kept in each dimension
+    /// @param[in] count The number of indexes kept in each dimension
+    /// @return The view of the block
+    ///////////////////////////////////////////////////////////////////////////
+    ArrayView Block(const size_t (&first)[N], const size_t (&count)[N]) const
+    {
+        ArrayView view(*this);
+        for(size_t d = 0; d < N; ++d)
+        {
+            view = view.Slice(d, first[d], count[d]);
+        }
+        return view;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Swap two dimensions
+    /// @return The view with dimensions a and b swapped
+    ///////////////////////////////////////////////////////////////////////////
+    ArrayView Transpose(size_t a = 0, size_t b = 1) const
+    {
+        assert(a < N && b < N);
+        ArrayView view(*this);
+        std::swap(view.m_Size[a], view.m_Size[b]);
+        std::swap(view.m_Stride[a], view.m_Stride[b]);
+        return view;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Fix the index of one dimension
+    /// @param[in] dim The dimension removed
+    /// @param[in] index Its index
+    /// @return The view of the elements with that index, one dimension less
+    ///////////////////////////////////////////////////////////////////////////
+    ArrayView<TYPE, N - 1> Select(size_t dim, size_t index) const
+    {
+        static_assert(N > 1, "Cannot remove the only dimension");
+        assert(dim < N && index < m_Size[dim]);
+        size_t sizes[N - 1 > 0 ? N - 1 : 1];
+        ptrdiff_t strides[N - 1 > 0 ? N - 1 : 1];
+        for(size_t d = 0, o = 0; d < N; ++d)
+        {
+            if(d != dim)
+            {
+                sizes[o] = m_Size[d];
+                strides[o] = m_Stride[d];
+                ++o;
+            }
+        }
+        return ArrayView<TYPE, N - 1>(m_Data + ptrdiff_t(index) * m_Stride[dim],
+            sizes, strides);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Call func(element) for every element, last dimension innermost
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    void ForEach(FUNC func) const
+    {
+        if(Count() == 0)
+        {
+            return;
+        }
+        size_t index[N] = {};
+        TYPE* base = m_Data;
+        for(;;)
+        {
+            TYPE* p = base;
+            for(size_t i = 0; i < m_Size[N - 1]; ++i, p += m_Stride[N - 1])
+            {
+                func(*p);
+            }
+            // Step to the next row, carrying into the outer dimensions
+            size_t d = N - 1;
+            for(;;)
+            {
+                if(d == 0)
+                {
+                    return;
+                }
+                --d;
+                base += m_Stride[d];
+                if(++index[d] < m_Size[d])
+                {
+                    break;
+                }
+                base -= m_Stride[d] * ptrdiff_t(m_Size[d]);
+                index[d] = 0;
+            }
+        }
+    } // end ForEach
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Check if the elements are one block, last dimension innermost
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsContiguous() const
+    {
+        ptrdiff_t expected = 1;
+        for(size_t d = N; d > 0; --d)
+        {
+            if(m_Size[d - 1] > 1 && m_Stride[d - 1] != expected)
+            {
+                return false;
+            }
+            expected *= ptrdiff_t(m_Size[d - 1]);
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of elements in the view
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Count() const
+    {
+        size_t count = 1;
+        for(size_t d = 0; d < N; ++d)
+        {
+            count *= m_Size[d];
+        }
+        return count;
+    }
+
+    TYPE* Data() const { return m_Data; }
+    size_t Size(size_t dim) const { assert(dim < N); return m_Size[dim]; }
+    ptrdiff_t Stride(size_t dim) const { assert(dim < N); return m_Stride[dim]; }
+
+private:
+
+    TYPE* m_Data;               ///< Element (0, ..., 0)
+    size_t m_Size[N];           ///< Size of each dimension
+    ptrdiff_t m_Stride[N];      ///< Stride of each dimension, in elements
+
+}; // end class ArrayView
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
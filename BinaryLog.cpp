@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\BinaryLog.cpp
+/// @brief Implementation of deferred-format (binary) logging
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryLog.h"
+#include "ScopeLock.h"
+#include "Mutex.h"
+#include <vector>
+#include <cassert>
+
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Registered sites, indexed by ID
+///////////////////////////////////////////////////////////////////////////////
+class SiteRegistry
+{
+public:
+    SiteRegistry() : m_Lock(nik::Mutex::Create("logger.sites")) {}
+    ~SiteRegistry() { delete m_Lock; }
+    nik::Mutex* m_Lock;                         ///< Guards m_Sites
+    std::vector<const nik::LogSite*> m_Sites;   ///< Sites by ID
+};
+
+SiteRegistry& GetRegistry();
+bool FormatArg(const char*& data, const char* end, std::ostringstream& os);
+template <typename T> bool ReadValue(const char*& data, const char* end, T& val);
+template <typename T> bool FormatValue(const char*& data, const char* end, std::ostringstream& os);
+
+} // end namespace
+
+namespace nik {
+
+//----------------------LogSite-Implementation-------------------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LogSite::LogSite
+    (
+    int level,
+    const char* file,
+    int line,
+    const char* format
+    )
+:
+m_Level(level),
+m_File(file),
+m_Line(line),
+m_Format(format),
+m_ID(0)
+{
+    SiteRegistry& registry = GetRegistry();
+    ScopeLock al(registry.m_Lock);
+    m_ID = static_cast<uint32_t>(registry.m_Sites.size());
+    registry.m_Sites.push_back(this);
+} // end LogSite::LogSite
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+const LogSite* LogSite::Find
+    (
+    uint32_t id
+    )
+{
+    SiteRegistry& registry = GetRegistry();
+    ScopeLock al(registry.m_Lock);
+    return id < registry.m_Sites.size() ? registry.m_Sites[id] : 0;
+} // end LogSite::Find
+
+//----------------------BinaryLog-Implementation-----------------------------//
+namespace BinaryLog {
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Format
+    (
+    const char* format,
+    const char* args,
+    size_t len,
+    std::string& out
+    )
+{
+    const char* end = args + len;
+    std::ostringstream os;
+    bool valid = true;
+    for(const char* pos = format; *pos; ++pos)
+    {
+        if(pos[0] == '{' && pos[1] == '}')
+        {
+            if(args < end)
+            {
+                valid = FormatArg(args, end, os) && valid;
+            }
+            else
+            {
+                os << "{}"; // Missing argument
+            }
+            ++pos;
+        }
+        else
+        {
+            os << *pos;
+        }
+    }
+
+    // Append any arguments without a placeholder
+    while(args < end && valid)
+    {
+        os << ' ';
+        valid = FormatArg(args, end, os);
+    }
+
+    out += os.str();
+    return valid;
+} // end BinaryLog::Format
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void WriteSite
+    (
+    const LogSite& site,
+    std::string& out
+    )
+{
+    uint32_t fields[5];
+    fields[0] = site.m_ID;
+    fields[1] = static_cast<uint32_t>(site.m_Level);
+    fields[2] = static_cast<uint32_t>(site.m_Line);
+    fields[3] = static_cast<uint32_t>(strlen(site.m_File));
+    fields[4] = static_cast<uint32_t>(strlen(site.m_Format));
+
+    RecordHeader header;
+    header.m_Size = static_cast<uint32_t>(sizeof(fields) + fields[3] + fields[4]);
+    header.m_Kind = RECORD_SITE;
+
+    out.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.append(reinterpret_cast<const char*>(fields), sizeof(fields));
+    out.append(site.m_File, fields[3]);
+    out.append(site.m_Format, fields[4]);
+} // end BinaryLog::WriteSite
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool ReadSite
+    (
+    const char* data,
+    size_t len,
+    SiteInfo& site
+    )
+{
+    uint32_t fields[5];
+    if(len < sizeof(fields))
+    {
+        return false;
+    }
+    memcpy(fields, data, sizeof(fields));
+    if(len != sizeof(fields) + fields[3] + fields[4])
+    {
+        return false;
+    }
+    site.m_ID = fields[0];
+    site.m_Level = static_cast<int>(fields[1]);
+    site.m_Line = static_cast<int>(fields[2]);
+    site.m_File.assign(data + sizeof(fields), fields[3]);
+    site.m_Format.assign(data + sizeof(fields) + fields[3], fields[4]);
+    return true;
+} // end BinaryLog::ReadSite
+
+} // end namespace BinaryLog
+} // end namespace nik
+
+//----------------------Free-Function-Implementations------------------------//
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+SiteRegistry& GetRegistry()
+{
+    // Never destroyed; the logger thread may look up sites during static
+    // destruction
+    static SiteRegistry* registry = new SiteRegistry;
+    return *registry;
+} // end GetRegistry
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool ReadValue
+    (
+    const char*& data,
+    const char* end,
+    T& val
+    )
+{
+    if(static_cast<size_t>(end - data) < sizeof(T))
+    {
+        data = end;
+        return false;
+    }
+    memcpy(&val, data, sizeof(T));
+    data += sizeof(T);
+    return true;
+} // end ReadValue
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool FormatValue
+    (
+    const char*& data,
+    const char* end,
+    std::ostringstream& os
+    )
+{
+    T val;
+    if( !ReadValue(data, end, val))
+    {
+        return false;
+    }
+    os << val;
+    return true;
+} // end FormatValue
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool FormatArg
+    (
+    const char*& data,
+    const char* end,
+    std::ostringstream& os
+    )
+{
+    using namespace nik::BinaryLog;
+    char tag = *data++;
+    switch(tag)
+    {
+    case ARG_INT32:
+        return FormatValue<int32_t>(data, end, os);
+    case ARG_UINT32:
+        return FormatValue<uint32_t>(data, end, os);
+    case ARG_INT64:
+        return FormatValue<int64_t>(data, end, os);
+    case ARG_UINT64:
+        return FormatValue<uint64_t>(data, end, os);
+    case ARG_DOUBLE:
+        return FormatValue<double>(data, end, os);
+    case ARG_CHAR:
+        return FormatValue<char>(data, end, os);
+    case ARG_BOOL:
+        {
+            char val = 0;
+            bool valid = ReadValue(data, end, val);
+            os << (val ? "true" : "false");
+            return valid;
+        }
+    case ARG_STRING:
+        {
+            uint32_t len = 0;
+            if( !ReadValue(data, end, len) || 
+                static_cast<size_t>(end - data) < len)
+            {
+                data = end;
+                return false;
+            }
+            os.write(data, len);
+            data += len;
+            return true;
+        }
+    case ARG_POINTER:
+        {
+            uint64_t val = 0;
+            bool valid = ReadValue(data, end, val);
+            os << "0x" << std::hex << val << std::dec;
+            return valid;
+        }
+    case ARG_TRUNCATED:
+        os << "...";
+        data = end;
+        return true;
+    default:
+        data = end;
+        return false;
+    }
+} // end FormatArg
+
+} // end namespace
+
+////////////////////////End-of-File////////////////////////////////////////////
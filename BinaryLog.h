@@ -0,0 +1,430 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\BinaryLog.h
+/// @brief Declarations for deferred-format (binary) logging
+/// @details Contains the following:
+///     @li LogSite - A static log statement with its format string
+///     @li LogArgWriter - Encodes the raw argument bytes of a statement
+///     @li BinaryLog - Record layout and decoding shared by the logger
+///         thread and the offline decoder
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_BINARY_LOG_HEADER
+#define NIK_BINARY_LOG_HEADER
+
+#include <string>
+#include <sstream>
+#include <cstring>
+#include <type_traits>
+#include <stdint.h>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class LogSite BinaryLog.h <Util\BinaryLog.h>
+/// @brief A log statement location and its format string
+/// @details Each NIK_LOG_FMT statement owns one static LogSite.  The site is
+///     registered once, on first use, and given an ID.  Only the ID is
+///     written with each record; the format string is looked up when the
+///     record is formatted.
+///
+///     Format strings use {} as the placeholder for each argument, ex.
+///     "queue {} holds {} items".
+///////////////////////////////////////////////////////////////////////////////
+class LogSite
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Registers the site and assigns its ID.
+    /// @param[in] level The level of the statement, see LogLevel
+    /// @param[in] file The source file of the statement
+    /// @param[in] line The source line of the statement
+    /// @param[in] format The format string, must be a string literal
+    ///////////////////////////////////////////////////////////////////////////
+    LogSite(int level, const char* file, int line, const char* format);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Looks up a registered site by ID
+    /// @param[in] id The ID of the site
+    /// @return The site, or 0 if no site has the ID
+    ///////////////////////////////////////////////////////////////////////////
+    static const LogSite* Find(uint32_t id);
+
+    int m_Level;            ///< Level of the statement
+    const char* m_File;     ///< Source file
+    int m_Line;             ///< Source line
+    const char* m_Format;   ///< Format string
+    uint32_t m_ID;          ///< ID assigned on registration
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Prevent copy construction
+    ///////////////////////////////////////////////////////////////////////////
+    LogSite(const LogSite&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Prevent assignment
+    ///////////////////////////////////////////////////////////////////////////
+    LogSite& operator=(const LogSite&);
+
+}; // end class LogSite
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Record layout of binary logging
+/// @details Every record in a thread's ring buffer and in a binary log file
+///     starts with a RecordHeader.  Binary log files start with FileMagic.
+///
+///     @li RECORD_TEXT - The payload is formatted text
+///     @li RECORD_BINARY - The payload is the site ID followed by the
+///         encoded arguments
+///     @li RECORD_SITE - The payload describes a site, see WriteSite().  Only
+///         written to binary log files, before the first record of the site.
+///////////////////////////////////////////////////////////////////////////////
+namespace BinaryLog {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The first bytes of a binary log file
+///////////////////////////////////////////////////////////////////////////////
+const char FileMagic[] = "NIKBLOG1";
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Length of FileMagic without the terminator
+///////////////////////////////////////////////////////////////////////////////
+const size_t FileMagicSize = sizeof(FileMagic) - 1;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kinds of records
+///////////////////////////////////////////////////////////////////////////////
+enum RecordKind
+{
+    RECORD_TEXT = 1,
+    RECORD_BINARY = 2,
+    RECORD_SITE = 3
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Header in front of every record
+///////////////////////////////////////////////////////////////////////////////
+struct RecordHeader
+{
+    uint32_t m_Size; ///< Bytes in the payload, not including the header
+    uint32_t m_Kind; ///< See RecordKind
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Type tags that precede each encoded argument
+///////////////////////////////////////////////////////////////////////////////
+enum ArgTag
+{
+    ARG_INT32 = 1,
+    ARG_UINT32,
+    ARG_INT64,
+    ARG_UINT64,
+    ARG_DOUBLE,
+    ARG_CHAR,
+    ARG_BOOL,
+    ARG_STRING,     ///< uint32_t length followed by the bytes
+    ARG_POINTER,
+    ARG_TRUNCATED   ///< Remaining arguments did not fit
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Formats a record's arguments with the site's format string
+/// @details Each {} in the format is replaced with the next argument.
+///     Arguments without a placeholder are appended, separated by spaces.
+/// @param[in] format The format string of the site
+/// @param[in] args The encoded arguments
+/// @param[in] len The number of bytes of encoded arguments
+/// @param[out] out The string to append the formatted text to
+/// @return @arg true - Success
+///         @arg false - The arguments were malformed
+///////////////////////////////////////////////////////////////////////////////
+bool Format(const char* format, const char* args, size_t len, std::string& out);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Appends a RECORD_SITE record describing the site
+/// @param[in] site The site to describe
+/// @param[out] out The string to append the record to
+///////////////////////////////////////////////////////////////////////////////
+void WriteSite(const LogSite& site, std::string& out);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief A site read back from a RECORD_SITE record
+///////////////////////////////////////////////////////////////////////////////
+struct SiteInfo
+{
+    uint32_t m_ID;          ///< ID of the site
+    int m_Level;            ///< Level of the statement
+    int m_Line;             ///< Source line
+    std::string m_File;     ///< Source file
+    std::string m_Format;   ///< Format string
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reads a RECORD_SITE payload
+/// @param[in] data The payload
+/// @param[in] len The size of the payload
+/// @param[out] site The decoded site
+/// @return @arg true - Success
+///         @arg false - The payload was malformed
+///////////////////////////////////////////////////////////////////////////////
+bool ReadSite(const char* data, size_t len, SiteInfo& site);
+
+} // end namespace BinaryLog
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class LogArgWriter BinaryLog.h <Util\BinaryLog.h>
+/// @brief Encodes log arguments into a fixed size buffer
+/// @details Arguments are copied as tagged raw bytes, nothing is formatted.
+///     Strings are copied.  If the arguments do not fit in the buffer, the
+///     remaining arguments are dropped and a truncation tag is written.
+///     Types without a dedicated encoding are formatted into a string with
+///     operator<<, which is as slow as text logging.
+///////////////////////////////////////////////////////////////////////////////
+class LogArgWriter
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Maximum number of bytes of encoded arguments per record
+    ///////////////////////////////////////////////////////////////////////////
+    enum { MaxArgBytes = 512 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    ///////////////////////////////////////////////////////////////////////////
+    LogArgWriter()
+    :
+    m_Size(0),
+    m_Truncated(false)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes all of the arguments
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteAll()
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc WriteAll()
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename... REST>
+    void WriteAll(const T& val, const REST&... rest)
+    {
+        Write(val);
+        WriteAll(rest...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes an integer
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value>::type Write(T val)
+    {
+        if(std::is_signed<T>::value)
+        {
+            if(sizeof(T) <= 4)
+            {
+                Put(BinaryLog::ARG_INT32, static_cast<int32_t>(val));
+            }
+            else
+            {
+                Put(BinaryLog::ARG_INT64, static_cast<int64_t>(val));
+            }
+        }
+        else
+        {
+            if(sizeof(T) <= 4)
+            {
+                Put(BinaryLog::ARG_UINT32, static_cast<uint32_t>(val));
+            }
+            else
+            {
+                Put(BinaryLog::ARG_UINT64, static_cast<uint64_t>(val));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a floating point value
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type Write(T val)
+    {
+        Put(BinaryLog::ARG_DOUBLE, static_cast<double>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes an enum as its underlying integer
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename std::enable_if<std::is_enum<T>::value>::type Write(T val)
+    {
+        Write(static_cast<typename std::underlying_type<T>::type>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a single character
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(char val)
+    {
+        Put(BinaryLog::ARG_CHAR, val);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a boolean
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(bool val)
+    {
+        Put(BinaryLog::ARG_BOOL, static_cast<char>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a copy of a C string
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(const char* val)
+    {
+        WriteString(val ? val : "(null)", val ? strlen(val) : 6);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a copy of a C string
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(char* val)
+    {
+        Write(static_cast<const char*>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a string literal or character array
+    ///////////////////////////////////////////////////////////////////////////
+    template <size_t N>
+    void Write(const char (&val)[N])
+    {
+        Write(static_cast<const char*>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a copy of a string
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(const std::string& val)
+    {
+        WriteString(val.data(), val.size());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes a pointer value
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void Write(const T* val)
+    {
+        Put(BinaryLog::ARG_POINTER, reinterpret_cast<uint64_t>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Encodes any other type by formatting it to a string
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename std::enable_if<!std::is_arithmetic<T>::value &&
+                            !std::is_enum<T>::value>::type Write(const T& val)
+    {
+        std::ostringstream os;
+        os << val;
+        Write(os.str());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the encoded bytes
+    ///////////////////////////////////////////////////////////////////////////
+    const char* Data() const
+    {
+        return m_Buffer;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of encoded bytes
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Size() const
+    {
+        return m_Size;
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes a tag and a fixed size value
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void Put(BinaryLog::ArgTag tag, const T& val)
+    {
+        if( !Reserve(1 + sizeof(T)))
+        {
+            return;
+        }
+        m_Buffer[m_Size++] = static_cast<char>(tag);
+        memcpy(m_Buffer + m_Size, &val, sizeof(T));
+        m_Size += sizeof(T);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes a tag, the length and the bytes of a string
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteString(const char* data, size_t len)
+    {
+        uint32_t size = static_cast<uint32_t>(len);
+        if( !Reserve(1 + sizeof(size) + len))
+        {
+            return;
+        }
+        m_Buffer[m_Size++] = static_cast<char>(BinaryLog::ARG_STRING);
+        memcpy(m_Buffer + m_Size, &size, sizeof(size));
+        m_Size += sizeof(size);
+        memcpy(m_Buffer + m_Size, data, len);
+        m_Size += len;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks that the bytes fit, marking truncation if they do not
+    /// @details One byte is always kept free for the truncation tag.
+    ///////////////////////////////////////////////////////////////////////////
+    bool Reserve(size_t bytes)
+    {
+        if(m_Truncated)
+        {
+            return false;
+        }
+        if(m_Size + bytes + 1 > MaxArgBytes)
+        {
+            m_Buffer[m_Size++] = static_cast<char>(BinaryLog::ARG_TRUNCATED);
+            m_Truncated = true;
+            return false;
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The encoded bytes
+    ///////////////////////////////////////////////////////////////////////////
+    char m_Buffer[MaxArgBytes];
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The number of encoded bytes
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_Size;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set when an argument did not fit
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Truncated;
+
+}; // end class LogArgWriter
+
+} // end namespace nik
+
+#endif
+
+////////////////////////End-of-File////////////////////////////////////////////
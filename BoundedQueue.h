@@ -0,0 +1,569 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\BoundedQueue.h
+/// @brief Contains the declaration of the BoundedQueue class template
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_BOUNDED_QUEUE_HEADER
+#define NIK_BOUNDED_QUEUE_HEADER
+
+#include <Util/Mutex.h>
+#include <Util/Timer.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The threads allowed on each end of a BoundedQueue
+///////////////////////////////////////////////////////////////////////////////
+enum QueueMode_t
+{
+    QUEUE_MPMC, ///< Any number of producers and consumers
+    QUEUE_MPSC, ///< Any number of producers, one consumer
+    QUEUE_SPSC  ///< One producer, one consumer
+};
+
+namespace QueueDetail {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Size of a cache line, used to pad the positions
+///////////////////////////////////////////////////////////////////////////////
+enum { CacheLineSize = 64 };
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Round a capacity up to a power of two, at least 2
+///////////////////////////////////////////////////////////////////////////////
+inline size_t RoundCapacity(size_t capacity)
+{
+    size_t size = 2;
+    while(size < capacity)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Milliseconds left of a time out started at startNs
+///////////////////////////////////////////////////////////////////////////////
+inline size_t Remaining(size_t timeOut, uint64_t startNs)
+{
+    if(timeOut == WaitWord::FOREVER)
+    {
+        return timeOut;
+    }
+    uint64_t elapsed = (Timer::NowNs() - startNs) / 1000000;
+    return elapsed < timeOut ? static_cast<size_t>(timeOut - elapsed) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief A slot of the sequenced ring
+/// @details The sequence tells a producer at position pos that the slot is
+///     free when it equals pos, and a consumer that it holds the item of pos
+///     when it equals pos + 1.
+///////////////////////////////////////////////////////////////////////////////
+template<class TYPE>
+struct Cell
+{
+    std::atomic<size_t> m_Seq;
+    typename std::aligned_storage<sizeof(TYPE),
+        std::alignment_of<TYPE>::value>::type m_Storage;
+
+    TYPE* Item() { return reinterpret_cast<TYPE*>(&m_Storage); }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The lock-free ring behind a BoundedQueue
+/// @details The general version takes any number of producers and
+///     consumers.  Each side claims a position with a compare and swap of its
+///     counter, and the slot's sequence hands the slot from one side to the
+///     other, so a slow thread only holds up the slot it claimed.
+///////////////////////////////////////////////////////////////////////////////
+template<class TYPE, QueueMode_t MODE>
+class Ring
+{
+public:
+
+    explicit Ring(size_t capacity)
+    :
+    m_Cells(0),
+    m_Mask(RoundCapacity(capacity) - 1),
+    m_Tail(0),
+    m_Head(0)
+    {
+        m_Cells = new Cell<TYPE>[m_Mask + 1];
+        for(size_t i = 0; i <= m_Mask; ++i)
+        {
+            m_Cells[i].m_Seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~Ring()
+    {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        for(size_t pos = m_Head.load(std::memory_order_relaxed); pos != tail; ++pos)
+        {
+            m_Cells[pos & m_Mask].Item()->~TYPE();
+        }
+        delete [] m_Cells;
+    }
+
+    size_t Capacity() const { return m_Mask + 1; }
+
+    size_t SizeApprox() const
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        size_t size = tail - head;
+        // The loads are not taken together, so clamp what a race can show
+        return size > Capacity() ? (head > tail ? 0 : Capacity()) : size;
+    }
+
+    bool TryPush(TYPE&& item)
+    {
+        Cell<TYPE>* cell;
+        size_t pos = m_Tail.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            cell = &m_Cells[pos & m_Mask];
+            size_t seq = cell->m_Seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if(diff == 0)
+            {
+                if(m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(diff < 0)
+            {
+                // The slot still holds the item of the previous lap
+                return false;
+            }
+            else
+            {
+                pos = m_Tail.load(std::memory_order_relaxed);
+            }
+        }
+        new(cell->Item()) TYPE(std::move(item));
+        cell->m_Seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(TYPE& out)
+    {
+        Cell<TYPE>* cell;
+        size_t pos = m_Head.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            cell = &m_Cells[pos & m_Mask];
+            size_t seq = cell->m_Seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if(diff == 0)
+            {
+                if(MODE == QUEUE_MPSC)
+                {
+                    // The only consumer, nobody to race for the slot
+                    m_Head.store(pos + 1, std::memory_order_relaxed);
+                    break;
+                }
+                if(m_Head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if(diff < 0)
+            {
+                // Empty, or the producer of the slot has not finished
+                return false;
+            }
+            else
+            {
+                pos = m_Head.load(std::memory_order_relaxed);
+            }
+        }
+        TYPE* item = cell->Item();
+        out = std::move(*item);
+        item->~TYPE();
+        cell->m_Seq.store(pos + m_Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+
+    Ring(const Ring&);
+    Ring& operator=(const Ring&);
+
+    Cell<TYPE>* m_Cells;    ///< The slots, read only after construction
+    size_t m_Mask;          ///< Capacity minus one, used to wrap the positions
+    char m_Pad[CacheLineSize - sizeof(Cell<TYPE>*) - sizeof(size_t)];
+
+    std::atomic<size_t> m_Tail; ///< Next position to push
+    char m_TailPad[CacheLineSize - sizeof(std::atomic<size_t>)];
+
+    std::atomic<size_t> m_Head; ///< Next position to pop
+    char m_HeadPad[CacheLineSize - sizeof(std::atomic<size_t>)];
+
+}; // end class Ring
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The single producer, single consumer ring
+/// @details Each side owns its counter, so no slot sequence or compare and
+///     swap is needed.  Each side also keeps a copy of the other side's
+///     counter and only reads the shared one when the copy says the ring is
+///     full or empty.
+///////////////////////////////////////////////////////////////////////////////
+template<class TYPE>
+class Ring<TYPE, QUEUE_SPSC>
+{
+public:
+
+    explicit Ring(size_t capacity)
+    :
+    m_Slots(0),
+    m_Mask(RoundCapacity(capacity) - 1),
+    m_Tail(0),
+    m_HeadCache(0),
+    m_Head(0),
+    m_TailCache(0)
+    {
+        m_Slots = new Slot_t[m_Mask + 1];
+    }
+
+    ~Ring()
+    {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        for(size_t pos = m_Head.load(std::memory_order_relaxed); pos != tail; ++pos)
+        {
+            Item(pos)->~TYPE();
+        }
+        delete [] m_Slots;
+    }
+
+    size_t Capacity() const { return m_Mask + 1; }
+
+    size_t SizeApprox() const
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        size_t size = tail - head;
+        return size > Capacity() ? (head > tail ? 0 : Capacity()) : size;
+    }
+
+    bool TryPush(TYPE&& item)
+    {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if(tail - m_HeadCache > m_Mask)
+        {
+            m_HeadCache = m_Head.load(std::memory_order_acquire);
+            if(tail - m_HeadCache > m_Mask)
+            {
+                return false;
+            }
+        }
+        new(Item(tail)) TYPE(std::move(item));
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(TYPE& out)
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        if(head == m_TailCache)
+        {
+            m_TailCache = m_Tail.load(std::memory_order_acquire);
+            if(head == m_TailCache)
+            {
+                return false;
+            }
+        }
+        TYPE* item = Item(head);
+        out = std::move(*item);
+        item->~TYPE();
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+
+    typedef typename std::aligned_storage<sizeof(TYPE),
+        std::alignment_of<TYPE>::value>::type Slot_t;
+
+    Ring(const Ring&);
+    Ring& operator=(const Ring&);
+
+    TYPE* Item(size_t pos) { return reinterpret_cast<TYPE*>(&m_Slots[pos & m_Mask]); }
+
+    Slot_t* m_Slots;    ///< The slots, read only after construction
+    size_t m_Mask;      ///< Capacity minus one, used to wrap the positions
+    char m_Pad[CacheLineSize - sizeof(Slot_t*) - sizeof(size_t)];
+
+    std::atomic<size_t> m_Tail; ///< Next position to push, written by the producer
+    size_t m_HeadCache;         ///< The producer's copy of m_Head
+    char m_TailPad[CacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+    std::atomic<size_t> m_Head; ///< Next position to pop, written by the consumer
+    size_t m_TailCache;         ///< The consumer's copy of m_Tail
+    char m_HeadPad[CacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+}; // end class Ring
+
+} // end namespace QueueDetail
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class BoundedQueue BoundedQueue.h <Util\BoundedQueue.h>
+/// @brief Fixed capacity lock-free queue for handing items between threads
+/// @details The storage is allocated once on construction and never grows.
+///     The Try functions never block.  Push() and Pop() only block when the
+///     queue is full or empty, parking on a WaitWord that the other side
+///     notifies; while nobody is parked a notify costs a fence and a load.
+///
+///     The mode picks the ring: QUEUE_MPMC claims slots with a compare and
+///     swap on both ends, QUEUE_MPSC drops the one on the consumer end and
+///     QUEUE_SPSC is a plain ring with no compare and swap at all.  The
+///     positions are padded onto separate cache lines so that producers and
+///     consumers do not contend on the same line.
+/// @code
+///     BoundedQueue<std::string, QUEUE_MPSC> queue(1024);
+///     // Any producer
+///     queue.Push(std::move(text));
+///     // The one consumer
+///     std::string text;
+///     while(queue.Pop(text, 100))
+///     {
+///         Write(text);
+///     }
+/// @endcode
+/// @attention With QUEUE_MPSC only one thread may pop at any given time, and
+///     with QUEUE_SPSC also only one thread may push.
+/// @attention The move constructor and move assignment of TYPE must not
+///     throw; an item is moved after its slot is claimed.
+///////////////////////////////////////////////////////////////////////////////
+template<class TYPE, QueueMode_t MODE = QUEUE_MPMC>
+class BoundedQueue
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Allocates the storage for the queue.
+    /// @param[in] capacity The number of items the queue can hold.  The
+    ///     value is rounded up to the next power of two, at least 2.
+    ///////////////////////////////////////////////////////////////////////////
+    explicit BoundedQueue(size_t capacity)
+    :
+    m_Ring(capacity)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Destroys the items still in the queue
+    /// @attention No thread may be using or waiting on the queue
+    ///////////////////////////////////////////////////////////////////////////
+    ~BoundedQueue()
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of items the queue can hold
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Capacity() const
+    {
+        return m_Ring.Capacity();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of items in the queue
+    /// @note Only a hint while other threads use the queue
+    ///////////////////////////////////////////////////////////////////////////
+    size_t SizeApprox() const
+    {
+        return m_Ring.SizeApprox();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Check the queue is empty
+    /// @note Only a hint while other threads use the queue
+    ///////////////////////////////////////////////////////////////////////////
+    bool Empty() const
+    {
+        return SizeApprox() == 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Add an item if there is room
+    /// @param[in] item The item, only moved from if it was added
+    /// @return @arg true - The item was added
+    ///         @arg false - The queue was full
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryPush(TYPE&& item)
+    {
+        if( !m_Ring.TryPush(std::move(item)))
+        {
+            return false;
+        }
+        m_NotEmpty.NotifyOne();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Add a copy of an item if there is room
+    /// @see TryPush(TYPE&&)
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryPush(const TYPE& item)
+    {
+        TYPE copy(item);
+        return TryPush(std::move(copy));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Construct an item from the arguments and add it if there is room
+    /// @see TryPush(TYPE&&)
+    ///////////////////////////////////////////////////////////////////////////
+    template<class... ARGS>
+    bool TryEmplace(ARGS&&... args)
+    {
+        TYPE item(std::forward<ARGS>(args)...);
+        return TryPush(std::move(item));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Remove the oldest item if there is one
+    /// @param[out] out Assigned the item if one was removed
+    /// @return @arg true - An item was removed
+    ///         @arg false - The queue was empty
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryPop(TYPE& out)
+    {
+        if( !m_Ring.TryPop(out))
+        {
+            return false;
+        }
+        m_NotFull.NotifyOne();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Add an item, waiting for room if the queue is full
+    /// @param[in] item The item, only moved from if it was added
+    /// @param[in] timeOut The longest time to wait in ms, or FOREVER
+    /// @return @arg true - The item was added
+    ///         @arg false - Timed out, the item was not added
+    ///////////////////////////////////////////////////////////////////////////
+    bool Push(TYPE&& item, size_t timeOut = FOREVER);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Add a copy of an item, waiting for room if the queue is full
+    /// @see Push(TYPE&&, size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    bool Push(const TYPE& item, size_t timeOut = FOREVER)
+    {
+        TYPE copy(item);
+        return Push(std::move(copy), timeOut);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Remove the oldest item, waiting for one if the queue is empty
+    /// @param[out] out Assigned the item if one was removed
+    /// @param[in] timeOut The longest time to wait in ms, or FOREVER
+    /// @return @arg true - An item was removed
+    ///         @arg false - Timed out
+    ///////////////////////////////////////////////////////////////////////////
+    bool Pop(TYPE& out, size_t timeOut = FOREVER);
+
+    static const size_t FOREVER = static_cast<size_t>(-1); ///< Flags Push and Pop to wait forever
+
+private:
+
+    BoundedQueue(const BoundedQueue&);
+    BoundedQueue& operator=(const BoundedQueue&);
+
+    QueueDetail::Ring<TYPE, MODE> m_Ring;
+    WaitWord m_NotEmpty;    ///< Consumers park here while the queue is empty
+    WaitWord m_NotFull;     ///< Producers park here while the queue is full
+
+}; // end class BoundedQueue
+
+//----------------------Template-Implementation------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+template<class TYPE, QueueMode_t MODE>
+bool BoundedQueue<TYPE, MODE>::Push
+    (
+    TYPE&& item,
+    size_t timeOut
+    )
+{
+    uint64_t start = timeOut == FOREVER ? 0 : Timer::NowNs();
+    while( !TryPush(std::move(item)))
+    {
+        // Check again after announcing the wait, so a pop in between is
+        // never missed
+        unsigned int epoch = m_NotFull.PrepareWait();
+        if(TryPush(std::move(item)))
+        {
+            m_NotFull.CancelWait();
+            return true;
+        }
+        size_t remaining = QueueDetail::Remaining(
+            timeOut == FOREVER ? WaitWord::FOREVER : timeOut, start);
+        if(remaining == 0)
+        {
+            m_NotFull.CancelWait();
+            return false;
+        }
+        if( !m_NotFull.Wait(epoch, remaining))
+        {
+            return TryPush(std::move(item));
+        }
+    }
+    return true;
+} // end BoundedQueue::Push
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+template<class TYPE, QueueMode_t MODE>
+bool BoundedQueue<TYPE, MODE>::Pop
+    (
+    TYPE& out,
+    size_t timeOut
+    )
+{
+    uint64_t start = timeOut == FOREVER ? 0 : Timer::NowNs();
+    while( !TryPop(out))
+    {
+        unsigned int epoch = m_NotEmpty.PrepareWait();
+        if(TryPop(out))
+        {
+            m_NotEmpty.CancelWait();
+            return true;
+        }
+        size_t remaining = QueueDetail::Remaining(
+            timeOut == FOREVER ? WaitWord::FOREVER : timeOut, start);
+        if(remaining == 0)
+        {
+            m_NotEmpty.CancelWait();
+            return false;
+        }
+        if( !m_NotEmpty.Wait(epoch, remaining))
+        {
+            return TryPop(out);
+        }
+    }
+    return true;
+} // end BoundedQueue::Pop
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
@@ -4,11 +4,33 @@
 /// @internal
 ///
 /// 15June2010, nik: initial
+/// 14October2026, nik: Stored the callable in a Function, made CallBack
+///     move-only
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "CallBack.h"
 #include <cassert>
 
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Owns a GenericFunctor so it can be held in a Function
+///////////////////////////////////////////////////////////////////////////////
+class OwnedFunctor
+{
+public:
+    explicit OwnedFunctor(nik::GenericFunctor* func) : m_Func(func) {}
+    OwnedFunctor(OwnedFunctor&& orig) noexcept : m_Func(orig.m_Func) { orig.m_Func = 0; }
+    ~OwnedFunctor() { delete m_Func; }
+    void operator()() { m_Func->CallFunc(); }
+private:
+    OwnedFunctor(const OwnedFunctor&);
+    OwnedFunctor& operator=(const OwnedFunctor&);
+    nik::GenericFunctor* m_Func;    ///< The functor, created with new
+};
+
+} // end namespace
+
 namespace nik {
 
 //----------------------CallBack-Imlementation-------------------------------//
@@ -16,13 +38,14 @@ namespace nik {
 //----------------------Public-Implementation--------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 15June2010, nik: initial
+// 14October2026, nik: The functor is owned by m_Func
 ///////////////////////////////////////////////////////////////////////////////
 CallBack::CallBack
     (
     GenericFunctor* func
     )
 :
-m_Func(func)
+m_Func(OwnedFunctor(func))
 {
     assert(func);
 } // end CallBack::CallBack
@@ -33,33 +56,31 @@ m_Func(func)
 ///////////////////////////////////////////////////////////////////////////////   
 CallBack::~CallBack()
 {
-    delete m_Func;
 }
 
 
 ///////////////////////////////////////////////////////////////////////////////
-// 15June2010, nik: initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////   
 CallBack::CallBack
     (
-    const CallBack& orig
+    CallBack&& orig
     )
 :
-m_Func(orig.m_Func)
+m_Func(std::move(orig.m_Func))
 {
-}
+} // end CallBack::CallBack
 
 
 ///////////////////////////////////////////////////////////////////////////////
-// 15June2010, nik: initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////    
 CallBack& CallBack::operator=
     (
-    const CallBack& rhs
+    CallBack&& rhs
     )
 {
-    CallBack t(rhs);
-    Swap(t);
+    m_Func = std::move(rhs.m_Func);
     return *this;
 } // end CallBack::operator=
 
@@ -71,10 +92,7 @@ void CallBack::Swap
     CallBack& rhs
     )
 {
-    GenericFunctor* thisOldm_Func = m_Func;
-    m_Func = rhs.m_Func;
-    rhs.m_Func = thisOldm_Func;
-
+    m_Func.Swap(rhs.m_Func);
 } // end CallBack::Swap
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -82,7 +100,7 @@ void CallBack::Swap
 ///////////////////////////////////////////////////////////////////////////////
 void CallBack::Call()
 {
-    m_Func->CallFunc();
+    m_Func();
 } // end CallBack::Call
 
 } // end namespace nik
@@ -4,10 +4,15 @@
 /// @internal
 ///
 /// 15June2010, nik: initial
+/// 14October2026, nik: Stored the callable in a Function, made CallBack
+///     move-only
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_CALL_BACK_HEADER
 #define NIK_CALL_BACK_HEADER
 
+#include <Util/Function.h>
+#include <type_traits>
+
 namespace nik 
 {
 
@@ -18,6 +23,11 @@ class GenericFunctor;
 /// @class CallBack CallBack.h <Util/CallBack.h>
 /// @brief Generic callback class
 /// @details This class is used to generically call a function for callback.
+///     The callable is held in a Function, so a small functor or lambda is
+///     stored without allocating and called without a virtual call.
+///
+///     A CallBack owns its callable and can be moved but not copied.
+/// @see nik::Function
 ///////////////////////////////////////////////////////////////////////////////
 class CallBack
 {
@@ -25,27 +35,41 @@ public:
     
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Constructor
-    /// @param[in] func The functor to call on callback
+    /// @param[in] func The functor to call on callback, created with new.
+    ///     The CallBack deletes it.
     ///////////////////////////////////////////////////////////////////////////
     CallBack(GenericFunctor* func);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] func Callable taking no arguments, moved or copied into
+    ///     the CallBack
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC, typename = typename std::enable_if<
+        !std::is_convertible<FUNC, GenericFunctor*>::value &&
+        !std::is_same<typename std::decay<FUNC>::type, CallBack>::value>::type>
+    CallBack(FUNC&& func)
+    :
+    m_Func(std::forward<FUNC>(func))
+    {}
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Destructor
     ///////////////////////////////////////////////////////////////////////////
     ~CallBack();
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Copy Constructor
-    /// @param[in] orig The object to copy from
+    /// @brief Move Constructor
+    /// @param[in] orig The object to take the callable from
     ///////////////////////////////////////////////////////////////////////////
-    CallBack(const CallBack& orig);
+    CallBack(CallBack&& orig);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Assignment operator
-    /// @param[in] rhs The object to copy from
+    /// @brief Move assignment operator
+    /// @param[in] rhs The object to take the callable from
     /// @return A reference to this object
     ///////////////////////////////////////////////////////////////////////////
-    CallBack& operator=(const CallBack& rhs);
+    CallBack& operator=(CallBack&& rhs);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Swaps the contents of two objects
@@ -61,10 +85,20 @@ public:
 private:
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief The functor to call on callback
-    /// @note This object is created with new
+    /// @brief Copy construction has been disallowed.
+    /// @note Copies used to share the functor and delete it twice.
+    ///////////////////////////////////////////////////////////////////////////
+    CallBack(const CallBack& orig);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    CallBack& operator=(const CallBack& rhs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The callable to call on callback
     ///////////////////////////////////////////////////////////////////////////
-    GenericFunctor* m_Func;
+    Function<void()> m_Func;
 
 }; // end class CallBack
 
@@ -4,21 +4,32 @@
 /// @internal
 ///
 /// 26May2010, nik: initial
+/// 14October2026, nik: Added the POSIX implementation
+/// 14October2026, nik: Added named events with wait counters
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "Event.h"
+#include "SyncStats.h"
+#include "Timer.h"
 #include "Utility.h"
-#include <Windows.h>
 #include <cassert>
 
+#ifdef NIK_USE_WINDOWS
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+#endif
+
 
 namespace nik {
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Event::EventImpl Event.cpp <Util\Event.cpp>
 /// @brief The implementation of the Event class
-/// @details Defines the behavior of the Event class.
-/// @note Event currently only supports Windows
+/// @details Defines the behavior of the Event class.  The event is manual
+///     reset; it stays signaled until ClearEvent() is called.
 ///////////////////////////////////////////////////////////////////////////////
 class Event::EventImpl
 {
@@ -81,27 +92,64 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     EventImpl& operator=(const EventImpl&);
 
+#ifdef NIK_USE_WINDOWS
     ///////////////////////////////////////////////////////////////////////////
     /// @brief The event resource
-    /// @note Only works with windows now
     ///////////////////////////////////////////////////////////////////////////
     HANDLE m_Event;
+#else
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Indicates if m_Mutex and m_Cond have been initialized
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Initialized;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The event state, guarded by m_Mutex
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Signaled;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Guards m_Signaled
+    ///////////////////////////////////////////////////////////////////////////
+    pthread_mutex_t m_Mutex;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Signaled when m_Signaled is set, uses the monotonic clock
+    ///////////////////////////////////////////////////////////////////////////
+    pthread_cond_t m_Cond;
+#endif
     
 }; // end class Event::EventImpl
 
 //----------------------Event-Implementation---------------------------------//
 //----------------------Static-Members---------------------------------------//
+#ifdef NIK_USE_WINDOWS
 size_t Event::FOREVER = INFINITE; // Use windows definition for now...
 size_t Event::WAIT_SIGNALED = WAIT_OBJECT_0; // Windows definition
 size_t Event::WAIT_TIMEDOUT = WAIT_TIMEOUT; // Windows defintion
+#else
+size_t Event::FOREVER = static_cast<size_t>(-1);
+size_t Event::WAIT_SIGNALED = 0;
+size_t Event::WAIT_TIMEDOUT = 1;
+#endif
 //----------------------Public-Implementation--------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 26May2010: nik, initial
+// 14October2026, nik: Added the name
 ///////////////////////////////////////////////////////////////////////////////
-Event* Event::Create()
+Event* Event::Create(const char* name)
 {
     try{
-    return new Event;
+    Event* event = new Event;
+#if NIK_LOCK_STATS
+    if(name)
+    {
+        event->m_Stats = new SyncStats(name, SyncStats::KIND_EVENT);
+    }
+#else
+    (void)name;
+#endif
+    return event;
     }
     catch(nik::Error&)
     {
@@ -115,6 +163,7 @@ Event* Event::Create()
 ///////////////////////////////////////////////////////////////////////////////
 Event::~Event()
 {
+    delete m_Stats;
     delete m_Impl;
 } // end Event::~Event
 
@@ -139,6 +188,15 @@ bool Event::ClearEvent()
 ///////////////////////////////////////////////////////////////////////////////
 size_t Event::WaitForEvent(size_t waitTime)
 {
+#if NIK_LOCK_STATS
+    if(m_Stats)
+    {
+        uint64_t start = Timer::NowNs();
+        size_t result = m_Impl->WaitForEvent(waitTime);
+        m_Stats->RecordWait(result == WAIT_TIMEDOUT, Timer::NowNs() - start);
+        return result;
+    }
+#endif
     return m_Impl->WaitForEvent(waitTime);
 } // end Event::WaitForEvent
 
@@ -147,6 +205,8 @@ size_t Event::WaitForEvent(size_t waitTime)
 // 26May2010: nik, initial
 ///////////////////////////////////////////////////////////////////////////////
 Event::Event()
+:
+m_Stats(0)
 {
     m_Impl = new EventImpl;
     // Setup the resources
@@ -161,6 +221,7 @@ Event::Event()
 //----------------------Event::EventImpl-Implementation----------------------//
 //----------------------Static-Members---------------------------------------//
 //----------------------Public-Implementation--------------------------------//
+#ifdef NIK_USE_WINDOWS
 ///////////////////////////////////////////////////////////////////////////////
 // 26May2010: nik, initial
 ///////////////////////////////////////////////////////////////////////////////
@@ -220,6 +281,128 @@ size_t Event::EventImpl::WaitForEvent(size_t waitTime)
     return WaitForSingleObject(m_Event, waitTime);
 } // end EventImpl::SetEvent
 
+#else // POSIX
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Event::EventImpl::EventImpl()
+:
+m_Initialized(false),
+m_Signaled(false)
+{
+} // end EventImpl::EventImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Event::EventImpl::~EventImpl()
+{
+    if(m_Initialized)
+    {
+        pthread_cond_destroy(&m_Cond);
+        pthread_mutex_destroy(&m_Mutex);
+    }
+} // end EventImpl::~EventImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Event::EventImpl::Init()
+{
+    if(pthread_mutex_init(&m_Mutex, 0) != 0)
+    {
+        assert(false);
+        return false;
+    }
+
+    // Time outs are measured on the monotonic clock so they are not thrown
+    // off by changes to the wall clock
+    pthread_condattr_t attr;
+    bool success = pthread_condattr_init(&attr) == 0;
+    if(success)
+    {
+#ifndef __APPLE__
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+        success = pthread_cond_init(&m_Cond, &attr) == 0;
+        pthread_condattr_destroy(&attr);
+    }
+    if( !success)
+    {
+        assert(false);
+        pthread_mutex_destroy(&m_Mutex);
+        return false;
+    }
+    m_Initialized = true;
+    return true;
+} // end EventImpl::Init
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Event::EventImpl::SetEvent()
+{
+    // Broadcast under the lock; a waiter may delete the event as soon as it
+    // sees the signal
+    pthread_mutex_lock(&m_Mutex);
+    m_Signaled = true;
+    // Manual reset, so every waiter is released
+    bool success = pthread_cond_broadcast(&m_Cond) == 0;
+    pthread_mutex_unlock(&m_Mutex);
+    return success;
+} // end EventImpl::SetEvent
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Event::EventImpl::ClearEvent()
+{
+    pthread_mutex_lock(&m_Mutex);
+    m_Signaled = false;
+    pthread_mutex_unlock(&m_Mutex);
+    return true;
+} // end EventImpl::ClearEvent
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t Event::EventImpl::WaitForEvent(size_t waitTime)
+{
+    pthread_mutex_lock(&m_Mutex);
+    if(waitTime == Event::FOREVER)
+    {
+        while( !m_Signaled)
+        {
+            pthread_cond_wait(&m_Cond, &m_Mutex);
+        }
+    }
+    else if( !m_Signaled && waitTime > 0)
+    {
+        timespec deadline;
+#ifdef __APPLE__
+        clock_gettime(CLOCK_REALTIME, &deadline);
+#else
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+#endif
+        deadline.tv_sec += static_cast<time_t>(waitTime / 1000);
+        deadline.tv_nsec += static_cast<long>(waitTime % 1000) * 1000000;
+        if(deadline.tv_nsec >= 1000000000)
+        {
+            ++deadline.tv_sec;
+            deadline.tv_nsec -= 1000000000;
+        }
+        int result = 0;
+        while( !m_Signaled && result != ETIMEDOUT)
+        {
+            result = pthread_cond_timedwait(&m_Cond, &m_Mutex, &deadline);
+        }
+    }
+    bool signaled = m_Signaled;
+    pthread_mutex_unlock(&m_Mutex);
+    return signaled ? Event::WAIT_SIGNALED : Event::WAIT_TIMEDOUT;
+} // end EventImpl::WaitForEvent
+#endif
+
 } // end namespace nik
 
 ////////////////////////End-of-File////////////////////////////////////////////
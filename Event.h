@@ -4,20 +4,29 @@
 /// @internal
 ///
 /// 26May2010, nik: initial
+/// 14October2026, nik: Added named events with wait counters
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_EVENT_HEADER
 #define NIK_EVENT_HEADER
 
+#include <cstddef>
+
 
 namespace nik {
 
+class SyncStats;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Event Event.h <Util\Event.h>
 /// @brief Class for setting and checking events
 /// @details Event object with signal event and wait for event functionality.
 ///     The event object can only be created with the Create() function, which
 ///     returns an Event object created with new.
-/// @note Event currently only supports Windows
+///
+///     An event may be given a name.  In a NIK_LOCK_STATS build a named
+///     event counts its waits, time outs and wait times, see SyncStats.
+/// @note Uses a Win32 event when NIK_USE_WINDOWS is defined and pthreads
+///     otherwise
 ///////////////////////////////////////////////////////////////////////////////
 class Event
 {
@@ -30,10 +39,12 @@ public:
     ///     new.
     /// @attention Remember to call delete when finished with the object.
     /// @attention Returns 0 when the creation of the event fails
+    /// @param[in] name Name the counters are reported under, or 0 for an
+    ///     event that is not counted
     /// @return @arg 0 - Creating the event failed
     ///         @arg A pointer to the new event
     ///////////////////////////////////////////////////////////////////////////
-    static Event* Create();
+    static Event* Create(const char* name = 0);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Destructor
@@ -103,6 +114,11 @@ private:
     ///     behavior and functionality of Event.
     ///////////////////////////////////////////////////////////////////////////
     EventImpl* m_Impl;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Counters of a named event, 0 if the event is not counted
+    ///////////////////////////////////////////////////////////////////////////
+    SyncStats* m_Stats;
 }; // end class Event
 
 } // end namespace nik
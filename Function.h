@@ -0,0 +1,384 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\Function.h
+/// @brief Contains the declaration of the Function and FunctionRef classes
+/// @details Contains the following:
+///     @li Function - Owns any callable, small ones without allocating
+///     @li FunctionRef - Refers to a callable owned by someone else
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_FUNCTION_HEADER
+#define NIK_FUNCTION_HEADER
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace nik {
+
+template <typename SIGNATURE> class Function;
+template <typename SIGNATURE> class FunctionRef;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class Function Function.h <Util/Function.h>
+/// @brief Type erased, move-only callable
+/// @details Holds any callable that can be called as R(ARGS...): a free
+///     function, a functor or a lambda.  Callables that fit in INLINE_SIZE
+///     bytes and can be moved without throwing are stored in the object
+///     itself; larger ones are created with new.
+///
+///     A call is one indirect call through a function pointer held in the
+///     object, with no virtual dispatch and no allocation.
+///
+///     Function can be moved but not copied, so it can hold callables that
+///     own resources, ex. a lambda that captured a unique_ptr.
+/// @attention Calling an empty Function asserts.
+/// @see nik::FunctionRef
+///////////////////////////////////////////////////////////////////////////////
+template <typename R, typename... ARGS>
+class Function<R(ARGS...)>
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Bytes of inline storage, callables that fit are not allocated
+    ///////////////////////////////////////////////////////////////////////////
+    static const size_t INLINE_SIZE = 4 * sizeof(void*);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Creates an empty Function.
+    ///////////////////////////////////////////////////////////////////////////
+    Function()
+    :
+    m_Invoke(0),
+    m_Manage(0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] func The callable, moved or copied into this object.  A
+    ///     null function pointer creates an empty Function.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC, typename = typename std::enable_if<
+        !std::is_same<typename std::decay<FUNC>::type, Function>::value>::type>
+    Function(FUNC&& func)
+    :
+    m_Invoke(0),
+    m_Manage(0)
+    {
+        typedef typename std::decay<FUNC>::type Stored_t;
+        if(IsNull(func))
+        {
+            return;
+        }
+        Init<Stored_t>(std::forward<FUNC>(func), IsInline<Stored_t>());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Move Constructor
+    /// @param[in] orig The Function to take the callable from, left empty
+    ///////////////////////////////////////////////////////////////////////////
+    Function(Function&& orig)
+    :
+    m_Invoke(0),
+    m_Manage(0)
+    {
+        MoveFrom(orig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    ///////////////////////////////////////////////////////////////////////////
+    ~Function()
+    {
+        Clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Move assignment operator
+    /// @param[in] rhs The Function to take the callable from, left empty
+    /// @return A reference to this object
+    ///////////////////////////////////////////////////////////////////////////
+    Function& operator=(Function&& rhs)
+    {
+        if(this != &rhs)
+        {
+            Clear();
+            MoveFrom(rhs);
+        }
+        return *this;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Swaps the contents of two objects
+    /// @param[in] rhs The object to swap contents with
+    ///////////////////////////////////////////////////////////////////////////
+    void Swap(Function& rhs)
+    {
+        Function t(std::move(rhs));
+        rhs = std::move(*this);
+        *this = std::move(t);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destroys the callable, leaving the Function empty
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear()
+    {
+        if(m_Manage)
+        {
+            m_Manage(DESTROY, &m_Storage, 0);
+        }
+        m_Invoke = 0;
+        m_Manage = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if the Function holds a callable
+    ///////////////////////////////////////////////////////////////////////////
+    explicit operator bool() const
+    {
+        return m_Invoke != 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Calls the callable
+    /// @param[in] args The arguments to pass on
+    /// @return The value returned by the callable
+    ///////////////////////////////////////////////////////////////////////////
+    R operator()(ARGS... args) const
+    {
+        assert(m_Invoke);
+        return m_Invoke(&m_Storage, std::forward<ARGS>(args)...);
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy construction has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    Function(const Function&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    Function& operator=(const Function&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Operations of m_Manage
+    ///////////////////////////////////////////////////////////////////////////
+    enum ManageOp
+    {
+        MOVE,       ///< Move the callable from the source to the destination
+        DESTROY     ///< Destroy the callable in the destination
+    };
+
+    typedef typename std::aligned_storage<INLINE_SIZE,
+        std::alignment_of<void*>::value>::type Storage_t;
+    typedef R (*Invoke_t)(const void* storage, ARGS&&... args);
+    typedef void (*Manage_t)(ManageOp op, void* storage, void* source);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if a callable is stored in m_Storage
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    struct IsInline : std::integral_constant<bool,
+        sizeof(FUNC) <= INLINE_SIZE &&
+        std::alignment_of<Storage_t>::value % std::alignment_of<FUNC>::value == 0 &&
+        std::is_nothrow_move_constructible<FUNC>::value>
+    {};
+
+    template <typename FUNC>
+    static bool IsNull(const FUNC&) { return false; }
+
+    template <typename RET, typename... PARAMS>
+    static bool IsNull(RET (*func)(PARAMS...)) { return func == 0; }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Stores a callable in m_Storage
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC, typename ARG>
+    void Init(ARG&& func, std::true_type)
+    {
+        new (&m_Storage) FUNC(std::forward<ARG>(func));
+        m_Invoke = &InvokeInline<FUNC>;
+        m_Manage = &ManageInline<FUNC>;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Stores a callable created with new
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC, typename ARG>
+    void Init(ARG&& func, std::false_type)
+    {
+        new (&m_Storage) FUNC*(new FUNC(std::forward<ARG>(func)));
+        m_Invoke = &InvokeHeap<FUNC>;
+        m_Manage = &ManageHeap<FUNC>;
+    }
+
+    template <typename FUNC>
+    static R InvokeInline(const void* storage, ARGS&&... args)
+    {
+        FUNC& func = *static_cast<FUNC*>(const_cast<void*>(storage));
+        return func(std::forward<ARGS>(args)...);
+    }
+
+    template <typename FUNC>
+    static R InvokeHeap(const void* storage, ARGS&&... args)
+    {
+        FUNC& func = **static_cast<FUNC* const*>(storage);
+        return func(std::forward<ARGS>(args)...);
+    }
+
+    template <typename FUNC>
+    static void ManageInline(ManageOp op, void* storage, void* source)
+    {
+        if(op == MOVE)
+        {
+            FUNC* from = static_cast<FUNC*>(source);
+            new (storage) FUNC(std::move(*from));
+            from->~FUNC();
+        }
+        else
+        {
+            static_cast<FUNC*>(storage)->~FUNC();
+        }
+    }
+
+    template <typename FUNC>
+    static void ManageHeap(ManageOp op, void* storage, void* source)
+    {
+        if(op == MOVE)
+        {
+            *static_cast<FUNC**>(storage) = *static_cast<FUNC**>(source);
+        }
+        else
+        {
+            delete *static_cast<FUNC**>(storage);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Takes the callable from an other Function, leaving it empty
+    /// @attention This Function must be empty
+    ///////////////////////////////////////////////////////////////////////////
+    void MoveFrom(Function& orig)
+    {
+        if(orig.m_Manage)
+        {
+            orig.m_Manage(MOVE, &m_Storage, &orig.m_Storage);
+        }
+        m_Invoke = orig.m_Invoke;
+        m_Manage = orig.m_Manage;
+        orig.m_Invoke = 0;
+        orig.m_Manage = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The callable, or a pointer to it if it did not fit
+    ///////////////////////////////////////////////////////////////////////////
+    Storage_t m_Storage;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Calls the callable, 0 if empty
+    ///////////////////////////////////////////////////////////////////////////
+    Invoke_t m_Invoke;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Moves and destroys the callable, 0 if empty
+    ///////////////////////////////////////////////////////////////////////////
+    Manage_t m_Manage;
+
+}; // end class Function
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class FunctionRef Function.h <Util/Function.h>
+/// @brief Non-owning reference to a callable
+/// @details Two pointers that refer to a callable owned by the caller.  It
+///     never allocates and is cheap to copy, so it is the parameter type to
+///     use for a callback that is only called before the function taking it
+///     returns, ex. a visitor.
+/// @attention The callable must outlive the FunctionRef.  Do not store a
+///     FunctionRef to a temporary, ex. a lambda written in the same
+///     statement.
+/// @see nik::Function
+///////////////////////////////////////////////////////////////////////////////
+template <typename R, typename... ARGS>
+class FunctionRef<R(ARGS...)>
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] func The callable to refer to
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC, typename = typename std::enable_if<
+        !std::is_same<typename std::decay<FUNC>::type, FunctionRef>::value &&
+        !std::is_function<typename std::remove_reference<FUNC>::type>::value>::type>
+    FunctionRef(FUNC&& func)
+    :
+    m_Invoke(&InvokeObject<typename std::remove_reference<FUNC>::type>)
+    {
+        m_Target.m_Object = const_cast<void*>(static_cast<const void*>(&func));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] func The free function to refer to, must not be null
+    ///////////////////////////////////////////////////////////////////////////
+    FunctionRef(R (*func)(ARGS...))
+    :
+    m_Invoke(&InvokeFree)
+    {
+        assert(func);
+        m_Target.m_Free = func;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Calls the callable
+    /// @param[in] args The arguments to pass on
+    /// @return The value returned by the callable
+    ///////////////////////////////////////////////////////////////////////////
+    R operator()(ARGS... args) const
+    {
+        return m_Invoke(m_Target, std::forward<ARGS>(args)...);
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief What is referred to
+    ///////////////////////////////////////////////////////////////////////////
+    union Target
+    {
+        void* m_Object;             ///< A functor or lambda
+        R (*m_Free)(ARGS...);       ///< A free function
+    };
+
+    typedef R (*Invoke_t)(Target target, ARGS&&... args);
+
+    template <typename FUNC>
+    static R InvokeObject(Target target, ARGS&&... args)
+    {
+        return (*static_cast<FUNC*>(target.m_Object))(std::forward<ARGS>(args)...);
+    }
+
+    static R InvokeFree(Target target, ARGS&&... args)
+    {
+        return target.m_Free(std::forward<ARGS>(args)...);
+    }
+
+    Target m_Target;    ///< The callable
+    Invoke_t m_Invoke;  ///< Calls m_Target
+
+}; // end class FunctionRef
+
+} // end namespace nik
+
+#endif
+
+////////////////////////End-of-File////////////////////////////////////////////
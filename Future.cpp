@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\Future.cpp
+/// @brief Contains the implementation of the Future shared state
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: Shared state comes from a FixedPool per size class
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Future.h"
+#include "Event.h"
+#include "poolallocator.h"
+#include <cassert>
+
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Number of block size classes, 32 bytes apart
+///////////////////////////////////////////////////////////////////////////////
+const size_t CLASS_COUNT = 8;
+const size_t CLASS_STEP = 32;
+static_assert(CLASS_COUNT == 8, "One pool per size class is listed below");
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Takes a block of one size class from its pool
+///////////////////////////////////////////////////////////////////////////////
+template <size_t SIZE_CLASS>
+void* TakeBlock()
+{
+    return nik::FixedPool<(SIZE_CLASS + 1) * CLASS_STEP>::allocate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Returns a block of one size class to its pool
+///////////////////////////////////////////////////////////////////////////////
+template <size_t SIZE_CLASS>
+void PutBlock(void* block)
+{
+    nik::FixedPool<(SIZE_CLASS + 1) * CLASS_STEP>::deallocate(block);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The pools by size class
+/// @details A FixedPool keeps each thread's blocks in a trivially
+///     destructible cache and moves them between threads in batches, so a
+///     state allocated by the submitter and freed by a worker makes its way
+///     back without a lock per block.
+///////////////////////////////////////////////////////////////////////////////
+void* (* const s_Take[CLASS_COUNT])() =
+{
+    &TakeBlock<0>, &TakeBlock<1>, &TakeBlock<2>, &TakeBlock<3>,
+    &TakeBlock<4>, &TakeBlock<5>, &TakeBlock<6>, &TakeBlock<7>
+};
+void (* const s_Put[CLASS_COUNT])(void*) =
+{
+    &PutBlock<0>, &PutBlock<1>, &PutBlock<2>, &PutBlock<3>,
+    &PutBlock<4>, &PutBlock<5>, &PutBlock<6>, &PutBlock<7>
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Continuation that wakes a thread blocked in StateBase::Wait()
+///////////////////////////////////////////////////////////////////////////////
+class Waiter : public nik::FutureDetail::Continuation
+{
+public:
+    Waiter() : m_Event(nik::Event::Create("future.wait")) {}
+    ~Waiter() { delete m_Event; }
+    virtual void OnReady() { m_Event->SetEvent(); }
+    nik::Event* m_Event;    ///< Set when the state is ready
+};
+
+} // end namespace
+
+namespace nik {
+namespace FutureDetail {
+
+//----------------------Static-Members---------------------------------------//
+char StateBase::s_Ready = 0;
+
+//----------------------StateBase-Implementation-----------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void StateBase::Wait()
+{
+    if(IsReady())
+    {
+        return;
+    }
+    // Setting the event is the last thing the setting thread does with the
+    // waiter, so it can live on this stack
+    Waiter waiter;
+    AddContinuation(&waiter);
+    waiter.m_Event->WaitForEvent(Event::FOREVER);
+} // end StateBase::Wait
+
+//----------------------Free-Function-Implementations------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void* AllocateState
+    (
+    size_t size
+    )
+{
+    assert(size > 0);
+    size_t sizeClass = (size - 1) / CLASS_STEP;
+    if(sizeClass >= CLASS_COUNT)
+    {
+        return ::operator new(size);
+    }
+    return s_Take[sizeClass]();
+} // end AllocateState
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void FreeState
+    (
+    void* block,
+    size_t size
+    )
+{
+    size_t sizeClass = (size - 1) / CLASS_STEP;
+    if(sizeClass >= CLASS_COUNT)
+    {
+        ::operator delete(block);
+        return;
+    }
+    s_Put[sizeClass](block);
+} // end FreeState
+
+} // end namespace FutureDetail
+} // end namespace nik
+
+////////////////////////End-of-File////////////////////////////////////////////
@@ -0,0 +1,815 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\Future.h
+/// @brief Contains the declaration of the Future and Promise classes
+/// @details Contains the following:
+///     @li Future - The result of a task, with Then() continuations
+///     @li Promise - Sets the result of a Future
+///     @li WhenAll - A Future that is ready once a set of Futures is ready
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_FUTURE_HEADER
+#define NIK_FUTURE_HEADER
+
+#include <Util/CallBack.h>
+#include <Util/Utility.h>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nik {
+
+template <typename T> class Future;
+template <typename T> class Promise;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Shared state behind Future and Promise
+/// @details Not for use outside of this file.
+///////////////////////////////////////////////////////////////////////////////
+namespace FutureDetail {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocates a block from the shared state pool
+/// @details Blocks are kept on per-thread free lists by size class, so the
+///     shared state of a short task never reaches the heap once the pool
+///     has warmed up.  Large requests go to operator new.
+/// @param[in] size Size of the block in bytes
+/// @attention Throws std::bad_alloc if memory could not be allocated
+///////////////////////////////////////////////////////////////////////////////
+void* AllocateState(size_t size);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Returns a block to the shared state pool
+/// @param[in] block The block, from AllocateState(size_t)
+/// @param[in] size The size passed to AllocateState(size_t)
+///////////////////////////////////////////////////////////////////////////////
+void FreeState(void* block, size_t size);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class Pooled Future.h <Util/Future.h>
+/// @brief Base class that allocates its derived objects from the pool
+///////////////////////////////////////////////////////////////////////////////
+class Pooled
+{
+public:
+    static void* operator new(size_t size) { return AllocateState(size); }
+    static void operator delete(void* block, size_t size) { FreeState(block, size); }
+}; // end class Pooled
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class Continuation Future.h <Util/Future.h>
+/// @brief Node in a shared state's list of things to run when it is ready
+///////////////////////////////////////////////////////////////////////////////
+class Continuation
+{
+public:
+    Continuation() : m_Next(0) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Called once, on the thread that made the state ready
+    /// @attention The node may be destroyed as soon as this is called.
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void OnReady() = 0;
+
+    Continuation* m_Next;   ///< Next node in the list
+protected:
+    virtual ~Continuation() {}
+}; // end class Continuation
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class StateBase Future.h <Util/Future.h>
+/// @brief The part of the shared state that does not depend on the value
+/// @details The state is reference counted by its Futures, Promise and
+///     pending continuations.  Continuations are kept on a lock-free list
+///     that is swapped for a marker when the state becomes ready, so a
+///     continuation is either queued before the value is set, or run
+///     straight away by Then().
+///////////////////////////////////////////////////////////////////////////////
+class StateBase : public Pooled
+{
+public:
+    StateBase() : m_Refs(1), m_Continuations(0) {}
+    virtual ~StateBase() {}
+
+    void AddRef() { m_Refs.fetch_add(1, std::memory_order_relaxed); }
+
+    void Release()
+    {
+        if(m_Refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if the value or error has been set
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsReady() const
+    {
+        return m_Continuations.load(std::memory_order_acquire) == ReadyMarker();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs the node when the state is ready
+    /// @details Runs it on the calling thread if the state is already ready.
+    ///////////////////////////////////////////////////////////////////////////
+    void AddContinuation(Continuation* node)
+    {
+        Continuation* head = m_Continuations.load(std::memory_order_acquire);
+        do
+        {
+            if(head == ReadyMarker())
+            {
+                node->OnReady();
+                return;
+            }
+            node->m_Next = head;
+        } while( !m_Continuations.compare_exchange_weak(head, node,
+            std::memory_order_acq_rel, std::memory_order_acquire));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Marks the state ready and runs the queued continuations
+    /// @details Continuations run in the order they were added.
+    ///////////////////////////////////////////////////////////////////////////
+    void MakeReady()
+    {
+        Continuation* head = m_Continuations.exchange(ReadyMarker(),
+            std::memory_order_acq_rel);
+        Continuation* ordered = 0;
+        while(head)
+        {
+            Continuation* next = head->m_Next;
+            head->m_Next = ordered;
+            ordered = head;
+            head = next;
+        }
+        while(ordered)
+        {
+            Continuation* next = ordered->m_Next;
+            ordered->OnReady();
+            ordered = next;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Blocks until the state is ready
+    ///////////////////////////////////////////////////////////////////////////
+    void Wait();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the error and makes the state ready
+    ///////////////////////////////////////////////////////////////////////////
+    void SetError(std::exception_ptr error)
+    {
+        m_Error = error;
+        MakeReady();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Throws the error, if one was set
+    ///////////////////////////////////////////////////////////////////////////
+    void CheckError() const
+    {
+        if(m_Error)
+        {
+            std::rethrow_exception(m_Error);
+        }
+    }
+
+    std::exception_ptr m_Error; ///< Set instead of the value when the task threw
+
+private:
+    StateBase(const StateBase&);
+    StateBase& operator=(const StateBase&);
+
+    static Continuation* ReadyMarker()
+    {
+        return reinterpret_cast<Continuation*>(&s_Ready);
+    }
+
+    static char s_Ready;                            ///< Address marks m_Continuations ready
+    std::atomic<int> m_Refs;                        ///< Reference count
+    std::atomic<Continuation*> m_Continuations;     ///< Queued continuations, or ReadyMarker()
+}; // end class StateBase
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class State Future.h <Util/Future.h>
+/// @brief Shared state holding a value of type T
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class State : public StateBase
+{
+public:
+    typedef const T& GetResult_t;
+
+    State() : m_HasValue(false) {}
+
+    ~State()
+    {
+        if(m_HasValue)
+        {
+            Value().~T();
+        }
+    }
+
+    template <typename U>
+    void SetValue(U&& value)
+    {
+        new (&m_Storage) T(std::forward<U>(value));
+        m_HasValue = true;
+        MakeReady();
+    }
+
+    const T& Value() const
+    {
+        return *reinterpret_cast<const T*>(&m_Storage);
+    }
+
+    T& Value()
+    {
+        return *reinterpret_cast<T*>(&m_Storage);
+    }
+
+private:
+    typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type m_Storage;
+    bool m_HasValue;    ///< m_Storage holds a constructed T
+}; // end class State
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Shared state of a Future<void>
+///////////////////////////////////////////////////////////////////////////////
+template <>
+class State<void> : public StateBase
+{
+public:
+    typedef void GetResult_t;
+    void SetValue() { MakeReady(); }
+    void Value() const {}
+}; // end class State<void>
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sets a state from the result of a call, or from what it threw
+///////////////////////////////////////////////////////////////////////////////
+template <typename R>
+struct Setter
+{
+    template <typename FUNC>
+    static void Call(State<R>& state, FUNC& func)
+    {
+        state.SetValue(func());
+    }
+
+    template <typename FUNC, typename ARG>
+    static void Call(State<R>& state, FUNC& func, ARG& arg)
+    {
+        state.SetValue(func(arg));
+    }
+};
+
+template <>
+struct Setter<void>
+{
+    template <typename FUNC>
+    static void Call(State<void>& state, FUNC& func)
+    {
+        func();
+        state.SetValue();
+    }
+
+    template <typename FUNC, typename ARG>
+    static void Call(State<void>& state, FUNC& func, ARG& arg)
+    {
+        func(arg);
+        state.SetValue();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Result type of a continuation taking a T
+///////////////////////////////////////////////////////////////////////////////
+template <typename FUNC, typename T>
+struct ThenResult
+{
+    typedef typename std::result_of<FUNC(const T&)>::type type;
+};
+
+template <typename FUNC>
+struct ThenResult<FUNC, void>
+{
+    typedef typename std::result_of<FUNC()>::type type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ThenState Future.h <Util/Future.h>
+/// @brief State of the Future returned by Future<T>::Then()
+/// @details Queued on the parent state; runs the continuation with the
+///     parent's value, or passes the parent's error on without running it.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename FUNC, typename R>
+class ThenState : public State<R>, public Continuation
+{
+public:
+    ThenState(State<T>* parent, const FUNC& func)
+    :
+    m_Parent(parent),
+    m_Func(func)
+    {
+        // The initial reference is held by the parent's list until OnReady()
+        m_Parent->AddRef();
+    }
+
+    virtual void OnReady()
+    {
+        if(m_Parent->m_Error)
+        {
+            this->SetError(m_Parent->m_Error);
+        }
+        else
+        {
+            try
+            {
+                Call(*m_Parent);
+            }
+            catch(...)
+            {
+                this->SetError(std::current_exception());
+            }
+        }
+        m_Parent->Release();
+        this->Release();
+    }
+
+private:
+    void Call(State<void>&) { Setter<R>::Call(*this, m_Func); }
+
+    template <typename U>
+    void Call(State<U>& parent) { Setter<R>::Call(*this, m_Func, parent.Value()); }
+
+    State<T>* m_Parent; ///< State the continuation waits on
+    FUNC m_Func;        ///< The continuation
+}; // end class ThenState
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Value type of WhenAll() for a set of Future<T>
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct AllResult
+{
+    typedef std::vector<T> type;
+
+    static void Set(State<type>& state, const std::vector<Future<T> >& inputs)
+    {
+        type values;
+        values.reserve(inputs.size());
+        for(size_t i = 0; i < inputs.size(); ++i)
+        {
+            values.push_back(inputs[i].m_State->Value());
+        }
+        state.SetValue(std::move(values));
+    }
+};
+
+template <>
+struct AllResult<void>
+{
+    typedef void type;
+
+    static void Set(State<void>& state, const std::vector<Future<void> >&)
+    {
+        state.SetValue();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class AllState Future.h <Util/Future.h>
+/// @brief State of the Future returned by WhenAll()
+/// @details Counts down as each input becomes ready.  The last input to
+///     become ready sets the value, or the first error found in input order.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class AllState : public State<typename AllResult<T>::type>
+{
+public:
+    explicit AllState(const std::vector<Future<T> >& inputs)
+    :
+    m_Inputs(inputs),
+    m_Pending(inputs.size() + 1)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Queues a Link on every input
+    /// @details Holds one count itself so the state cannot become ready
+    ///     before every link has been queued.
+    ///////////////////////////////////////////////////////////////////////////
+    void Start()
+    {
+        for(size_t i = 0; i < m_Inputs.size(); ++i)
+        {
+            m_Inputs[i].m_State->AddContinuation(new Link(this));
+        }
+        Arrive();
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Continuation queued on one input
+    ///////////////////////////////////////////////////////////////////////////
+    class Link : public Continuation, public Pooled
+    {
+    public:
+        explicit Link(AllState* owner) : m_Owner(owner) { m_Owner->AddRef(); }
+
+        virtual void OnReady()
+        {
+            AllState* owner = m_Owner;
+            delete this;
+            owner->Arrive();
+            owner->Release();
+        }
+
+    private:
+        AllState* m_Owner;  ///< The WhenAll() state
+    }; // end class Link
+
+    void Arrive()
+    {
+        if(m_Pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+        for(size_t i = 0; i < m_Inputs.size(); ++i)
+        {
+            if(m_Inputs[i].m_State->m_Error)
+            {
+                this->SetError(m_Inputs[i].m_State->m_Error);
+                return;
+            }
+        }
+        AllResult<T>::Set(*this, m_Inputs);
+    }
+
+    std::vector<Future<T> > m_Inputs;   ///< The Futures waited on
+    std::atomic<size_t> m_Pending;      ///< Inputs not yet ready, plus one
+}; // end class AllState
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class PromiseTask Future.h <Util/Future.h>
+/// @brief Task that runs a callable and sets a Promise from the result
+/// @see ThreadPool::Async()
+///////////////////////////////////////////////////////////////////////////////
+template <typename FUNC, typename R>
+class PromiseTask : public GenericFunctor, public Pooled
+{
+public:
+    PromiseTask(const FUNC& func, const Promise<R>& promise)
+    :
+    m_Func(func),
+    m_Promise(promise)
+    {}
+
+    virtual void CallFunc()
+    {
+        try
+        {
+            Setter<R>::Call(*m_Promise.m_State, m_Func);
+        }
+        catch(...)
+        {
+            m_Promise.m_State->SetError(std::current_exception());
+        }
+    }
+
+private:
+    FUNC m_Func;            ///< The task
+    Promise<R> m_Promise;   ///< Set from the task's result
+}; // end class PromiseTask
+
+} // end namespace FutureDetail
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class Future Future.h <Util/Future.h>
+/// @brief The result of a task that may not have finished yet
+/// @details A Future is a counted handle to shared state set once by a
+///     Promise, by ThreadPool::Async(), or by the continuation of another
+///     Future.  Copies share the same state.
+///
+///     Then() chains a continuation that is run with the value when it is
+///     set, on the thread that sets it.  If the value is already set the
+///     continuation runs on the calling thread before Then() returns.  This
+///     lets a pipeline of dependent stages run back to back on one worker
+///     without a thread or an Event per stage.  Continuations should be
+///     short; hand longer work back to a ThreadPool.
+///
+///     If the task or a continuation throws, the exception is stored and
+///     passed down the chain without running the later continuations.
+///     Get() rethrows it.
+///
+///     Shared state is allocated from a per-thread pool rather than with new
+///     per task.
+/// @attention Wait() and Get() block the calling thread.  Calling them from
+///     a ThreadPool worker on a Future that needs the same pool can
+///     deadlock; chain with Then() instead.
+/// @see nik::Promise
+/// @see nik::WhenAll
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class Future
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Creates a Future with no state.  IsValid() returns false.
+    ///////////////////////////////////////////////////////////////////////////
+    Future()
+    :
+    m_State(0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy Constructor
+    /// @param[in] orig The Future to share state with
+    ///////////////////////////////////////////////////////////////////////////
+    Future(const Future& orig)
+    :
+    m_State(orig.m_State)
+    {
+        if(m_State)
+        {
+            m_State->AddRef();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Move Constructor
+    /// @param[in] orig The Future to take the state from
+    ///////////////////////////////////////////////////////////////////////////
+    Future(Future&& orig)
+    :
+    m_State(orig.m_State)
+    {
+        orig.m_State = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    ///////////////////////////////////////////////////////////////////////////
+    ~Future()
+    {
+        if(m_State)
+        {
+            m_State->Release();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment operator
+    /// @param[in] rhs The Future to share state with
+    /// @return A reference to this object
+    ///////////////////////////////////////////////////////////////////////////
+    Future& operator=(Future rhs)
+    {
+        Swap(rhs);
+        return *this;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Swaps the contents of two objects
+    /// @param[in] rhs The object to swap contents with
+    ///////////////////////////////////////////////////////////////////////////
+    void Swap(Future& rhs)
+    {
+        std::swap(m_State, rhs.m_State);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if the Future has shared state
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsValid() const
+    {
+        return m_State != 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if the value or error has been set
+    /// @return @arg true - Get() will not block
+    ///         @arg false - The task has not finished
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsReady() const
+    {
+        return m_State->IsReady();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Blocks until the value or error has been set
+    ///////////////////////////////////////////////////////////////////////////
+    void Wait() const
+    {
+        m_State->Wait();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the value, blocking until it has been set
+    /// @attention Rethrows the exception thrown by the task or a continuation
+    /// @return A reference to the value, valid while a Future holds the state
+    ///////////////////////////////////////////////////////////////////////////
+    typename FutureDetail::State<T>::GetResult_t Get() const
+    {
+        m_State->Wait();
+        m_State->CheckError();
+        return m_State->Value();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Chains a continuation
+    /// @details The continuation is called with the value, a const T&, or no
+    ///     arguments for Future<void>.  It runs on the thread that sets the
+    ///     value, or on the calling thread if the value is already set.
+    /// @param[in] func The continuation, copied
+    /// @return A Future for the value returned by the continuation
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    Future<typename FutureDetail::ThenResult<FUNC, T>::type> Then(const FUNC& func) const
+    {
+        typedef typename FutureDetail::ThenResult<FUNC, T>::type R;
+        FutureDetail::ThenState<T, FUNC, R>* state =
+            new FutureDetail::ThenState<T, FUNC, R>(m_State, func);
+        Future<R> result(state);
+        m_State->AddContinuation(state);
+        return result;
+    }
+
+private:
+    template <typename U> friend class Future;
+    template <typename U> friend class Promise;
+    template <typename U> friend class FutureDetail::AllState;
+    template <typename U> friend struct FutureDetail::AllResult;
+    template <typename U> friend Future<typename FutureDetail::AllResult<U>::type>
+        WhenAll(const std::vector<Future<U> >& futures);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] state The state to take a reference on
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Future(FutureDetail::State<T>* state)
+    :
+    m_State(state)
+    {
+        m_State->AddRef();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The shared state, 0 if none
+    ///////////////////////////////////////////////////////////////////////////
+    FutureDetail::State<T>* m_State;
+
+}; // end class Future
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class Promise Future.h <Util/Future.h>
+/// @brief Sets the value of a Future
+/// @details Use when the value comes from somewhere other than a task run by
+///     ThreadPool::Async(), ex. a reply arriving on another thread.  Copies
+///     share the same state.  The value may be set only once.
+///
+///     If the last Promise is destroyed without setting the value, the
+///     Future is given a nik::Error so that nothing waits on it forever.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class Promise
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Creates the shared state.
+    ///////////////////////////////////////////////////////////////////////////
+    Promise()
+    :
+    m_State(new PromiseState)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy Constructor
+    /// @param[in] orig The Promise to share state with
+    ///////////////////////////////////////////////////////////////////////////
+    Promise(const Promise& orig)
+    :
+    m_State(orig.m_State)
+    {
+        m_State->AddPromise();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    ///////////////////////////////////////////////////////////////////////////
+    ~Promise()
+    {
+        m_State->ReleasePromise();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets a Future sharing this Promise's state
+    ///////////////////////////////////////////////////////////////////////////
+    Future<T> GetFuture() const
+    {
+        return Future<T>(m_State);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the value and runs the Future's continuations
+    /// @param[in] value The value, for Promise<void> call with no arguments
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    void SetValue(ARGS&&... value)
+    {
+        m_State->SetValue(std::forward<ARGS>(value)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets an error and runs the Future's continuations
+    /// @param[in] error The exception Get() will rethrow
+    ///////////////////////////////////////////////////////////////////////////
+    void SetError(std::exception_ptr error)
+    {
+        m_State->SetError(error);
+    }
+
+private:
+    template <typename FUNC, typename R> friend class FutureDetail::PromiseTask;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    Promise& operator=(const Promise&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief State that also counts its Promises
+    ///////////////////////////////////////////////////////////////////////////
+    class PromiseState : public FutureDetail::State<T>
+    {
+    public:
+        PromiseState() : m_Promises(1) {}
+
+        void AddPromise()
+        {
+            m_Promises.fetch_add(1, std::memory_order_relaxed);
+            this->AddRef();
+        }
+
+        void ReleasePromise()
+        {
+            if(m_Promises.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+               !this->IsReady())
+            {
+                this->SetError(std::make_exception_ptr(
+                    Error("Promise destroyed without setting a value")));
+            }
+            this->Release();
+        }
+
+    private:
+        std::atomic<int> m_Promises;    ///< Promises sharing the state
+    }; // end class PromiseState
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The shared state
+    ///////////////////////////////////////////////////////////////////////////
+    PromiseState* m_State;
+
+}; // end class Promise
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Gets a Future that is ready when all of the given Futures are
+/// @details The value is a vector of the input values in input order, or
+///     nothing for Future<void> inputs.  If any input has an error, the
+///     result gets the error of the first such input.  The result is set
+///     on the thread that sets the last input.
+/// @param[in] futures The Futures to wait on, may be empty
+/// @return The combined Future
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Future<typename FutureDetail::AllResult<T>::type> WhenAll
+    (
+    const std::vector<Future<T> >& futures
+    )
+{
+    FutureDetail::AllState<T>* state = new FutureDetail::AllState<T>(futures);
+    Future<typename FutureDetail::AllResult<T>::type> result(state);
+    state->Start();
+    state->Release();
+    return result;
+} // end WhenAll
+
+} // end namespace nik
+
+#endif
+
+////////////////////////End-of-File////////////////////////////////////////////
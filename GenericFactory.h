@@ -4,43 +4,154 @@
 /// @internal
 ///
 /// 20March2010, nik: initial
+/// 14October2026, nik: Hashed lock-free lookup, creator arguments,
+///     static registration and a product allocation hook
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_GENERIC_FACTORY_HEADER
 #define NIK_GENERIC_FACTORY_HEADER
 
-#include <map>
+#include <Util/Mutex.h>
+#include <Util/ScopeLock.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace nik {
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocates products with new and delete
+/// @details The default allocation hook of GenericFactory.  A hook is any
+///     class with the same two static functions, ex. to construct the
+///     products in a pool of blocks:
+/// @code
+///     struct PooledProducts
+///     {
+///         template <class T, class... ARGS>
+///         static T* New(ARGS&&... args)
+///         {
+///             static_assert(sizeof(T) <= 128, "Product too big for the pool");
+///             void* memory = FixedPool<128>::allocate();
+///             try { return new(memory) T(std::forward<ARGS>(args)...); }
+///             catch(...) { FixedPool<128>::deallocate(memory); throw; }
+///         }
+///
+///         template <class T>
+///         static void Delete(T* product)
+///         {
+///             if(product)
+///             {
+///                 product->~T();
+///                 FixedPool<128>::deallocate(product);
+///             }
+///         }
+///     };
+/// @endcode
+///////////////////////////////////////////////////////////////////////////////
+struct DefaultProductAllocator
+{
+    template <class T, class... ARGS>
+    static T* New(ARGS&&... args)
+    {
+        return new T(std::forward<ARGS>(args)...);
+    }
+
+    template <class T>
+    static void Delete(T* product)
+    {
+        delete product;
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief A generic object factory
 /// @details This class is an implementation of the Object Factory pattern.
 ///     This class uses registration to set up the types of objects this
 ///     factory will create.  Product classes register themselves with the
 ///     factory by supplying a type-ID and a creation function.
+///
+///     The type-IDs are kept in an open addressed hash table.  Create() only
+///     reads the table, without a lock, so any number of threads may create
+///     products while others register.  Registration takes a lock, and a
+///     table that fills up is replaced by a bigger one; the old tables are
+///     kept until the factory is destroyed, so a reader is never left on
+///     freed memory.  Freeze() ends registration, usually once static
+///     registration is done, and spreads the table out for short lookups.
+///
+///     The creation functions may take arguments, which Create() forwards.
+///     Products are registered at startup with NIK_FACTORY_REGISTER, and
+///     MakeProduct() is a creation function for any product class that
+///     allocates through the factory's hook.
+/// @code
+///     typedef nik::GenericFactory<Shape, std::string, Shape* (*)(double)> ShapeFactory;
+///     NIK_FACTORY_REGISTER(nik::Singleton<ShapeFactory>::Ref(), "circle",
+///         &ShapeFactory::MakeProduct<Circle, double>);
+///     ...
+///     Shape* shape = nik::Singleton<ShapeFactory>::Ref().Create("circle", 2.0);
+///     nik::Singleton<ShapeFactory>::Ref().Destroy(shape);
+/// @endcode
 /// @tparam Product The type the factory will create
 /// @tparam IDType The type for the type-ID fields.
-/// @tparam ProductCreate The prototype for the creation functions that will 
+/// @tparam ProductCreator The prototype for the creation functions that will
 ///     be registered for each type.
-/// @tparam IDTypeCompare The functor to use to compare the type-IDs for 
+/// @tparam IDTypeHash The functor to use to hash the type-IDs
+/// @tparam IDTypeEqual The functor to use to compare the type-IDs for
 ///     equality
+/// @tparam ProductAllocator The hook used by MakeProduct() and Destroy(),
+///     see DefaultProductAllocator
+/// @attention Registering from static constructors in several files needs
+///     the factory to be constructed first, ex. as a Singleton.
 ///////////////////////////////////////////////////////////////////////////////
 template
-< 
+<
     class Product,
     class IDType,
     class ProductCreator = Product* (*)(),
-    class IDTypeCompare = std::less<IDType>
+    class IDTypeHash = std::hash<IDType>,
+    class IDTypeEqual = std::equal_to<IDType>,
+    class ProductAllocator = DefaultProductAllocator
 >
-class GenericFactory 
+class GenericFactory
 {
 public:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    ///////////////////////////////////////////////////////////////////////////
+    GenericFactory()
+    :
+    m_Lock(Mutex::Create()),
+    m_Table(0),
+    m_Count(0),
+    m_Frozen(false)
+    {
+        m_Table.store(NewTable(MinCapacity), std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @attention No thread may be using the factory
+    ///////////////////////////////////////////////////////////////////////////
+    ~GenericFactory()
+    {
+        for(size_t i = 0; i <= m_Table.load()->m_Mask; ++i)
+        {
+            delete m_Table.load()->m_Slots[i].load(std::memory_order_relaxed);
+        }
+        DeleteTable(m_Table.load());
+        for(size_t i = 0; i < m_Retired.size(); ++i)
+        {
+            DeleteTable(m_Retired[i]);
+        }
+        delete m_Lock;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Registers a creation function and type ID
-    /// @details This function attempts to register a creation function mapped to 
-    ///     a type ID.  If the type ID has already been taken, this function
-    ///     returns false;
+    /// @details This function attempts to register a creation function mapped to
+    ///     a type ID.  If the type ID has already been taken, or the factory
+    ///     has been frozen, this function returns false;
     /// @param[in] id The ID to map to the creation function
     /// @param[in] creator The function to call to create the product
     /// @return @arg true Registration succeeded
@@ -48,50 +159,236 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     bool Register(const IDType& id, ProductCreator creator)
     {
+        size_t hash = m_Hash(id);
+        ScopeLock lock(m_Lock);
+
         // Check if the type ID has already been taken
-        Creator_Map_t::const_iterator it = m_Creator.find(id);
-        if(it != m_Creator.end())
+        if(m_Frozen || Find(m_Table.load(std::memory_order_relaxed), id, hash))
         {
             return false;
         }
-    
-        m_Creator.insert(std::make_pair(id, creator));
+
+        // Keep the table at most half full
+        Table* table = m_Table.load(std::memory_order_relaxed);
+        if((m_Count + 1) * 2 > table->m_Mask + 1)
+        {
+            table = Rebuild((table->m_Mask + 1) * 2);
+        }
+        Insert(table, new Entry(id, hash, creator));
+        ++m_Count;
         return true;
     } // end Register
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Ends registration
+    /// @details Later calls to Register() fail.  The table is rebuilt at most
+    ///     a quarter full, so lookups rarely probe more than one slot.
+    ///////////////////////////////////////////////////////////////////////////
+    void Freeze()
+    {
+        ScopeLock lock(m_Lock);
+        if(m_Frozen)
+        {
+            return;
+        }
+        m_Frozen = true;
+        size_t capacity = MinCapacity;
+        while(capacity < m_Count * 4)
+        {
+            capacity <<= 1;
+        }
+        if(capacity > m_Table.load(std::memory_order_relaxed)->m_Mask + 1)
+        {
+            Rebuild(capacity);
+        }
+    } // end Freeze
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Creates the object type corresponding the the type ID
+    /// @details Safe to call from any thread, without a lock.
     /// @param[in] id The ID of the type to create
+    /// @param[in] args Forwarded to the creation function
     /// @return Returns a pointer to the newly created object.  Will return 0 if
     ///     the ID did not match any known type.
     ///////////////////////////////////////////////////////////////////////////
-    Product* Create(const IDType& id)
+    template <class... ARGS>
+    Product* Create(const IDType& id, ARGS&&... args) const
     {
-        Creator_Map_t::iterator it = m_Creator.find(id);
-        if(it == m_Creator.end())
+        const Entry* entry = Find(m_Table.load(std::memory_order_acquire), id, m_Hash(id));
+        if( !entry)
         {
             return 0;
         }
-        return it->second();
+        return entry->m_Creator(std::forward<ARGS>(args)...);
     } // end Create
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destroys a product made by MakeProduct()
+    /// @param[in] product The product, or 0
+    ///////////////////////////////////////////////////////////////////////////
+    static void Destroy(Product* product)
+    {
+        ProductAllocator::Delete(product);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A creation function for DERIVED, allocated by the hook
+    /// @details Register &MakeProduct<DERIVED, ARGS...> with ARGS matching
+    ///     the arguments of ProductCreator.
+    ///////////////////////////////////////////////////////////////////////////
+    template <class DERIVED, class... ARGS>
+    static Product* MakeProduct(ARGS... args)
+    {
+        return ProductAllocator::template New<DERIVED>(std::forward<ARGS>(args)...);
+    }
 
 private:
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Maps type ID's to creation functions
+    /// @brief Copy construction has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    GenericFactory(const GenericFactory&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
     ///////////////////////////////////////////////////////////////////////////
-    typedef std::map<IDType, ProductCreator, IDTypeCompare> Creator_Map_t;
-    
+    GenericFactory& operator=(const GenericFactory&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A type ID and its creation function, never changed once added
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Entry(const IDType& id, size_t hash, ProductCreator creator)
+        : m_ID(id), m_Hash(hash), m_Creator(creator) {}
+
+        IDType m_ID;
+        size_t m_Hash;
+        ProductCreator m_Creator;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A power of two sized array of slots, probed linearly
+    ///////////////////////////////////////////////////////////////////////////
+    struct Table
+    {
+        size_t m_Mask;
+        std::atomic<Entry*>* m_Slots;
+    };
+
+    enum { MinCapacity = 16 };
+
+    static Table* NewTable(size_t capacity)
+    {
+        Table* table = new Table;
+        table->m_Mask = capacity - 1;
+        table->m_Slots = new std::atomic<Entry*>[capacity];
+        for(size_t i = 0; i < capacity; ++i)
+        {
+            table->m_Slots[i].store(0, std::memory_order_relaxed);
+        }
+        return table;
+    }
+
+    static void DeleteTable(Table* table)
+    {
+        delete [] table->m_Slots;
+        delete table;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Looks up a type ID
+    /// @return The entry, or 0 if the ID is not registered
+    ///////////////////////////////////////////////////////////////////////////
+    const Entry* Find(const Table* table, const IDType& id, size_t hash) const
+    {
+        for(size_t i = hash; ; ++i)
+        {
+            const Entry* entry = table->m_Slots[i & table->m_Mask].load(std::memory_order_acquire);
+            if( !entry)
+            {
+                return 0;
+            }
+            if(entry->m_Hash == hash && m_Equal(entry->m_ID, id))
+            {
+                return entry;
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Stores the type ID, creation function pairs
+    /// @brief Publishes an entry in the first free slot of its probe
+    /// @note Called with the lock held
     ///////////////////////////////////////////////////////////////////////////
-    Creator_Map_t m_Creator;
+    static void Insert(Table* table, Entry* entry)
+    {
+        size_t i = entry->m_Hash;
+        while(table->m_Slots[i & table->m_Mask].load(std::memory_order_relaxed))
+        {
+            ++i;
+        }
+        table->m_Slots[i & table->m_Mask].store(entry, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Replaces the table with a copy of the given capacity
+    /// @details The old table is kept for readers still probing it.
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    Table* Rebuild(size_t capacity)
+    {
+        Table* old = m_Table.load(std::memory_order_relaxed);
+        Table* table = NewTable(capacity);
+        for(size_t i = 0; i <= old->m_Mask; ++i)
+        {
+            if(Entry* entry = old->m_Slots[i].load(std::memory_order_relaxed))
+            {
+                Insert(table, entry);
+            }
+        }
+        m_Table.store(table, std::memory_order_release);
+        m_Retired.push_back(old);
+        return table;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Guards registration
+    ///////////////////////////////////////////////////////////////////////////
+    Mutex* m_Lock;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The table readers use
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<Table*> m_Table;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Tables replaced by a bigger one, freed with the factory
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Table*> m_Retired;
+
+    size_t m_Count;         ///< Registered type IDs
+    bool m_Frozen;          ///< Set by Freeze()
+    IDTypeHash m_Hash;
+    IDTypeEqual m_Equal;
 
 }; // end class GenericFactory
 
 } // end namespace nik
 
+#define NIK_FACTORY_CONCAT_IMPL(a, b) a##b
+#define NIK_FACTORY_CONCAT(a, b) NIK_FACTORY_CONCAT_IMPL(a, b)
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Register a creation function during static initialization
+/// @details Used at namespace scope in the product's source file.
+/// @param[in] factory The factory, ex. nik::Singleton<ShapeFactory>::Ref()
+/// @param[in] id The type ID
+/// @param[in] ... The creation function, which may hold commas
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_FACTORY_REGISTER(factory, id, ...) \
+    static const bool NIK_FACTORY_CONCAT(nik_factory_registered_, __LINE__) = \
+        (factory).Register(id, __VA_ARGS__)
+
 #endif
 
 ////////////////////////End-of-File////////////////////////////////////////////
@@ -0,0 +1,384 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\LatencyHistogram.cpp
+/// @brief Implements the latency probe classes defined in
+///     Util\LatencyHistogram.h
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: Shard cache survives the thread's TLS destructors
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LatencyHistogram.h"
+#include "Logger.h"
+#include "ScopeLock.h"
+#include "SyncStats.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <cstdio>
+
+//----------------------Constants--------------------------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Source of the histogram IDs
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<size_t> Next_Histogram_ID_glob(0);
+
+} // end namespace
+
+namespace nik {
+
+//----------------------LatencyHistogram-Implementation----------------------//
+//----------------------Static-Members---------------------------------------//
+thread_local LatencyHistogram::ShardCache LatencyHistogram::s_ShardCache = { 0, 0, false };
+thread_local LatencyHistogram::CacheFlusher LatencyHistogram::s_CacheFlusher;
+
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::LatencyHistogram
+    (
+    Timer::Clock_t clock
+    )
+:
+m_ID(Next_Histogram_ID_glob.fetch_add(1, std::memory_order_relaxed)),
+m_Clock(clock),
+m_Shards(0)
+{
+} // end LatencyHistogram::LatencyHistogram
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::~LatencyHistogram()
+{
+    // Shards still owned by a live thread are left for that thread to
+    // delete when it exits
+    Shard* shard = m_Shards.load(std::memory_order_acquire);
+    while(shard)
+    {
+        Shard* next = shard->m_Next;
+        int state = IN_USE;
+        if( !shard->m_State.compare_exchange_strong(state, DETACHED))
+        {
+            delete shard;
+        }
+        shard = next;
+    }
+} // end LatencyHistogram::~LatencyHistogram
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.m_Counts.assign(BUCKET_COUNT, 0);
+    if(m_Clock == Timer::CLOCK_CYCLES)
+    {
+        snapshot.m_NsPerTick = 1e9 / Timer::CyclesPerSecond();
+    }
+    Shard* shard = m_Shards.load(std::memory_order_acquire);
+    for(; shard; shard = shard->m_Next)
+    {
+        for(size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            uint64_t count = shard->m_Counts[i].load(std::memory_order_relaxed);
+            snapshot.m_Counts[i] += count;
+            snapshot.m_Count += count;
+        }
+        snapshot.m_Sum += shard->m_Sum.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+} // end LatencyHistogram::GetSnapshot
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t LatencyHistogram::BucketMax
+    (
+    size_t index
+    )
+{
+    if(index < (size_t(1) << SUB_BUCKET_BITS))
+    {
+        return index;
+    }
+    size_t shift = (index >> SUB_BUCKET_BITS) - 1;
+    uint64_t first = (uint64_t(1) << SUB_BUCKET_BITS) |
+        (index & ((size_t(1) << SUB_BUCKET_BITS) - 1));
+    return ((first + 1) << shift) - 1;
+} // end LatencyHistogram::BucketMax
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::Shard::Shard()
+:
+m_Sum(0),
+m_State(IN_USE),
+m_Next(0)
+{
+    for(size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        m_Counts[i].store(0, std::memory_order_relaxed);
+    }
+} // end LatencyHistogram::Shard::Shard
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::Shard* LatencyHistogram::ClaimShard()
+{
+    ShardCache& cache = s_ShardCache;
+    if(cache.m_Exited)
+    {
+        return 0;
+    }
+    // Make sure the shards are released when the thread exits
+    (void)&s_CacheFlusher;
+
+    // Reuse the shard of a thread that exited, keeping its counts
+    Shard* shard = m_Shards.load(std::memory_order_acquire);
+    for(; shard; shard = shard->m_Next)
+    {
+        int state = FREE;
+        if(shard->m_State.compare_exchange_strong(state, IN_USE,
+            std::memory_order_acquire))
+        {
+            break;
+        }
+    }
+    if( !shard)
+    {
+        shard = new Shard;
+        Shard* head = m_Shards.load(std::memory_order_relaxed);
+        do
+        {
+            shard->m_Next = head;
+        } while( !m_Shards.compare_exchange_weak(head, shard,
+            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    if(m_ID >= cache.m_Size)
+    {
+        size_t size = std::max(m_ID + 1, cache.m_Size * 2);
+        Shard** shards = new Shard*[size]();
+        std::copy(cache.m_Shards, cache.m_Shards + cache.m_Size, shards);
+        delete[] cache.m_Shards;
+        cache.m_Shards = shards;
+        cache.m_Size = size;
+    }
+    cache.m_Shards[m_ID] = shard;
+    return shard;
+} // end LatencyHistogram::ClaimShard
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::CacheFlusher::~CacheFlusher()
+{
+    // Anything recorded after this by a later TLS or static destructor is
+    // dropped rather than claiming a shard that would never be released
+    ShardCache& cache = s_ShardCache;
+    cache.m_Exited = true;
+    for(size_t i = 0; i < cache.m_Size; ++i)
+    {
+        Shard* shard = cache.m_Shards[i];
+        if( !shard)
+        {
+            continue;
+        }
+        int state = IN_USE;
+        if( !shard->m_State.compare_exchange_strong(state, FREE,
+            std::memory_order_release))
+        {
+            // The histogram was destroyed first
+            delete shard;
+        }
+    }
+    delete[] cache.m_Shards;
+    cache.m_Shards = 0;
+    cache.m_Size = 0;
+} // end LatencyHistogram::CacheFlusher::~CacheFlusher
+
+//----------------------Snapshot-Implementation------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::Snapshot::Snapshot()
+:
+m_Count(0),
+m_Sum(0),
+m_NsPerTick(1)
+{
+} // end LatencyHistogram::Snapshot::Snapshot
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+double LatencyHistogram::Snapshot::Percentile
+    (
+    double percent
+    ) const
+{
+    if(m_Count == 0)
+    {
+        return 0;
+    }
+    // The rank of the percentile, counting from 1
+    uint64_t rank = static_cast<uint64_t>(percent / 100 * m_Count + 0.5);
+    if(rank < 1)
+    {
+        rank = 1;
+    }
+    if(rank > m_Count)
+    {
+        rank = m_Count;
+    }
+    uint64_t seen = 0;
+    size_t i = 0;
+    for(; i + 1 < m_Counts.size(); ++i)
+    {
+        seen += m_Counts[i];
+        if(seen >= rank)
+        {
+            break;
+        }
+    }
+    return LatencyHistogram::BucketMax(i) * m_NsPerTick;
+} // end LatencyHistogram::Snapshot::Percentile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+double LatencyHistogram::Snapshot::Mean() const
+{
+    return m_Count ? double(m_Sum) / m_Count * m_NsPerTick : 0;
+} // end LatencyHistogram::Snapshot::Mean
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram::Snapshot& LatencyHistogram::Snapshot::operator-=
+    (
+    const Snapshot& earlier
+    )
+{
+    if(earlier.m_Counts.empty())
+    {
+        return *this;
+    }
+    m_Count = 0;
+    for(size_t i = 0; i < m_Counts.size(); ++i)
+    {
+        m_Counts[i] -= earlier.m_Counts[i];
+        m_Count += m_Counts[i];
+    }
+    m_Sum -= earlier.m_Sum;
+    return *this;
+} // end LatencyHistogram::Snapshot::operator-=
+
+//----------------------MetricsRegistry-Implementation-----------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+MetricsRegistry& MetricsRegistry::Ref()
+{
+    static MetricsRegistry* registry = new MetricsRegistry;
+    return *registry;
+} // end MetricsRegistry::Ref
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+LatencyHistogram& MetricsRegistry::GetHistogram
+    (
+    const std::string& name
+    )
+{
+    ScopeLock lock(m_Lock);
+    Entry*& entry = m_Entries[name];
+    if( !entry)
+    {
+        entry = new Entry;
+    }
+    return entry->m_Histogram;
+} // end MetricsRegistry::GetHistogram
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MetricsRegistry::Report
+    (
+    std::string& out
+    )
+{
+    ScopeLock lock(m_Lock);
+    std::map<std::string, Entry*>::iterator it = m_Entries.begin();
+    for(; it != m_Entries.end(); ++it)
+    {
+        Entry& entry = *it->second;
+        LatencyHistogram::Snapshot now = entry.m_Histogram.GetSnapshot();
+        LatencyHistogram::Snapshot interval = now;
+        interval -= entry.m_Reported;
+        entry.m_Reported = now;
+        if(interval.Count() == 0)
+        {
+            continue;
+        }
+        char line[256];
+        snprintf(line, sizeof(line),
+            "[latency] %s n=%llu p50=%.3fus p99=%.3fus p999=%.3fus max=%.3fus\n",
+            it->first.c_str(), static_cast<unsigned long long>(interval.Count()),
+            interval.Percentile(50) / 1000, interval.Percentile(99) / 1000,
+            interval.Percentile(99.9) / 1000, interval.Max() / 1000);
+        out += line;
+    }
+    SyncStats::Report(out);
+} // end MetricsRegistry::Report
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MetricsRegistry::StartReporting
+    (
+    Logger& logger,
+    size_t periodMs
+    )
+{
+    logger.SetReporter([this](std::string& out) { Report(out); }, periodMs);
+} // end MetricsRegistry::StartReporting
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MetricsRegistry::StopReporting
+    (
+    Logger& logger
+    )
+{
+    logger.SetReporter(Logger::Reporter_t(), 0);
+} // end MetricsRegistry::StopReporting
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+MetricsRegistry::MetricsRegistry()
+:
+m_Lock(Mutex::Create())
+{
+    if( !m_Lock)
+    {
+        throw Error("Error: MetricsRegistry->Mutex::Create failed");
+    }
+} // end MetricsRegistry::MetricsRegistry
+
+} // end namespace nik
+
+//----------------------End-File---------------------------------------------//
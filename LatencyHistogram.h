@@ -0,0 +1,402 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\LatencyHistogram.h
+/// @brief Contains the declarations of the latency probe classes
+/// @details Contains the following:
+///     @li LatencyHistogram - Lock-free, per-thread log-linear histogram
+///     @li ScopedTimer - Records the time spent in a scope
+///     @li MetricsRegistry - Process-wide histograms looked up by name
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_LATENCY_HISTOGRAM_HEADER
+#define NIK_LATENCY_HISTOGRAM_HEADER
+
+#include <Util/Timer.h>
+#include <Util/Mutex.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Compiles the NIK_LATENCY_SCOPE probes in
+/// @details Define it to 0 on the command line to compile the probes out,
+///     ex. -DNIK_LATENCY_PROBES=0
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_LATENCY_PROBES
+#define NIK_LATENCY_PROBES 1
+#endif
+
+namespace nik {
+
+class Logger;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class LatencyHistogram LatencyHistogram.h <Util/LatencyHistogram.h>
+/// @brief Histogram of latencies, cheap enough to leave on in hot paths
+/// @details Values are counted in log-linear buckets: each power of two is
+///     split into 32 equal buckets, so a reported value is within about 3%
+///     of the true one, from one tick up to 2^44 ticks.
+///
+///     Every thread records into its own copy of the buckets, so Record() is
+///     a thread local lookup and a relaxed store with no lock and no shared
+///     cache line.  GetSnapshot() sums the copies from any thread while
+///     others keep recording.  A thread's copy is kept when it exits and
+///     reused by the next new thread.
+///
+///     Values are in ticks of the histogram's clock.  With CLOCK_CYCLES, the
+///     default, a probe costs two time stamp counter reads; ticks are only
+///     converted to nanoseconds when a snapshot is taken.
+/// @see ScopedTimer, MetricsRegistry
+///////////////////////////////////////////////////////////////////////////////
+class LatencyHistogram
+{
+public:
+
+    static const size_t SUB_BUCKET_BITS = 5;
+    static const size_t MAX_VALUE_BITS = 44;
+    static const size_t BUCKET_COUNT =
+        (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Bucket counts summed over every thread
+    ///////////////////////////////////////////////////////////////////////////
+    class Snapshot
+    {
+    public:
+        Snapshot();
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Get a percentile
+        /// @param[in] percent In [0, 100], ex. 99.9
+        /// @return The highest value of the bucket holding the percentile, in
+        ///     nanoseconds, or 0 if nothing was recorded
+        ///////////////////////////////////////////////////////////////////////
+        double Percentile(double percent) const;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Get the mean, in nanoseconds
+        ///////////////////////////////////////////////////////////////////////
+        double Mean() const;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Get the highest value of the highest occupied bucket, in
+        ///     nanoseconds
+        ///////////////////////////////////////////////////////////////////////
+        double Max() const { return Percentile(100); }
+
+        uint64_t Count() const { return m_Count; }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Remove an earlier snapshot of the same histogram
+        /// @details Leaves what was recorded between the two snapshots.
+        /// @param[in] earlier The earlier snapshot
+        ///////////////////////////////////////////////////////////////////////
+        Snapshot& operator-=(const Snapshot& earlier);
+
+    private:
+        friend class LatencyHistogram;
+
+        std::vector<uint64_t> m_Counts; ///< Count per bucket
+        uint64_t m_Count;               ///< Sum of m_Counts
+        uint64_t m_Sum;                 ///< Sum of the recorded ticks
+        double m_NsPerTick;             ///< Converts ticks to nanoseconds
+    }; // end class Snapshot
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] clock The clock ScopedTimer reads, and so the unit of the
+    ///     recorded values
+    ///////////////////////////////////////////////////////////////////////////
+    explicit LatencyHistogram(Timer::Clock_t clock = Timer::CLOCK_CYCLES);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @attention No thread may be recording into the histogram
+    ///////////////////////////////////////////////////////////////////////////
+    ~LatencyHistogram();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Record a value
+    /// @param[in] ticks The value, in ticks of the histogram's clock
+    ///////////////////////////////////////////////////////////////////////////
+    void Record(uint64_t ticks)
+    {
+        Shard* shard = LocalShard();
+        if( !shard)
+        {
+            // The thread is exiting and has released its shards
+            return;
+        }
+        std::atomic<uint64_t>& count = shard->m_Counts[BucketIndex(ticks)];
+        // Only this thread writes the shard, so no read-modify-write
+        count.store(count.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+        shard->m_Sum.store(shard->m_Sum.load(std::memory_order_relaxed) + ticks,
+            std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Read the histogram's clock
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t Now() const
+    {
+        return m_Clock == Timer::CLOCK_CYCLES ? Timer::NowCycles() : Timer::NowNs();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sum the counts of every thread
+    /// @details Safe to call while other threads record; values recorded
+    ///     during the call may or may not be included.
+    ///////////////////////////////////////////////////////////////////////////
+    Snapshot GetSnapshot() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the bucket of a value
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t BucketIndex(uint64_t value)
+    {
+        const uint64_t maxValue = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+        if(value > maxValue)
+        {
+            value = maxValue;
+        }
+        if(value < (uint64_t(1) << SUB_BUCKET_BITS))
+        {
+            return size_t(value);
+        }
+        size_t shift = HighestBit(value) - SUB_BUCKET_BITS;
+        return ((shift + 1) << SUB_BUCKET_BITS) |
+            size_t((value >> shift) & ((1 << SUB_BUCKET_BITS) - 1));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the highest value that falls in a bucket
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t BucketMax(size_t index);
+
+private:
+
+    LatencyHistogram(const LatencyHistogram&);
+    LatencyHistogram& operator=(const LatencyHistogram&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Ownership state of a shard
+    ///////////////////////////////////////////////////////////////////////////
+    enum ShardState
+    {
+        IN_USE,     ///< Owned by a live thread
+        FREE,       ///< The owning thread exited, the shard can be reused
+        DETACHED    ///< The histogram is gone, the owning thread deletes it
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief One thread's counts
+    ///////////////////////////////////////////////////////////////////////////
+    struct Shard
+    {
+        Shard();
+        std::atomic<uint64_t> m_Counts[BUCKET_COUNT];
+        std::atomic<uint64_t> m_Sum;
+        std::atomic<int> m_State;
+        Shard* m_Next;  ///< Next shard of the same histogram
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The shards owned by one thread, indexed by histogram ID
+    /// @details Trivially destructible, so it can still be read by static
+    ///     destructors that log after the thread's CacheFlusher has run.
+    ///////////////////////////////////////////////////////////////////////////
+    struct ShardCache
+    {
+        Shard** m_Shards;   ///< Array of m_Size shards, 0 where not claimed
+        size_t m_Size;
+        bool m_Exited;      ///< The shards were released, record nothing
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Releases a thread's shards for reuse when it exits
+    /// @details Constructed the first time the thread claims a shard.
+    ///////////////////////////////////////////////////////////////////////////
+    struct CacheFlusher
+    {
+        ~CacheFlusher();
+    };
+
+    static thread_local ShardCache s_ShardCache;
+    static thread_local CacheFlusher s_CacheFlusher;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the calling thread's shard
+    ///////////////////////////////////////////////////////////////////////////
+    Shard* LocalShard()
+    {
+        ShardCache& cache = s_ShardCache;
+        if(m_ID < cache.m_Size && cache.m_Shards[m_ID])
+        {
+            return cache.m_Shards[m_ID];
+        }
+        return ClaimShard();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Reuse a free shard or create one for the calling thread
+    /// @return The shard, 0 once the thread's CacheFlusher has run
+    ///////////////////////////////////////////////////////////////////////////
+    Shard* ClaimShard();
+
+    static size_t HighestBit(uint64_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long bit;
+        _BitScanReverse64(&bit, value);
+        return bit;
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    size_t m_ID;                    ///< Index in the thread shard caches, never reused
+    Timer::Clock_t m_Clock;         ///< Unit of the recorded values
+    std::atomic<Shard*> m_Shards;   ///< Every shard, newest first
+
+}; // end class LatencyHistogram
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ScopedTimer LatencyHistogram.h <Util/LatencyHistogram.h>
+/// @brief Records the time from construction to destruction
+/// @details ex.
+/// @code
+///     static LatencyHistogram& hist = MetricsRegistry::Ref().GetHistogram("x");
+///     {
+///         ScopedTimer probe(hist);
+///         ...
+///     }
+/// @endcode
+///     or NIK_LATENCY_SCOPE("x"), which does the same.
+///////////////////////////////////////////////////////////////////////////////
+class ScopedTimer
+{
+public:
+
+    explicit ScopedTimer(LatencyHistogram& histogram)
+    :
+    m_Histogram(histogram),
+    m_Start(histogram.Now())
+    {}
+
+    ~ScopedTimer()
+    {
+        m_Histogram.Record(m_Histogram.Now() - m_Start);
+    }
+
+private:
+
+    ScopedTimer(const ScopedTimer&);
+    ScopedTimer& operator=(const ScopedTimer&);
+
+    LatencyHistogram& m_Histogram;  ///< The histogram recorded into
+    uint64_t m_Start;               ///< Clock reading at construction
+
+}; // end class ScopedTimer
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class MetricsRegistry LatencyHistogram.h <Util/LatencyHistogram.h>
+/// @brief The process's latency histograms, looked up by name
+/// @details Histograms are created on first use and live until the process
+///     exits, so a reference to one can be kept in a static.  Report()
+///     writes the percentiles of what was recorded since the last report;
+///     StartReporting() has the logger thread call it periodically.
+///////////////////////////////////////////////////////////////////////////////
+class MetricsRegistry
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the registry
+    /// @details Never destroyed, so threads can record during static
+    ///     destruction.
+    ///////////////////////////////////////////////////////////////////////////
+    static MetricsRegistry& Ref();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a histogram, creating it on first use
+    /// @details Takes a lock; look the histogram up once and keep the
+    ///     reference.
+    /// @param[in] name Name of the histogram, ex. "postboard.post"
+    /// @return The histogram
+    ///////////////////////////////////////////////////////////////////////////
+    LatencyHistogram& GetHistogram(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Write the latencies recorded since the last report
+    /// @details Writes one line per histogram that recorded anything:
+    ///     name, count, p50, p99, p999 and max, in microseconds.  In a
+    ///     NIK_LOCK_STATS build, the SyncStats::Report() lines follow.
+    /// @param[out] out The text is appended to this string
+    ///////////////////////////////////////////////////////////////////////////
+    void Report(std::string& out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Have the logger thread write Report() periodically
+    /// @param[in] logger The logger to write to
+    /// @param[in] periodMs Time between reports
+    ///////////////////////////////////////////////////////////////////////////
+    void StartReporting(Logger& logger, size_t periodMs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Stop the reports started by StartReporting()
+    ///////////////////////////////////////////////////////////////////////////
+    void StopReporting(Logger& logger);
+
+private:
+
+    MetricsRegistry();
+    MetricsRegistry(const MetricsRegistry&);
+    MetricsRegistry& operator=(const MetricsRegistry&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A histogram and the snapshot taken at the last report
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        LatencyHistogram m_Histogram;
+        LatencyHistogram::Snapshot m_Reported;
+    };
+
+    Mutex* m_Lock;                          ///< Guards m_Entries
+    std::map<std::string, Entry*> m_Entries; ///< Histograms by name
+
+}; // end class MetricsRegistry
+
+} // end namespace nik
+
+#define NIK_LATENCY_CONCAT_IMPL(a, b) a##b
+#define NIK_LATENCY_CONCAT(a, b) NIK_LATENCY_CONCAT_IMPL(a, b)
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Record the time spent in the rest of the scope
+/// @details The histogram is looked up in the MetricsRegistry the first time
+///     the statement runs.  Compiles to nothing when NIK_LATENCY_PROBES is 0.
+/// @param name The histogram name, a string literal
+///////////////////////////////////////////////////////////////////////////////
+#if NIK_LATENCY_PROBES
+#define NIK_LATENCY_SCOPE(name) \
+    static ::nik::LatencyHistogram& NIK_LATENCY_CONCAT(nik_latency_hist_, __LINE__) = \
+        ::nik::MetricsRegistry::Ref().GetHistogram(name); \
+    ::nik::ScopedTimer NIK_LATENCY_CONCAT(nik_latency_probe_, __LINE__)( \
+        NIK_LATENCY_CONCAT(nik_latency_hist_, __LINE__))
+#else
+#define NIK_LATENCY_SCOPE(name) ((void)0)
+#endif
+
+#endif
+
+//----------------------End-File---------------------------------------------//
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\LogDecode.cpp
+/// @brief Command line tool that formats a binary log file into text
+/// @details Usage: LogDecode -i <binary log> [-o <text file>]
+///     Writes to standard out when no output file is given.  See
+///     Logger::BINARY_OUTPUT.
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: Rejects binary records too short for a site ID
+/// 14October2026, nik: Stops at the zero padding of a mapped segment
+///////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryLog.h"
+#include "CmdLine.h"
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+
+//----------------------Free-Function-Prototypes-----------------------------//
+bool Decode(const std::string& input, std::ostream& out);
+
+//----------------------Main-------------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+int main
+    (
+    int argc,
+    char** argv
+    )
+{
+    nik::CmdLine cmdLine(argc, argv);
+    const char* inName = cmdLine.GetArg('i');
+    if( !inName || !*inName)
+    {
+        std::cerr << "Usage: LogDecode -i <binary log> [-o <text file>]\n";
+        return 1;
+    }
+
+    std::ifstream in(inName, std::ios::in | std::ios::binary);
+    if( !in)
+    {
+        std::cerr << "Unable to open " << inName << "\n";
+        return 1;
+    }
+    std::string input((std::istreambuf_iterator<char>(in)),
+                      std::istreambuf_iterator<char>());
+
+    const char* outName = cmdLine.GetArg('o');
+    std::ofstream outFile;
+    if(outName && *outName)
+    {
+        outFile.open(outName);
+        if( !outFile)
+        {
+            std::cerr << "Unable to open " << outName << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = outFile.is_open() ? outFile : std::cout;
+
+    return Decode(input, out) ? 0 : 1;
+} // end main
+
+//----------------------Free-Function-Implementations------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Decode
+    (
+    const std::string& input,
+    std::ostream& out
+    )
+{
+    using namespace nik::BinaryLog;
+
+    if(input.compare(0, FileMagicSize, FileMagic) != 0)
+    {
+        std::cerr << "Not a binary log file\n";
+        return false;
+    }
+
+    std::map<uint32_t, SiteInfo> sites;
+    const char* pos = input.data() + FileMagicSize;
+    const char* end = input.data() + input.size();
+    RecordHeader header;
+    while(static_cast<size_t>(end - pos) >= sizeof(header))
+    {
+        memcpy(&header, pos, sizeof(header));
+        if(header.m_Kind == 0 && header.m_Size == 0)
+        {
+            // The unwritten tail of a mapped segment left by a crash
+            break;
+        }
+        const char* payload = pos + sizeof(header);
+        if(header.m_Size > static_cast<size_t>(end - payload))
+        {
+            std::cerr << "Truncated record at offset " << (pos - input.data()) << "\n";
+            return false;
+        }
+        pos = payload + header.m_Size;
+
+        switch(header.m_Kind)
+        {
+        case RECORD_TEXT:
+            out.write(payload, header.m_Size);
+            break;
+        case RECORD_SITE:
+            {
+                SiteInfo site;
+                if(ReadSite(payload, header.m_Size, site))
+                {
+                    sites[site.m_ID] = site;
+                }
+            }
+            break;
+        case RECORD_BINARY:
+            {
+                uint32_t id;
+                if(header.m_Size < sizeof(id))
+                {
+                    std::cerr << "Corrupt record at offset "
+                        << (payload - sizeof(header) - input.data()) << "\n";
+                    return false;
+                }
+                memcpy(&id, payload, sizeof(id));
+                std::map<uint32_t, SiteInfo>::const_iterator it = sites.find(id);
+                std::string text;
+                if(it == sites.end())
+                {
+                    text = "[unknown site]";
+                }
+                else
+                {
+                    Format(it->second.m_Format.c_str(), payload + sizeof(id),
+                        header.m_Size - sizeof(id), text);
+                }
+                out << text << "\n";
+            }
+            break;
+        default:
+            std::cerr << "Unknown record kind " << header.m_Kind << "\n";
+            return false;
+        }
+    }
+    return true;
+} // end Decode
+
+////////////////////////End-of-File////////////////////////////////////////////
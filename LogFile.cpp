@@ -0,0 +1,1116 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\LogFile.cpp
+/// @brief Implementation of the MappedLogFile class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LogFile.h"
+#include "BinaryLog.h"
+#include "Event.h"
+#include "Mutex.h"
+#include "ScopeLock.h"
+#include "Thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+
+#ifdef NIK_USE_WINDOWS
+#include <Windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Defined to 1 by the build when zlib is available
+#ifndef NIK_HAS_ZLIB
+#define NIK_HAS_ZLIB 0
+#endif
+
+#if NIK_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+//----------------------Constants--------------------------------------------//
+namespace {
+
+// Smallest segment that is preallocated
+const size_t Min_Segment_Bytes_glob = 64 * 1024;
+
+// Copy size when compressing a segment
+const size_t Compress_Chunk_Bytes_glob = 256 * 1024;
+
+} // end namespace
+
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief An open file and its mapping
+///////////////////////////////////////////////////////////////////////////////
+struct Region
+{
+    Region();
+
+#ifdef NIK_USE_WINDOWS
+    HANDLE m_File;
+    HANDLE m_Mapping;
+#else
+    int m_File;
+#endif
+    char* m_Base;       ///< Start of the mapping, 0 when not mapped
+    size_t m_Size;      ///< Bytes mapped
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Open or create a file for reading and writing, without mapping it
+/// @param[in] path The file
+/// @param[in] truncate Empty the file if it exists
+/// @param[out] region Gets the open file
+///////////////////////////////////////////////////////////////////////////////
+bool OpenRegion(const std::string& path, bool truncate, Region& region);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the size of an open file
+///////////////////////////////////////////////////////////////////////////////
+size_t GetFileSize(const Region& region);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocate the file to at least size bytes on disk and map them
+/// @details The blocks are allocated now so that a full disk fails here,
+///     rather than faulting on a store into the mapping.
+///////////////////////////////////////////////////////////////////////////////
+bool MapRegion(Region& region, size_t size);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Remove the mapping, the file stays open
+///////////////////////////////////////////////////////////////////////////////
+void UnmapRegion(Region& region);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Start writing back the first length bytes, without waiting
+///////////////////////////////////////////////////////////////////////////////
+void FlushRegion(const Region& region, size_t length);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Unmap, cut the file to length bytes and close it
+///////////////////////////////////////////////////////////////////////////////
+bool CloseRegion(Region& region, size_t length);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Check a file is open
+///////////////////////////////////////////////////////////////////////////////
+bool IsRegionOpen(const Region& region);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Check a file exists
+///////////////////////////////////////////////////////////////////////////////
+bool FileExists(const std::string& path);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Find the highest N of the rotated segments, <name>.N or <name>.N.gz
+/// @return The highest N, 0 if there are none
+///////////////////////////////////////////////////////////////////////////////
+size_t FindHighestSegment(const std::string& name);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the name of rotated segment N
+///////////////////////////////////////////////////////////////////////////////
+std::string SegmentName(const std::string& name, size_t index);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Find how much of a segment left by a crash holds data
+/// @details A binary log is walked record by record up to the zero padding
+///     or a torn record.  Text is cut after its last non-zero byte.
+///////////////////////////////////////////////////////////////////////////////
+size_t FindWrittenLength(const char* data, size_t size);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Gzip a file to <path>.gz and remove it
+/// @return @arg true - The file was compressed
+///         @arg false - The file is left as it was
+///////////////////////////////////////////////////////////////////////////////
+bool CompressFile(const std::string& path);
+
+} // end namespace
+
+namespace nik {
+
+//----------------------FileImpl-Declaration---------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+/// @class MappedLogFile::FileImpl LogFile.cpp <Util\LogFile.cpp>
+/// @brief Implements MappedLogFile
+/// @details Rotated segments that are compressed are handed to a background
+///     thread, which also deletes the old segments after compressing, so
+///     a segment is never deleted while it is being compressed.
+///////////////////////////////////////////////////////////////////////////////
+class MappedLogFile::FileImpl
+{
+public:
+
+    FileImpl();
+    ~FileImpl();
+
+    bool Open(const char* const fileName, const LogFileOptions& options,
+        const std::string& header);
+    bool Close();
+    bool IsOpen() const { return IsRegionOpen(m_Region); }
+    bool Write(const char* data, size_t len);
+    void Flush();
+    bool RotateDue() const;
+    bool Rotate();
+    size_t GetSize() const { return m_Used; }
+
+private:
+
+    typedef std::chrono::steady_clock Clock_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Work for the background thread after a rotation
+    ///////////////////////////////////////////////////////////////////////////
+    struct Job
+    {
+        std::string m_Segment;  ///< The rotated segment to compress
+        std::string m_Expired;  ///< Segment to delete after, may be empty
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Open the active segment and map it
+    /// @param[in] keep Bytes of the existing file to keep, 0 for a new
+    ///     segment starting with the header
+    ///////////////////////////////////////////////////////////////////////////
+    bool OpenSegment(size_t keep);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Grow the mapping to fit needed more bytes
+    ///////////////////////////////////////////////////////////////////////////
+    bool Grow(size_t needed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Rename the closed active segment to the next rotated name
+    /// @details Then compresses it and deletes the expired segment.
+    /// @return @arg true - The segment was renamed
+    ///         @arg false - The segment is still the active file
+    ///////////////////////////////////////////////////////////////////////////
+    bool Retire();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Rotate an active segment left by an earlier run
+    ///////////////////////////////////////////////////////////////////////////
+    void Recover();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Delete a rotated segment, compressed or not
+    ///////////////////////////////////////////////////////////////////////////
+    static void RemoveSegment(const std::string& segment);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Queue a job for the background thread, starting it if needed
+    ///////////////////////////////////////////////////////////////////////////
+    void Post(const Job& job);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs the jobs until the object is destroyed
+    ///////////////////////////////////////////////////////////////////////////
+    static ThreadFuncReturnType_t NIK_API CompressThreadFunc(ThreadFuncArgType_t file);
+
+    std::string m_Name;             ///< The active segment
+    LogFileOptions m_Options;
+    std::string m_Header;           ///< Written at the start of each segment
+    Region m_Region;                ///< The active segment
+    size_t m_Used;                  ///< Bytes written to the active segment
+    Clock_t::time_point m_OpenedAt; ///< When the active segment was opened
+    size_t m_NextIndex;             ///< N of the next rotated segment
+
+    Mutex* m_JobLock;               ///< Guards m_Jobs
+    std::deque<Job> m_Jobs;         ///< Waiting for the background thread
+    Event* m_WakeEvent;             ///< Signaled when a job is queued
+    Event* m_StoppedEvent;          ///< Signaled when the thread exits
+    Thread* m_Thread;               ///< The background thread, 0 until used
+    std::atomic<bool> m_Continue;   ///< Cleared to stop the thread
+
+}; // end class MappedLogFile::FileImpl
+
+//----------------------MappedLogFile-Implementation-------------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+MappedLogFile::MappedLogFile()
+:
+m_Impl(new FileImpl())
+{
+} // end MappedLogFile::MappedLogFile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+MappedLogFile::~MappedLogFile()
+{
+    delete m_Impl;
+} // end MappedLogFile::~MappedLogFile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::Open
+    (
+    const char* const fileName,
+    const LogFileOptions& options,
+    const std::string& header
+    )
+{
+    return m_Impl->Open(fileName, options, header);
+} // end MappedLogFile::Open
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::Close()
+{
+    return m_Impl->Close();
+} // end MappedLogFile::Close
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::IsOpen() const
+{
+    return m_Impl->IsOpen();
+} // end MappedLogFile::IsOpen
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::Write
+    (
+    const char* data,
+    size_t len
+    )
+{
+    return m_Impl->Write(data, len);
+} // end MappedLogFile::Write
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MappedLogFile::Flush()
+{
+    m_Impl->Flush();
+} // end MappedLogFile::Flush
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::RotateDue() const
+{
+    return m_Impl->RotateDue();
+} // end MappedLogFile::RotateDue
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::Rotate()
+{
+    return m_Impl->Rotate();
+} // end MappedLogFile::Rotate
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t MappedLogFile::GetSize() const
+{
+    return m_Impl->GetSize();
+} // end MappedLogFile::GetSize
+
+//----------------------FileImpl-Implementation------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+MappedLogFile::FileImpl::FileImpl()
+:
+m_Used(0),
+m_NextIndex(1),
+m_JobLock(Mutex::Create("logfile.jobs")),
+m_WakeEvent(0),
+m_StoppedEvent(0),
+m_Thread(0),
+m_Continue(false)
+{
+} // end MappedLogFile::FileImpl::FileImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+MappedLogFile::FileImpl::~FileImpl()
+{
+    Close();
+    if(m_Thread)
+    {
+        // The thread finishes the queued jobs before it stops
+        m_Continue = false;
+        m_WakeEvent->SetEvent();
+        m_StoppedEvent->WaitForEvent(Event::FOREVER);
+        delete m_Thread;
+        delete m_WakeEvent;
+        delete m_StoppedEvent;
+    }
+    delete m_JobLock;
+} // end MappedLogFile::FileImpl::~FileImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::Open
+    (
+    const char* const fileName,
+    const LogFileOptions& options,
+    const std::string& header
+    )
+{
+    Close();
+    m_Name = fileName;
+    m_Options = options;
+    m_Header = header;
+    m_NextIndex = FindHighestSegment(m_Name) + 1;
+    if(FileExists(m_Name))
+    {
+        Recover();
+    }
+    return OpenSegment(0);
+} // end MappedLogFile::FileImpl::Open
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::Close()
+{
+    if( !IsOpen())
+    {
+        return false;
+    }
+    bool closed = CloseRegion(m_Region, m_Used);
+    m_Used = 0;
+    return closed;
+} // end MappedLogFile::FileImpl::Close
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::Write
+    (
+    const char* data,
+    size_t len
+    )
+{
+    if( !IsOpen())
+    {
+        return false;
+    }
+    if(len > m_Region.m_Size - m_Used && !Grow(len))
+    {
+        return false;
+    }
+    memcpy(m_Region.m_Base + m_Used, data, len);
+    m_Used += len;
+    return true;
+} // end MappedLogFile::FileImpl::Write
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MappedLogFile::FileImpl::Flush()
+{
+    if(IsOpen() && m_Used)
+    {
+        FlushRegion(m_Region, m_Used);
+    }
+} // end MappedLogFile::FileImpl::Flush
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::RotateDue() const
+{
+    if( !IsOpen() || m_Used <= m_Header.size())
+    {
+        return false;
+    }
+    if(m_Options.m_SegmentBytes && m_Used >= m_Options.m_SegmentBytes)
+    {
+        return true;
+    }
+    return m_Options.m_RotateMs &&
+        Clock_t::now() - m_OpenedAt >= std::chrono::milliseconds(m_Options.m_RotateMs);
+} // end MappedLogFile::FileImpl::RotateDue
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::Rotate()
+{
+    if( !IsOpen())
+    {
+        return false;
+    }
+    size_t used = m_Used;
+    Close();
+    // If the rename fails keep appending to the same file rather than
+    // losing it
+    return OpenSegment(Retire() ? 0 : used);
+} // end MappedLogFile::FileImpl::Rotate
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::OpenSegment
+    (
+    size_t keep
+    )
+{
+    if( !OpenRegion(m_Name, keep == 0, m_Region))
+    {
+        return false;
+    }
+    size_t size = std::max(m_Options.m_SegmentBytes, Min_Segment_Bytes_glob);
+    size = std::max(size, keep + m_Header.size() + Min_Segment_Bytes_glob);
+    if( !MapRegion(m_Region, size))
+    {
+        CloseRegion(m_Region, keep);
+        return false;
+    }
+    m_Used = keep;
+    if(keep == 0)
+    {
+        memcpy(m_Region.m_Base, m_Header.data(), m_Header.size());
+        m_Used = m_Header.size();
+    }
+    m_OpenedAt = Clock_t::now();
+    return true;
+} // end MappedLogFile::FileImpl::OpenSegment
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::Grow
+    (
+    size_t needed
+    )
+{
+    // Grow by a quarter segment at a time so a burst does not remap often
+    size_t step = std::max(m_Options.m_SegmentBytes / 4, Min_Segment_Bytes_glob);
+    size_t size = m_Used + std::max(needed, step);
+    UnmapRegion(m_Region);
+    if(MapRegion(m_Region, size))
+    {
+        return true;
+    }
+    // Keep what has been written so far
+    if( !MapRegion(m_Region, m_Used + (m_Used ? 0 : 1)))
+    {
+        CloseRegion(m_Region, m_Used);
+        m_Used = 0;
+    }
+    return false;
+} // end MappedLogFile::FileImpl::Grow
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MappedLogFile::FileImpl::Retire()
+{
+    std::string segment = SegmentName(m_Name, m_NextIndex);
+    if(std::rename(m_Name.c_str(), segment.c_str()) != 0)
+    {
+        return false;
+    }
+
+    Job job;
+    job.m_Segment = segment;
+    if(m_Options.m_KeepSegments && m_NextIndex > m_Options.m_KeepSegments)
+    {
+        job.m_Expired = SegmentName(m_Name, m_NextIndex - m_Options.m_KeepSegments);
+    }
+    ++m_NextIndex;
+
+    if(NIK_HAS_ZLIB && m_Options.m_Compress)
+    {
+        Post(job);
+    }
+    else if( !job.m_Expired.empty())
+    {
+        RemoveSegment(job.m_Expired);
+    }
+    return true;
+} // end MappedLogFile::FileImpl::Retire
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MappedLogFile::FileImpl::Recover()
+{
+    Region region;
+    if( !OpenRegion(m_Name, false, region))
+    {
+        return;
+    }
+    size_t size = GetFileSize(region);
+    size_t length = size;
+    if(size && MapRegion(region, size))
+    {
+        length = FindWrittenLength(region.m_Base, size);
+    }
+    CloseRegion(region, length);
+
+    if(length <= m_Header.size() &&
+        (length == 0 || FindWrittenLength(m_Header.data(), m_Header.size()) == length))
+    {
+        // Nothing was logged to it
+        std::remove(m_Name.c_str());
+        return;
+    }
+    Retire();
+} // end MappedLogFile::FileImpl::Recover
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MappedLogFile::FileImpl::RemoveSegment
+    (
+    const std::string& segment
+    )
+{
+    std::remove(segment.c_str());
+    std::remove((segment + ".gz").c_str());
+} // end MappedLogFile::FileImpl::RemoveSegment
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void MappedLogFile::FileImpl::Post
+    (
+    const Job& job
+    )
+{
+    {
+        ScopeLock lock(m_JobLock);
+        m_Jobs.push_back(job);
+    }
+    if( !m_Thread)
+    {
+        m_WakeEvent = Event::Create();
+        m_StoppedEvent = Event::Create();
+        if( !m_WakeEvent || !m_StoppedEvent)
+        {
+            assert(0);
+            throw Error("Error: MappedLogFile->Event::Create failed");
+        }
+        m_Continue = true;
+        m_Thread = Thread::Create();
+        assert(m_Thread);
+        m_Thread->SetName("nik-logfile");
+        m_Thread->StartThread(CompressThreadFunc, this);
+    }
+    m_WakeEvent->SetEvent();
+} // end MappedLogFile::FileImpl::Post
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+ThreadFuncReturnType_t NIK_API MappedLogFile::FileImpl::CompressThreadFunc
+    (
+    ThreadFuncArgType_t file
+    )
+{
+    FileImpl* impl = static_cast<FileImpl*>(file);
+    for(;;)
+    {
+        // Clear before looking so a job posted after the check wakes the wait
+        impl->m_WakeEvent->ClearEvent();
+        Job job;
+        bool found = false;
+        {
+            ScopeLock lock(impl->m_JobLock);
+            if( !impl->m_Jobs.empty())
+            {
+                job = impl->m_Jobs.front();
+                impl->m_Jobs.pop_front();
+                found = true;
+            }
+        }
+        if(found)
+        {
+            CompressFile(job.m_Segment);
+            if( !job.m_Expired.empty())
+            {
+                RemoveSegment(job.m_Expired);
+            }
+            continue;
+        }
+        if( !impl->m_Continue)
+        {
+            break;
+        }
+        impl->m_WakeEvent->WaitForEvent(Event::FOREVER);
+    }
+    impl->m_StoppedEvent->SetEvent();
+    return 0;
+} // end MappedLogFile::FileImpl::CompressThreadFunc
+
+} // end namespace nik
+
+//----------------------Free-Function-Implementations------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Region::Region()
+:
+#ifdef NIK_USE_WINDOWS
+m_File(INVALID_HANDLE_VALUE),
+m_Mapping(0),
+#else
+m_File(-1),
+#endif
+m_Base(0),
+m_Size(0)
+{
+} // end Region::Region
+
+#ifdef NIK_USE_WINDOWS
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool OpenRegion
+    (
+    const std::string& path,
+    bool truncate,
+    Region& region
+    )
+{
+    // Readers may open and rename the file while it is being written
+    region.m_File = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_DELETE, 0,
+        truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+    return region.m_File != INVALID_HANDLE_VALUE;
+} // end OpenRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t GetFileSize
+    (
+    const Region& region
+    )
+{
+    LARGE_INTEGER size;
+    return GetFileSizeEx(region.m_File, &size) ? static_cast<size_t>(size.QuadPart) : 0;
+} // end GetFileSize
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MapRegion
+    (
+    Region& region,
+    size_t size
+    )
+{
+    if(GetFileSize(region) < size)
+    {
+        LARGE_INTEGER end;
+        end.QuadPart = static_cast<LONGLONG>(size);
+        if( !SetFilePointerEx(region.m_File, end, 0, FILE_BEGIN) ||
+            !SetEndOfFile(region.m_File))
+        {
+            return false;
+        }
+    }
+    unsigned long long size64 = size;
+    region.m_Mapping = CreateFileMappingA(region.m_File, 0, PAGE_READWRITE,
+        static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), 0);
+    if( !region.m_Mapping)
+    {
+        return false;
+    }
+    region.m_Base = static_cast<char*>(MapViewOfFile(region.m_Mapping,
+        FILE_MAP_WRITE, 0, 0, size));
+    if( !region.m_Base)
+    {
+        CloseHandle(region.m_Mapping);
+        region.m_Mapping = 0;
+        return false;
+    }
+    region.m_Size = size;
+    return true;
+} // end MapRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void UnmapRegion
+    (
+    Region& region
+    )
+{
+    if(region.m_Base)
+    {
+        UnmapViewOfFile(region.m_Base);
+        CloseHandle(region.m_Mapping);
+    }
+    region.m_Mapping = 0;
+    region.m_Base = 0;
+    region.m_Size = 0;
+} // end UnmapRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void FlushRegion
+    (
+    const Region& region,
+    size_t length
+    )
+{
+    // Starts the writes without waiting for the disk
+    FlushViewOfFile(region.m_Base, length);
+} // end FlushRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool CloseRegion
+    (
+    Region& region,
+    size_t length
+    )
+{
+    UnmapRegion(region);
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(length);
+    bool cut = SetFilePointerEx(region.m_File, end, 0, FILE_BEGIN) &&
+        SetEndOfFile(region.m_File);
+    CloseHandle(region.m_File);
+    region.m_File = INVALID_HANDLE_VALUE;
+    return cut;
+} // end CloseRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool IsRegionOpen
+    (
+    const Region& region
+    )
+{
+    return region.m_File != INVALID_HANDLE_VALUE;
+} // end IsRegionOpen
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool FileExists
+    (
+    const std::string& path
+    )
+{
+    return GetFileAttributesA(path.c_str()) != INVALID_FILE_ATTRIBUTES;
+} // end FileExists
+
+#else
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool OpenRegion
+    (
+    const std::string& path,
+    bool truncate,
+    Region& region
+    )
+{
+    int flags = O_RDWR | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0);
+    region.m_File = ::open(path.c_str(), flags, 0644);
+    return region.m_File >= 0;
+} // end OpenRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t GetFileSize
+    (
+    const Region& region
+    )
+{
+    struct stat info;
+    return fstat(region.m_File, &info) == 0 ? static_cast<size_t>(info.st_size) : 0;
+} // end GetFileSize
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool MapRegion
+    (
+    Region& region,
+    size_t size
+    )
+{
+#ifdef __APPLE__
+    // No posix_fallocate, the blocks are allocated as the pages are written
+    if(GetFileSize(region) < size && ftruncate(region.m_File, static_cast<off_t>(size)) != 0)
+    {
+        return false;
+    }
+#else
+    if(posix_fallocate(region.m_File, 0, static_cast<off_t>(size)) != 0)
+    {
+        return false;
+    }
+#endif
+    void* base = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, region.m_File, 0);
+    if(base == MAP_FAILED)
+    {
+        return false;
+    }
+    region.m_Base = static_cast<char*>(base);
+    region.m_Size = size;
+    return true;
+} // end MapRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void UnmapRegion
+    (
+    Region& region
+    )
+{
+    if(region.m_Base)
+    {
+        munmap(region.m_Base, region.m_Size);
+    }
+    region.m_Base = 0;
+    region.m_Size = 0;
+} // end UnmapRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void FlushRegion
+    (
+    const Region& region,
+    size_t length
+    )
+{
+    // Starts the writes without waiting for the disk
+    msync(region.m_Base, length, MS_ASYNC);
+} // end FlushRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool CloseRegion
+    (
+    Region& region,
+    size_t length
+    )
+{
+    UnmapRegion(region);
+    bool cut = ftruncate(region.m_File, static_cast<off_t>(length)) == 0;
+    ::close(region.m_File);
+    region.m_File = -1;
+    return cut;
+} // end CloseRegion
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool IsRegionOpen
+    (
+    const Region& region
+    )
+{
+    return region.m_File >= 0;
+} // end IsRegionOpen
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool FileExists
+    (
+    const std::string& path
+    )
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+} // end FileExists
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t FindHighestSegment
+    (
+    const std::string& name
+    )
+{
+    std::string::size_type slash = name.find_last_of("/\\");
+    std::string dir = slash == std::string::npos ? std::string(".") : name.substr(0, slash + 1);
+    std::string prefix = (slash == std::string::npos ? name : name.substr(slash + 1)) + ".";
+
+    // Collect the names in the directory
+    std::deque<std::string> entries;
+#ifdef NIK_USE_WINDOWS
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA((dir + (slash == std::string::npos ? "\\" : "") +
+        prefix + "*").c_str(), &data);
+    if(find != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            entries.push_back(data.cFileName);
+        } while(FindNextFileA(find, &data));
+        FindClose(find);
+    }
+#else
+    if(DIR* listing = opendir(dir.c_str()))
+    {
+        while(struct dirent* entry = readdir(listing))
+        {
+            entries.push_back(entry->d_name);
+        }
+        closedir(listing);
+    }
+#endif
+
+    // Keep those named <prefix>N or <prefix>N.gz
+    size_t highest = 0;
+    for(size_t i = 0; i < entries.size(); ++i)
+    {
+        const std::string& entry = entries[i];
+        if(entry.compare(0, prefix.size(), prefix) != 0)
+        {
+            continue;
+        }
+        std::string::size_type end = entry.find_first_not_of("0123456789", prefix.size());
+        if(end == prefix.size() ||
+            (end != std::string::npos && entry.compare(end, std::string::npos, ".gz") != 0))
+        {
+            continue;
+        }
+        size_t index = strtoul(entry.c_str() + prefix.size(), 0, 10);
+        highest = std::max(highest, index);
+    }
+    return highest;
+} // end FindHighestSegment
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+std::string SegmentName
+    (
+    const std::string& name,
+    size_t index
+    )
+{
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%lu", static_cast<unsigned long>(index));
+    return name + suffix;
+} // end SegmentName
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t FindWrittenLength
+    (
+    const char* data,
+    size_t size
+    )
+{
+    using namespace nik::BinaryLog;
+
+    if(size >= FileMagicSize && memcmp(data, FileMagic, FileMagicSize) == 0)
+    {
+        // Records are never empty, so a zero header is the padding
+        size_t pos = FileMagicSize;
+        RecordHeader header;
+        while(size - pos >= sizeof(header))
+        {
+            memcpy(&header, data + pos, sizeof(header));
+            if(header.m_Kind == 0 || header.m_Size > size - pos - sizeof(header))
+            {
+                break;
+            }
+            pos += sizeof(header) + header.m_Size;
+        }
+        return pos;
+    }
+
+    while(size && data[size - 1] == 0)
+    {
+        --size;
+    }
+    return size;
+} // end FindWrittenLength
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool CompressFile
+    (
+    const std::string& path
+    )
+{
+#if NIK_HAS_ZLIB
+    FILE* in = fopen(path.c_str(), "rb");
+    if( !in)
+    {
+        return false;
+    }
+    std::string target = path + ".gz";
+    gzFile out = gzopen(target.c_str(), "wb");
+    if( !out)
+    {
+        fclose(in);
+        return false;
+    }
+
+    std::string chunk(Compress_Chunk_Bytes_glob, '\0');
+    bool success = true;
+    size_t read;
+    while(success && (read = fread(&chunk[0], 1, chunk.size(), in)) > 0)
+    {
+        success = gzwrite(out, chunk.data(), static_cast<unsigned>(read)) == static_cast<int>(read);
+    }
+    success = !ferror(in) && success;
+    fclose(in);
+    success = gzclose(out) == Z_OK && success;
+
+    if( !success)
+    {
+        std::remove(target.c_str());
+        return false;
+    }
+    std::remove(path.c_str());
+    return true;
+#else
+    (void)path;
+    (void)Compress_Chunk_Bytes_glob;
+    return false;
+#endif
+} // end CompressFile
+
+} // end namespace
+
+//----------------------End-File---------------------------------------------//
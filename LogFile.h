@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\LogFile.h
+/// @brief Declaration of the MappedLogFile class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_LOG_FILE_HEADER
+#define NIK_LOG_FILE_HEADER
+
+#include <Util/Utility.h>
+#include <cstddef>
+#include <string>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief How a MappedLogFile is sized, rotated and kept
+///////////////////////////////////////////////////////////////////////////////
+struct LogFileOptions
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details 64MB segments, rotated by size only, every segment kept and
+    ///     none compressed.
+    ///////////////////////////////////////////////////////////////////////////
+    LogFileOptions()
+    :
+    m_SegmentBytes(64 * 1024 * 1024),
+    m_RotateMs(0),
+    m_KeepSegments(0),
+    m_Compress(false)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The size each segment is preallocated to, and rotated at
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_SegmentBytes;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Rotate a segment this long after it was opened, 0 for never
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_RotateMs;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The number of rotated segments to keep, 0 to keep them all
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_KeepSegments;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gzip rotated segments on a background thread
+    /// @note Ignored when the library is built without zlib
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Compress;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class MappedLogFile LogFile.h <Util/LogFile.h>
+/// @brief Append only file written through a memory map, in segments
+/// @details The active segment is the file with the given name.  It is
+///     preallocated to LogFileOptions::m_SegmentBytes on disk and mapped, so
+///     Write() is a copy into the page cache with no system call.  The pages
+///     belong to the file rather than the process, so everything written is
+///     kept if the process crashes; Flush() only schedules the pages to be
+///     written back.  Power loss is not covered.
+///
+///     When RotateDue() the caller calls Rotate(): the active segment is
+///     cut to the bytes written and renamed to <name>.1, <name>.2, ... with
+///     the number one past the highest already on disk, and a new active
+///     segment is opened.  Rotated segments are gzipped to <name>.N.gz on a
+///     background thread when asked, and the oldest are deleted beyond
+///     LogFileOptions::m_KeepSegments.
+///
+///     Open() rotates an active segment left by an earlier run.  One left
+///     by a crash still has its preallocated tail, so it is first cut after
+///     its last whole record, or its last non-zero byte for text.
+/// @attention Only one thread may use the object at a time.
+///////////////////////////////////////////////////////////////////////////////
+class MappedLogFile
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Nothing is open until Open() is called.
+    ///////////////////////////////////////////////////////////////////////////
+    MappedLogFile();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Closes the file and waits for the background compression.
+    ///////////////////////////////////////////////////////////////////////////
+    ~MappedLogFile();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Opens the active segment
+    /// @details Closes any file already open.
+    /// @param[in] fileName The name of the active segment
+    /// @param[in] options The sizes and rotation
+    /// @param[in] header Bytes written at the start of every segment, ex.
+    ///     the magic of a binary log
+    /// @return @arg true - The segment is open and mapped
+    ///         @arg false - The file could not be created or mapped
+    ///////////////////////////////////////////////////////////////////////////
+    bool Open(const char* const fileName, const LogFileOptions& options,
+        const std::string& header = std::string());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Closes the active segment
+    /// @details The file is cut to the bytes written.  It is not rotated.
+    /// @return @arg true - The file was closed
+    ///         @arg false - No file was open
+    ///////////////////////////////////////////////////////////////////////////
+    bool Close();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Check a segment is open
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsOpen() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Appends to the active segment
+    /// @details The segment grows when the data does not fit, so a write is
+    ///     never split across segments.
+    /// @param[in] data The bytes to write
+    /// @param[in] len The number of bytes
+    /// @return @arg true - The bytes were written
+    ///         @arg false - No file is open, or the segment could not grow
+    ///////////////////////////////////////////////////////////////////////////
+    bool Write(const char* data, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Schedules the written pages to be written back to disk
+    /// @details Does not wait for the disk.
+    ///////////////////////////////////////////////////////////////////////////
+    void Flush();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Check the active segment is full or old enough to rotate
+    /// @details A segment holding only its header is never due.
+    ///////////////////////////////////////////////////////////////////////////
+    bool RotateDue() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Rotates the active segment and opens the next one
+    /// @return @arg true - A new segment is open
+    ///         @arg false - No file is open, or the new segment failed
+    ///////////////////////////////////////////////////////////////////////////
+    bool Rotate();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the bytes written to the active segment, with its header
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetSize() const;
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy construction has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    MappedLogFile(const MappedLogFile&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    MappedLogFile& operator=(const MappedLogFile&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The implementation class
+    ///////////////////////////////////////////////////////////////////////////
+    class FileImpl;
+    FileImpl* m_Impl;
+
+}; // end class MappedLogFile
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
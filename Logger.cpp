@@ -4,14 +4,36 @@
 /// @internal
 ///
 /// 19March2010, nik: initial
+/// 14October2026, nik: Per-thread ring buffers replace the shared stream lock
+/// 14October2026, nik: Event driven logger thread with flush thresholds
+/// 14October2026, nik: Added log levels
+/// 14October2026, nik: Added deferred-format records and binary output
+/// 14October2026, nik: Added periodic reports and latency probes
+/// 14October2026, nik: nik::log is a singleton destroyed last
+/// 14October2026, nik: TLogger uses GetLog()
+/// 14October2026, nik: Added memory-mapped rotating output
 ///////////////////////////////////////////////////////////////////////////////
 #include "Logger.h"
-#include "ScopeLock.h"
-#include "Mutex.h"
+#include "RingBuffer.h"
 #include "Thread.h"
+#include "Event.h"
+#include "Mutex.h"
+#include "LatencyHistogram.h"
+#include "Singleton.h"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
 #include <cassert>
+#include <algorithm>
 //----------------------Constants--------------------------------------------//
-const size_t Wait_Time_glob = 10; // ms
+const size_t Default_Thread_Buffer_Size_glob = 64 * 1024; // bytes
+const size_t Min_Thread_Buffer_Size_glob = 1024; // bytes
+static_assert(Min_Thread_Buffer_Size_glob >= nik::LogArgWriter::MaxArgBytes +
+    sizeof(nik::BinaryLog::RecordHeader) + sizeof(uint32_t),
+    "The smallest thread buffer must hold the largest deferred-format record");
+const size_t Default_Flush_Bytes_glob = 16 * 1024; // bytes
+const size_t Default_Flush_Time_glob = 100; // ms
 // Error strings
 const char* const Error_Block_cstr = 
 "=================================================";
@@ -20,7 +42,79 @@ const char* const Error_Block_cstr =
 
 namespace nik {
 //----------------------Log-Object-Definition--------------------------------//
-Logger log;
+Logger& log = GetLog();
+
+//----------------------ThreadBuffer-Declaration-----------------------------//
+///////////////////////////////////////////////////////////////////////////////
+/// @class Logger::ThreadBuffer Logger.cpp <Util\Logger.cpp>
+/// @brief The stream and ring buffer owned by one producer thread
+/// @details The owning thread formats into the stream and commits the
+///     formatted text into the ring buffer.  The logger thread is the only
+///     reader of the ring buffer.  When the owning thread exits, the buffer
+///     is marked free so that the next new thread can reuse it.
+///////////////////////////////////////////////////////////////////////////////
+class Logger::ThreadBuffer
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Ownership state of the buffer
+    ///////////////////////////////////////////////////////////////////////////
+    enum State
+    {
+        IN_USE,     ///< Owned by a live thread
+        COMMITTING, ///< The exiting owner is handing over its last text
+        FREE,       ///< The owning thread exited, the buffer can be reused
+        DETACHED    ///< The logger is gone, the owning thread deletes it
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] owner The logger implementation this buffer belongs to
+    /// @param[in] size The size of the ring buffer in bytes
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadBuffer(LogImpl* owner, size_t size)
+    :
+    m_Ring(size),
+    m_Owner(owner),
+    m_State(IN_USE),
+    m_Next(0),
+    m_ThreadNext(0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Stream the owning thread formats into
+    ///////////////////////////////////////////////////////////////////////////
+    std::ostringstream m_Os;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Formatted text waiting for the logger thread
+    ///////////////////////////////////////////////////////////////////////////
+    RingBuffer m_Ring;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The logger implementation this buffer belongs to
+    ///////////////////////////////////////////////////////////////////////////
+    LogImpl* m_Owner;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Ownership state, see State
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<int> m_State;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Next buffer in the logger's list of buffers
+    /// @note Set before the buffer is published and never changed after
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadBuffer* m_Next;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Next buffer owned by the same thread
+    /// @note Only accessed by the owning thread
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadBuffer* m_ThreadNext;
+
+}; // end class Logger::ThreadBuffer
 
 //----------------------LogImpl-Declaration----------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
@@ -41,14 +135,14 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Destructor
-    /// @note Cleans up the thread and mutex resources
+    /// @note Cleans up the thread and buffer resources
     ///////////////////////////////////////////////////////////////////////////
     ~LogImpl();
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Starts the logger thread
     /// @attention Multiple calls to this function are ignored.
-    /// @note Sets up the thread and mutex resources
+    /// @note Sets up the thread resources
     ///////////////////////////////////////////////////////////////////////////
     void StartThread();
 
@@ -57,10 +151,12 @@ public:
     /// @attention If a file was already open, the previous file is closed 
     ///     before opening the new file.
     /// @param[in] fileName The name of the file
+    /// @param[in] options Write through a MappedLogFile with these options,
+    ///     0 for a stream
     /// @return @arg true - Success
     ///         @arg false - Failure
     ///////////////////////////////////////////////////////////////////////////
-    bool OpenFile(const char* const fileName);
+    bool OpenFile(const char* const fileName, const LogFileOptions* const options = 0);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Close the current output file
@@ -71,29 +167,95 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Force a write of the buffered output to file
+    /// @attention Must only be called when the logger thread is not running
     /// @return @arg true - Success
     ///         @arg false - Failure
     ///////////////////////////////////////////////////////////////////////////
     bool ForceWrite();
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Attempt to write buffered output to file
-    /// @details Calling this function will attempt to get the write lock
-    ///     to output what is in the given output stream.  If the wait for the
-    ///     lock times out, the data is not written and the function returns
-    ///     false.
-    /// @param[in] os The output to write
-    /// @return @arg true - The data was written
-    ///         @arg false - The data was not written
+    /// @brief Writes the output to the open file
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteFile(const std::string& out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Flushes the open file
+    /// @details For a mapped file this only schedules the pages to be written
+    ///     back, what has been written already survives a crash.
+    ///////////////////////////////////////////////////////////////////////////
+    void FlushFile();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Rotates a mapped file when it is due
+    /// @details The sites are described again in the new binary segment.
+    /// @attention Called by the logger thread between passes
+    ///////////////////////////////////////////////////////////////////////////
+    void RotateFile();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the calling thread's buffer
+    /// @details Looks up the buffer in the thread's cache.  If the thread has
+    ///     not logged through this object before, a free buffer is reused or
+    ///     a new one is created.
+    /// @return The calling thread's buffer
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadBuffer* GetThreadBuffer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Moves the text in the buffer's stream into its ring buffer
+    /// @details If the ring buffer is full and the logger thread is running,
+    ///     this function wakes the logger thread and yields until it makes
+    ///     room.  If the logger thread is not running, the text that does not
+    ///     fit is kept in the stream for the next call.
+    /// @param[in] buffer The calling thread's buffer
+    /// @param[in] immediate Wake the logger thread and write to disk now
+    /// @return @arg true - All of the text was committed
+    ///         @arg false - Some of the text is still in the stream
+    ///////////////////////////////////////////////////////////////////////////
+    bool Commit(ThreadBuffer* buffer, bool immediate);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Commits an encoded statement into the buffer's ring buffer
+    /// @details Any unflushed text in the buffer's stream is committed 
+    ///     first.  Waits for room the same way as Commit().
+    /// @param[in] buffer The calling thread's buffer
+    /// @param[in] site The static site of the statement
+    /// @param[in] args The encoded arguments
+    /// @param[in] len The number of bytes of encoded arguments
+    /// @return @arg true - The record was committed
+    ///         @arg false - The record was dropped
+    ///////////////////////////////////////////////////////////////////////////
+    bool CommitRecord(ThreadBuffer* buffer, const LogSite& site, 
+        const char* args, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the format used for the next file that is opened
+    /// @param[in] format The output format
+    ///////////////////////////////////////////////////////////////////////////
+    void SetOutputFormat(OutputFormat format);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the ring buffer size for new thread buffers
+    /// @param[in] bytes The size in bytes
+    ///////////////////////////////////////////////////////////////////////////
+    void SetThreadBufferSize(size_t bytes);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc Logger::SetFlushPolicy(size_t, size_t)
     ///////////////////////////////////////////////////////////////////////////
-    bool Write(const std::ostringstream& os);
+    void SetFlushPolicy(size_t flushBytes, size_t flushMs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc Logger::SetReporter(Reporter_t&&, size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    void SetReporter(Reporter_t&& reporter, size_t periodMs);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Thread function to call
     /// @details This is the function that is passed to the thread to call.
-    ///     The function continually attempts to get the buffered output and
-    ///     write it to file.  The function returns when the continue flag
-    ///     is set to false in the Logger object.
+    ///     The function continually drains the thread buffers and writes
+    ///     them to file.  The function returns when the continue flag
+    ///     is set to false.
     /// @param[in] logger Pointer to the LogImpl object
     /// @return Always 0
     ///////////////////////////////////////////////////////////////////////////
@@ -101,6 +263,103 @@ public:
 
 private:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Claims a free buffer or creates a new one
+    /// @return A buffer in the IN_USE state
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadBuffer* ClaimBuffer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes one record into the buffer's ring buffer
+    /// @details If the ring buffer is full and the logger thread is running,
+    ///     this function wakes the logger thread and yields until it makes
+    ///     room.
+    /// @param[in] buffer The calling thread's buffer
+    /// @param[in] head The header of the record
+    /// @param[in] headLen The size of the header
+    /// @param[in] data The payload
+    /// @param[in] len The size of the payload
+    /// @return @arg true - The record was written
+    ///         @arg false - The logger thread is not running and there
+    ///             was no room
+    ///////////////////////////////////////////////////////////////////////////
+    bool WriteRecord(ThreadBuffer* buffer, const void* head, size_t headLen,
+        const void* data, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Reads everything in the thread buffers into the string
+    /// @details The output is written in the current output format.  Each 
+    ///     ring buffer only holds whole records.
+    /// @param[out] out The string to append to
+    ///////////////////////////////////////////////////////////////////////////
+    void Drain(std::string& out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Converts the records read from a ring buffer into output
+    /// @param[in] records The records
+    /// @param[out] out The string to append to
+    ///////////////////////////////////////////////////////////////////////////
+    void Process(const std::string& records, std::string& out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Appends the reporter's text in the current output format
+    /// @param[out] out The string to append to
+    ///////////////////////////////////////////////////////////////////////////
+    void Report(std::string& out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Looks up a site, caching it for the logger thread
+    /// @param[in] id The ID of the site
+    /// @return The site, or 0 if it is not registered
+    ///////////////////////////////////////////////////////////////////////////
+    const LogSite* GetSite(uint32_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if any thread buffer has text waiting
+    /// @return @arg true - At least one ring buffer is not empty
+    ///         @arg false - All ring buffers are empty
+    ///////////////////////////////////////////////////////////////////////////
+    bool HasPending() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wakes the logger thread if it is asleep
+    /// @details Called by producers after committing text.  The event is only
+    ///     signaled when the logger thread is waiting and the commit crosses
+    ///     a threshold, so most commits do not make a system call.
+    /// @param[in] pending The bytes waiting in the producer's ring buffer
+    /// @param[in] force Wake the logger thread regardless of the thresholds
+    ///////////////////////////////////////////////////////////////////////////
+    void Wake(size_t pending, bool force);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sleep state of the logger thread
+    ///////////////////////////////////////////////////////////////////////////
+    enum SleepState
+    {
+        AWAKE,      ///< The logger thread is draining
+        TIMED_WAIT, ///< Waiting for the flush time to pass
+        IDLE_WAIT   ///< Nothing pending, waiting without a timeout
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @class ThreadCache
+    /// @brief The buffers owned by one thread
+    /// @details On thread exit, any text left in the streams is committed
+    ///     and the buffers are released for reuse.
+    ///////////////////////////////////////////////////////////////////////////
+    class ThreadCache
+    {
+    public:
+        ThreadCache() : m_Head(0) {}
+        ~ThreadCache();
+        ThreadBuffer* m_Head; ///< First buffer owned by the thread
+    }; // end class ThreadCache
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The calling thread's buffers
+    ///////////////////////////////////////////////////////////////////////////
+    static thread_local ThreadCache s_ThreadCache;
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief The Logger object
     ///////////////////////////////////////////////////////////////////////////
@@ -112,26 +371,104 @@ private:
     std::ofstream m_Of;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief The output buffer
+    /// @brief The output file when it is memory-mapped
     ///////////////////////////////////////////////////////////////////////////
-    std::ostringstream m_Buffer;
+    MappedLogFile m_Mapped;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief The output thread
+    /// @brief Format of the output file
     ///////////////////////////////////////////////////////////////////////////
-    Thread* m_ThreadHandle;
+    OutputFormat m_OutputFormat;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Format to use the next time a file is opened
+    ///////////////////////////////////////////////////////////////////////////
+    OutputFormat m_NextOutputFormat;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sites looked up by the logger thread, indexed by ID
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<const LogSite*> m_Sites;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sites already described in the binary output file
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<bool> m_SitesWritten;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Records read from a ring buffer before they are processed
+    ///////////////////////////////////////////////////////////////////////////
+    std::string m_Records;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief All of the thread buffers, newest first
+    /// @details Buffers are only added while the logger is alive, so the
+    ///     logger thread can walk the list without a lock.
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<ThreadBuffer*> m_Buffers;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Ring buffer size for new thread buffers
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> m_BufferSize;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Lock for the output buffer
+    /// @brief Pending bytes in one ring buffer that wake the logger thread
     ///////////////////////////////////////////////////////////////////////////
-    Mutex* m_BuffMutex;
+    std::atomic<size_t> m_FlushBytes;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Longest time in ms that flushed text waits to be written
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> m_FlushMs;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sleep state of the logger thread, see SleepState
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<int> m_SleepState;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set by a producer that wants the file flushed right away
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> m_FlushNow;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Guards m_Reporter
+    ///////////////////////////////////////////////////////////////////////////
+    Mutex* m_ReportLock;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes the periodic report, may be empty
+    ///////////////////////////////////////////////////////////////////////////
+    Reporter_t m_Reporter;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Time in ms between reports, 0 when there is no reporter
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> m_ReportMs;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Signaled to wake the logger thread
+    ///////////////////////////////////////////////////////////////////////////
+    Event* m_WakeEvent;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Signaled by the logger thread when it has written everything
+    ///     and is about to exit
+    ///////////////////////////////////////////////////////////////////////////
+    Event* m_StoppedEvent;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The output thread
+    ///////////////////////////////////////////////////////////////////////////
+    Thread* m_ThreadHandle;
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Flag for continueing the output thread
     /// @details @li true - Continue output thread
     ///          @li false - End output thread
     ///////////////////////////////////////////////////////////////////////////
-    bool m_Continue;
+    std::atomic<bool> m_Continue;
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Indicates if the thread has started
@@ -149,10 +486,9 @@ Logger::Logger
     (
     )
 :
-m_Lock(0)
+m_LogImpl(0),
+m_Level(LOG_TRACE)
 {
-    m_Lock = Mutex::Create();
-    assert(m_Lock);
     m_LogImpl = new LogImpl(this);
 
 } // end Logger::Logger
@@ -162,8 +498,6 @@ m_Lock(0)
 ///////////////////////////////////////////////////////////////////////////////
 Logger::~Logger()
 {
-    // todo delete stuff
-    delete m_Lock;
     delete m_LogImpl;
 } // end Logger::~Logger
 
@@ -187,6 +521,38 @@ bool Logger::SetFile
     return true;
 } // end Logger::SetFile
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Logger::SetFile
+    (
+    const char* const fileName,
+    const LogFileOptions& options
+    )
+{
+    // OpenFile() will close the current file if it is open
+    if( !m_LogImpl->OpenFile(fileName, &options))
+    {
+        assert(0);
+        return false;
+    }
+
+    m_LogImpl->StartThread();
+
+    return true;
+} // end Logger::SetFile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::SetOutputFormat
+    (
+    OutputFormat format
+    )
+{
+    m_LogImpl->SetOutputFormat(format);
+} // end Logger::SetOutputFormat
+
 ///////////////////////////////////////////////////////////////////////////////
 // 02April2010, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
@@ -198,26 +564,83 @@ void Logger::PrintError
     *this << "!" << Error_Block_cstr << "\n";
     *this << msg << "\n";
     *this << Error_Block_cstr << "!\n";
+    // Errors go to disk right away
+    Flush(true);
 } // end Logger::PrintError
 
-//----------------------Private-Implementation-------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 02April2010, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-void Logger::Flush()
+void Logger::Flush
+    (
+    bool immediate
+    )
 {
-    ScopeLock al(m_Lock); // create auto lock
-    // Attempt to write the buffer
-    if(m_LogImpl->Write(m_Os))
-    {
-        // buffer was written so clear the stream
-        m_Os.str("");
-    }
-
+    NIK_LATENCY_SCOPE("logger.flush");
+    m_LogImpl->Commit(m_LogImpl->GetThreadBuffer(), immediate);
 } // end Logger::Flush
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::SetThreadBufferSize
+    (
+    size_t bytes
+    )
+{
+    m_LogImpl->SetThreadBufferSize(bytes);
+} // end Logger::SetThreadBufferSize
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::SetFlushPolicy
+    (
+    size_t flushBytes,
+    size_t flushMs
+    )
+{
+    m_LogImpl->SetFlushPolicy(flushBytes, flushMs);
+} // end Logger::SetFlushPolicy
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::SetReporter
+    (
+    Reporter_t&& reporter,
+    size_t periodMs
+    )
+{
+    m_LogImpl->SetReporter(std::move(reporter), periodMs);
+} // end Logger::SetReporter
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+std::ostringstream& Logger::GetThreadStream()
+{
+    return m_LogImpl->GetThreadBuffer()->m_Os;
+} // end Logger::GetThreadStream
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::CommitRecord
+    (
+    const LogSite& site,
+    const char* args,
+    size_t len
+    )
+{
+    NIK_LATENCY_SCOPE("logger.record");
+    m_LogImpl->CommitRecord(m_LogImpl->GetThreadBuffer(), site, args, len);
+} // end Logger::CommitRecord
+
 //----------------------LogImpl-Implementation-------------------------------//
 //----------------------Static-Members---------------------------------------//
+thread_local Logger::LogImpl::ThreadCache Logger::LogImpl::s_ThreadCache;
 
 //----------------------Public-Implementation--------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
@@ -229,8 +652,19 @@ Logger::LogImpl::LogImpl
     )
     :
 m_Log(log),
+m_OutputFormat(TEXT_OUTPUT),
+m_NextOutputFormat(TEXT_OUTPUT),
+m_Buffers(0),
+m_BufferSize(Default_Thread_Buffer_Size_glob),
+m_FlushBytes(Default_Flush_Bytes_glob),
+m_FlushMs(Default_Flush_Time_glob),
+m_SleepState(AWAKE),
+m_FlushNow(false),
+m_ReportLock(Mutex::Create("logger.report")),
+m_ReportMs(0),
+m_WakeEvent(0),
+m_StoppedEvent(0),
 m_ThreadHandle(0),
-m_BuffMutex(0),
 m_Continue(false),
 m_ThreadStarted(false)
 {
@@ -241,27 +675,51 @@ m_ThreadStarted(false)
 ///////////////////////////////////////////////////////////////////////////////
 nik::Logger::LogImpl::~LogImpl()
 {
-    if(!m_ThreadStarted)
-    {
-        // the logger was never setup,
-        // just quit
-        return;
-    }
-    // shutdown thread
-    m_Continue = false;
-    Sleep(50);
-    // todo setup event on thread quit
+    if(m_ThreadStarted)
     {
-        ScopeLock al(m_BuffMutex);        
-        // flush everything still in buffer
+        // shutdown thread, it writes everything still in the buffers
+        // before signaling that it has stopped
+        m_Continue = false;
+        m_WakeEvent->SetEvent();
+        m_StoppedEvent->WaitForEvent(Event::FOREVER);
+
+        // A thread committing from now on must not signal the events
+        m_SleepState.store(AWAKE);
+
+        // pick up anything committed after the thread's last pass
         ForceWrite();
-    }
 
-    // todo delete stuff
-    delete m_ThreadHandle;
-    delete m_BuffMutex;
+        delete m_ThreadHandle;
+        delete m_WakeEvent;
+        delete m_StoppedEvent;
 
-    CloseFile();
+        CloseFile();
+    }
+    delete m_ReportLock;
+
+    // Release the buffers.  Buffers still owned by a live thread are left
+    // for that thread to delete when it exits.
+    ThreadBuffer* buffer = m_Buffers.load(std::memory_order_acquire);
+    while(buffer)
+    {
+        ThreadBuffer* next = buffer->m_Next;
+        int state = ThreadBuffer::IN_USE;
+        while( !buffer->m_State.compare_exchange_weak(state, ThreadBuffer::DETACHED) &&
+            state != ThreadBuffer::FREE)
+        {
+            // Let an exiting thread finish with this object first
+            if(state == ThreadBuffer::COMMITTING)
+            {
+                std::this_thread::yield();
+                state = ThreadBuffer::IN_USE;
+            }
+        }
+        if(state == ThreadBuffer::FREE)
+        {
+            delete buffer;
+        }
+        buffer = next;
+    }
 } // end LogImpl::~LogImpl
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -276,15 +734,13 @@ void Logger::LogImpl::StartThread()
     }
     // Mark the thread as started
     m_ThreadStarted = true;
-    m_BuffMutex = Mutex::Create();
-    if(!m_BuffMutex)
+
+    m_WakeEvent = Event::Create("logger.wake");
+    m_StoppedEvent = Event::Create();
+    if(!m_WakeEvent || !m_StoppedEvent)
     {
         assert(0);
-        DWORD errCode = GetLastError();
-        std::ostringstream msg;
-        msg << "Error: StartThread->CreateMutex failed with code: ";
-        msg << errCode << std::endl;
-        throw Error(msg.str());
+        throw Error("Error: StartThread->Event::Create failed");
     }
 
     // Setup thread
@@ -301,25 +757,100 @@ void Logger::LogImpl::StartThread()
 ///////////////////////////////////////////////////////////////////////////////
 ThreadFuncReturnType_t NIK_API Logger::LogImpl::LogThreadFunc( ThreadFuncArgType_t logger )
 { 
+    typedef std::chrono::steady_clock Clock_t;
     LogImpl* log = static_cast<LogImpl*>(logger);
 
-    std::ostringstream outBuffer;
+    std::string outBuffer;
+    size_t unflushed = 0; // Bytes written to the file but not flushed
+    Clock_t::time_point lastFlush = Clock_t::now();
+    Clock_t::time_point lastReport = lastFlush;
     while(log->m_Continue)
     {
+        // Start a new segment before the sites are described
+        log->RotateFile();
+
+        // Pull everything out of the thread buffers
+        log->Drain(outBuffer);
+
+        // Add the report when it is due
+        size_t reportMs = log->m_ReportMs.load(std::memory_order_relaxed);
+        size_t sinceReport = static_cast<size_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                Clock_t::now() - lastReport).count());
+        if(reportMs && sinceReport >= reportMs)
         {
-            ScopeLock al(log->m_BuffMutex);
-            // Get a copy of the out buffer, then release mutex
-            outBuffer << log->m_Buffer.str();
-            log->m_Buffer.str("");
+            log->Report(outBuffer);
+            lastReport = Clock_t::now();
+            sinceReport = 0;
         }
         // now write out to file and clear outBuffer
-        log->m_Of << outBuffer.str();
-        outBuffer.str("");
-        log->m_Of.flush();
-        Sleep(25);
+        if( !outBuffer.empty())
+        {
+            log->WriteFile(outBuffer);
+            unflushed += outBuffer.size();
+            outBuffer.clear();
+        }
+
+        // Flush the file if a threshold has been reached
+        size_t flushMs = log->m_FlushMs.load(std::memory_order_relaxed);
+        Clock_t::time_point now = Clock_t::now();
+        size_t sinceFlush = static_cast<size_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - lastFlush).count());
+        bool flushNow = log->m_FlushNow.exchange(false);
+        if(unflushed &&
+           (flushNow ||
+            unflushed >= log->m_FlushBytes.load(std::memory_order_relaxed) ||
+            sinceFlush >= flushMs))
+        {
+            log->FlushFile();
+            unflushed = 0;
+            lastFlush = now;
+        }
+
+        // Sleep until there is work.  Publish the sleep state before the 
+        // final check so a producer committing now is guaranteed to see it.
+        log->m_WakeEvent->ClearEvent();
+        bool pending = unflushed || log->HasPending();
+        log->m_SleepState.store(pending ? TIMED_WAIT : IDLE_WAIT);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if( !log->m_Continue)
+        {
+            break;
+        }
+        if( !pending && log->HasPending())
+        {
+            // Text arrived while going to sleep
+            log->m_SleepState.store(AWAKE);
+            continue;
+        }
+        size_t waitMs = Event::FOREVER;
+        if(pending)
+        {
+            // Wait no longer than the remainder of the flush time
+            waitMs = sinceFlush < flushMs ? flushMs - sinceFlush : 0;
+        }
+        if(reportMs)
+        {
+            size_t untilReport = reportMs - sinceReport;
+            if(waitMs == Event::FOREVER || untilReport < waitMs)
+            {
+                waitMs = untilReport;
+            }
+        }
+        log->m_WakeEvent->WaitForEvent(waitMs);
+        log->m_SleepState.store(AWAKE);
     } // end while(continue)
     
-    // todo send end thread event
+    // Write out everything that is left before signaling the stop
+    outBuffer.clear();
+    log->Drain(outBuffer);
+    if(log->m_ReportMs.load(std::memory_order_relaxed))
+    {
+        log->Report(outBuffer);
+    }
+    log->WriteFile(outBuffer);
+    log->FlushFile();
+    log->m_StoppedEvent->SetEvent();
 
     return 0; 
 } // end Logger::LogImpl::LogThreadFunc
@@ -329,16 +860,36 @@ ThreadFuncReturnType_t NIK_API Logger::LogImpl::LogThreadFunc( ThreadFuncArgType
 ///////////////////////////////////////////////////////////////////////////////
 bool Logger::LogImpl::OpenFile
     (
-    const char* const fileName
+    const char* const fileName,
+    const LogFileOptions* const options
     )
 {
-    if(m_Of.is_open())
+    if(m_Of.is_open() || m_Mapped.IsOpen())
     {
         // close file, then open new one
         CloseFile();
     }
 
-    m_Of.open(fileName);
+    m_OutputFormat = m_NextOutputFormat;
+    m_SitesWritten.clear();
+    if(options)
+    {
+        // The magic starts every segment
+        std::string header;
+        if(m_OutputFormat == BINARY_OUTPUT)
+        {
+            header.assign(BinaryLog::FileMagic, BinaryLog::FileMagicSize);
+        }
+        return m_Mapped.Open(fileName, *options, header);
+    }
+    if(m_OutputFormat == BINARY_OUTPUT)
+    {
+        m_Of.open(fileName, std::ios::out | std::ios::binary);
+    }
+    else
+    {
+        m_Of.open(fileName);
+    }
 
     if(!m_Of)
     {
@@ -346,6 +897,11 @@ bool Logger::LogImpl::OpenFile
         return false;
     }
 
+    if(m_OutputFormat == BINARY_OUTPUT)
+    {
+        m_Of.write(BinaryLog::FileMagic, BinaryLog::FileMagicSize);
+    }
+
     return true;
 } // end Logger::LogImpl::OpenFile
 
@@ -354,6 +910,10 @@ bool Logger::LogImpl::OpenFile
 ///////////////////////////////////////////////////////////////////////////////
 bool Logger::LogImpl::CloseFile()
 {
+    if(m_Mapped.IsOpen())
+    {
+        return m_Mapped.Close();
+    }
     if(!m_Of.is_open())
     {
         return false;
@@ -369,31 +929,503 @@ bool Logger::LogImpl::CloseFile()
 ///////////////////////////////////////////////////////////////////////////////
 bool Logger::LogImpl::ForceWrite()
 {
-    m_Buffer << m_Log->m_Os.str();
-    m_Log->m_Os.str("");
-    m_Of << m_Buffer.str();
-    m_Buffer.str("");
+    std::string outBuffer;
+    Drain(outBuffer);
+    WriteFile(outBuffer);
     return true;
 } // end Logger::LogImpl::ForceWrite
 
 ///////////////////////////////////////////////////////////////////////////////
-// 19March2010, nik: initial
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::WriteFile
+    (
+    const std::string& out
+    )
+{
+    if(m_Mapped.IsOpen())
+    {
+        m_Mapped.Write(out.data(), out.size());
+    }
+    else
+    {
+        m_Of << out;
+    }
+} // end Logger::LogImpl::WriteFile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::FlushFile()
+{
+    if(m_Mapped.IsOpen())
+    {
+        m_Mapped.Flush();
+    }
+    else
+    {
+        m_Of.flush();
+    }
+} // end Logger::LogImpl::FlushFile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::RotateFile()
+{
+    if(m_Mapped.RotateDue())
+    {
+        m_Mapped.Rotate();
+        m_SitesWritten.clear();
+    }
+} // end Logger::LogImpl::RotateFile
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Logger::ThreadBuffer* Logger::LogImpl::GetThreadBuffer()
+{
+    ThreadCache& cache = s_ThreadCache;
+    ThreadBuffer** link = &cache.m_Head;
+    while(ThreadBuffer* buffer = *link)
+    {
+        if(buffer->m_State.load(std::memory_order_acquire) == ThreadBuffer::DETACHED)
+        {
+            // Its logger is gone, and a new one may have the same address
+            *link = buffer->m_ThreadNext;
+            delete buffer;
+            continue;
+        }
+        if(buffer->m_Owner == this)
+        {
+            return buffer;
+        }
+        link = &buffer->m_ThreadNext;
+    }
+
+    // First time this thread logs through this object
+    ThreadBuffer* buffer = ClaimBuffer();
+    buffer->m_ThreadNext = cache.m_Head;
+    cache.m_Head = buffer;
+    return buffer;
+} // end Logger::LogImpl::GetThreadBuffer
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Logger::LogImpl::Commit
+    (
+    ThreadBuffer* buffer,
+    bool immediate
+    )
+{
+    std::string text = buffer->m_Os.str();
+    if(text.empty())
+    {
+        if(immediate)
+        {
+            // Still honor the request to get earlier text to disk
+            m_FlushNow = true;
+            Wake(0, true);
+        }
+        return true;
+    }
+
+    // Text that fits is kept in one record so it is not split by another
+    // thread's text.  Larger text is written in pieces.
+    const char* data = text.data();
+    size_t len = text.size();
+    RingBuffer& ring = buffer->m_Ring;
+    size_t maxPiece = ring.Capacity() - sizeof(BinaryLog::RecordHeader);
+    while(len)
+    {
+        BinaryLog::RecordHeader header;
+        header.m_Size = static_cast<uint32_t>(len < maxPiece ? len : maxPiece);
+        header.m_Kind = BinaryLog::RECORD_TEXT;
+        if( !WriteRecord(buffer, &header, sizeof(header), data, header.m_Size))
+        {
+            // Nobody is draining, keep the text for the next attempt
+            break;
+        }
+        data += header.m_Size;
+        len -= header.m_Size;
+    }
+    buffer->m_Os.str("");
+    buffer->m_Os.write(data, len);
+    if(immediate)
+    {
+        m_FlushNow = true;
+    }
+    Wake(ring.ReadAvailable(), immediate);
+    return len == 0;
+} // end Logger::LogImpl::Commit
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-bool Logger::LogImpl::Write
+bool Logger::LogImpl::CommitRecord
     (
-    const std::ostringstream& os
+    ThreadBuffer* buffer,
+    const LogSite& site,
+    const char* args,
+    size_t len
     )
 {
-    if( !m_BuffMutex->Lock(Wait_Time_glob))
+    // Keep the thread's output in order
+    if( !Commit(buffer, false))
     {
-        // Timed out, signal that the buffer was not saved off
         return false;
     }
-    // save off the data and signal success
-    m_Buffer << os.str();
-    m_BuffMutex->Unlock();
+
+    // The header and site ID go in front of the arguments
+    char head[sizeof(BinaryLog::RecordHeader) + sizeof(uint32_t)];
+    if(sizeof(head) + len > buffer->m_Ring.Capacity())
+    {
+        // A record this big would never fit the ring.  Format it here and
+        // commit it as text, which is written in pieces.
+        std::string text;
+        BinaryLog::Format(site.m_Format, args, len, text);
+        buffer->m_Os << text << "\n";
+        return Commit(buffer, site.m_Level >= LOG_ERROR);
+    }
+    BinaryLog::RecordHeader header;
+    header.m_Size = static_cast<uint32_t>(sizeof(uint32_t) + len);
+    header.m_Kind = BinaryLog::RECORD_BINARY;
+    memcpy(head, &header, sizeof(header));
+    memcpy(head + sizeof(header), &site.m_ID, sizeof(uint32_t));
+
+    if( !WriteRecord(buffer, head, sizeof(head), args, len))
+    {
+        return false;
+    }
+    bool immediate = site.m_Level >= LOG_ERROR;
+    if(immediate)
+    {
+        m_FlushNow = true;
+    }
+    Wake(buffer->m_Ring.ReadAvailable(), immediate);
+    return true;
+} // end Logger::LogImpl::CommitRecord
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::SetOutputFormat
+    (
+    OutputFormat format
+    )
+{
+    m_NextOutputFormat = format;
+} // end Logger::LogImpl::SetOutputFormat
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::SetThreadBufferSize
+    (
+    size_t bytes
+    )
+{
+    // Text is committed in pieces of the capacity less a record header
+    m_BufferSize = std::max(bytes, Min_Thread_Buffer_Size_glob);
+} // end Logger::LogImpl::SetThreadBufferSize
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::SetFlushPolicy
+    (
+    size_t flushBytes,
+    size_t flushMs
+    )
+{
+    m_FlushBytes = flushBytes;
+    m_FlushMs = flushMs;
+    // Let the logger thread pick up the new timeout
+    Wake(0, true);
+} // end Logger::LogImpl::SetFlushPolicy
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::SetReporter
+    (
+    Reporter_t&& reporter,
+    size_t periodMs
+    )
+{
+    {
+        ScopeLock lock(m_ReportLock);
+        m_Reporter = std::move(reporter);
+        m_ReportMs = m_Reporter ? periodMs : 0;
+    }
+    // Let the logger thread pick up the new timeout
+    Wake(0, true);
+} // end Logger::LogImpl::SetReporter
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Logger::ThreadBuffer* Logger::LogImpl::ClaimBuffer()
+{
+    // Reuse a buffer left behind by a thread that has exited
+    ThreadBuffer* buffer = m_Buffers.load(std::memory_order_acquire);
+    for(; buffer; buffer = buffer->m_Next)
+    {
+        int state = ThreadBuffer::FREE;
+        if(buffer->m_State.compare_exchange_strong(state, ThreadBuffer::IN_USE))
+        {
+            buffer->m_ThreadNext = 0;
+            return buffer;
+        }
+    }
+
+    // None free, add a new one to the front of the list
+    buffer = new ThreadBuffer(this, m_BufferSize);
+    ThreadBuffer* head = m_Buffers.load(std::memory_order_relaxed);
+    do
+    {
+        buffer->m_Next = head;
+    } while( !m_Buffers.compare_exchange_weak(head, buffer,
+                std::memory_order_release, std::memory_order_relaxed));
+    return buffer;
+} // end Logger::LogImpl::ClaimBuffer
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Logger::LogImpl::WriteRecord
+    (
+    ThreadBuffer* buffer,
+    const void* head,
+    size_t headLen,
+    const void* data,
+    size_t len
+    )
+{
+    RingBuffer& ring = buffer->m_Ring;
+    while( !ring.TryWrite(head, headLen, data, len))
+    {
+        if( !m_Continue)
+        {
+            return false;
+        }
+        Wake(ring.Capacity(), true);
+        std::this_thread::yield();
+    }
     return true;
-} // end Logger::LogImpl::Write
+} // end Logger::LogImpl::WriteRecord
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::Drain
+    (
+    std::string& out
+    )
+{
+    ThreadBuffer* buffer = m_Buffers.load(std::memory_order_acquire);
+    for(; buffer; buffer = buffer->m_Next)
+    {
+        m_Records.clear();
+        if(buffer->m_Ring.Read(m_Records))
+        {
+            Process(m_Records, out);
+        }
+    }
+} // end Logger::LogImpl::Drain
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::Process
+    (
+    const std::string& records,
+    std::string& out
+    )
+{
+    const char* pos = records.data();
+    const char* end = pos + records.size();
+    BinaryLog::RecordHeader header;
+    while(static_cast<size_t>(end - pos) >= sizeof(header))
+    {
+        memcpy(&header, pos, sizeof(header));
+        const char* payload = pos + sizeof(header);
+        assert(header.m_Size <= static_cast<size_t>(end - payload));
+        pos = payload + header.m_Size;
+
+        if(header.m_Kind == BinaryLog::RECORD_TEXT)
+        {
+            if(m_OutputFormat == BINARY_OUTPUT)
+            {
+                out.append(payload - sizeof(header), sizeof(header) + header.m_Size);
+            }
+            else
+            {
+                out.append(payload, header.m_Size);
+            }
+            continue;
+        }
+
+        assert(header.m_Kind == BinaryLog::RECORD_BINARY);
+        uint32_t id;
+        memcpy(&id, payload, sizeof(id));
+        const LogSite* site = GetSite(id);
+        if(m_OutputFormat == BINARY_OUTPUT)
+        {
+            // Describe the site the first time it appears in the file
+            if(id >= m_SitesWritten.size())
+            {
+                m_SitesWritten.resize(id + 1, false);
+            }
+            if( !m_SitesWritten[id] && site)
+            {
+                BinaryLog::WriteSite(*site, out);
+                m_SitesWritten[id] = true;
+            }
+            out.append(payload - sizeof(header), sizeof(header) + header.m_Size);
+        }
+        else if(site)
+        {
+            BinaryLog::Format(site->m_Format, payload + sizeof(id),
+                header.m_Size - sizeof(id), out);
+            out += '\n';
+        }
+    }
+} // end Logger::LogImpl::Process
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::Report
+    (
+    std::string& out
+    )
+{
+    ScopeLock lock(m_ReportLock);
+    if( !m_Reporter)
+    {
+        return;
+    }
+    if(m_OutputFormat == TEXT_OUTPUT)
+    {
+        m_Reporter(out);
+        return;
+    }
+    // Binary files get the report as a text record
+    std::string text;
+    m_Reporter(text);
+    if(text.empty())
+    {
+        return;
+    }
+    BinaryLog::RecordHeader header;
+    header.m_Size = static_cast<uint32_t>(text.size());
+    header.m_Kind = BinaryLog::RECORD_TEXT;
+    out.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    out += text;
+} // end Logger::LogImpl::Report
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+const LogSite* Logger::LogImpl::GetSite
+    (
+    uint32_t id
+    )
+{
+    if(id >= m_Sites.size())
+    {
+        m_Sites.resize(id + 1, 0);
+    }
+    if( !m_Sites[id])
+    {
+        m_Sites[id] = LogSite::Find(id);
+    }
+    return m_Sites[id];
+} // end Logger::LogImpl::GetSite
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Logger::LogImpl::HasPending() const
+{
+    ThreadBuffer* buffer = m_Buffers.load(std::memory_order_acquire);
+    for(; buffer; buffer = buffer->m_Next)
+    {
+        if(buffer->m_Ring.ReadAvailable())
+        {
+            return true;
+        }
+    }
+    return false;
+} // end Logger::LogImpl::HasPending
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Logger::LogImpl::Wake
+    (
+    size_t pending,
+    bool force
+    )
+{
+    if( !m_WakeEvent)
+    {
+        // The logger thread has not been started
+        return;
+    }
+    // Order the commit before reading the sleep state, pairs with the
+    // store in LogThreadFunc
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int state = m_SleepState.load(std::memory_order_relaxed);
+    if(state == AWAKE)
+    {
+        return;
+    }
+    // A timed wait ends on its own, only cut it short for a threshold
+    if(state == TIMED_WAIT && !force &&
+        pending < m_FlushBytes.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    // Only one producer signals the event
+    if(m_SleepState.compare_exchange_strong(state, AWAKE))
+    {
+        m_WakeEvent->SetEvent();
+    }
+} // end Logger::LogImpl::Wake
+
+//----------------------ThreadCache-Implementation---------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Logger::LogImpl::ThreadCache::~ThreadCache()
+{
+    ThreadBuffer* buffer = m_Head;
+    while(buffer)
+    {
+        ThreadBuffer* next = buffer->m_ThreadNext;
+        // Claim the buffer so the logger waits for the commit to finish
+        int state = ThreadBuffer::IN_USE;
+        if(buffer->m_State.compare_exchange_strong(state, ThreadBuffer::COMMITTING,
+            std::memory_order_acquire))
+        {
+            // Hand over anything that was never flushed
+            buffer->m_Owner->Commit(buffer, false);
+            buffer->m_Os.str("");
+            buffer->m_State.store(ThreadBuffer::FREE, std::memory_order_release);
+        }
+        else
+        {
+            // The logger has already been destroyed
+            delete buffer;
+        }
+        buffer = next;
+    }
+    m_Head = 0;
+} // end Logger::LogImpl::ThreadCache::~ThreadCache
 
 //----------------------TLogger-Implementation-------------------------------//
 //----------------------Public-Implementation--------------------------------//
@@ -403,7 +1435,23 @@ bool Logger::LogImpl::Write
 template<>
 TLogger<true>::TLogger()
 :
-m_Log(&log)
+m_Log(&GetLog()),
+m_Level(LOG_INFO),
+m_Enabled(true)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+template<>
+TLogger<true>::TLogger
+    (
+    LogLevel level
+    )
+:
+m_Log(&GetLog()),
+m_Level(level),
+m_Enabled(m_Log->IsEnabled(level))
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -412,7 +1460,24 @@ m_Log(&log)
 template<>
 TLogger<false>::TLogger(Logger& logger)
 :
-m_Log(&logger)
+m_Log(&logger),
+m_Level(LOG_INFO),
+m_Enabled(true)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+template<>
+TLogger<false>::TLogger
+    (
+    Logger& logger,
+    LogLevel level
+    )
+:
+m_Log(&logger),
+m_Level(level),
+m_Enabled(logger.IsEnabled(level))
 {}
 
 } // end namespace nik
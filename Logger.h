@@ -4,6 +4,16 @@
 /// @internal
 ///
 /// 03March2010, nik: initial
+/// 14October2026, nik: Per-thread ring buffers replace the shared stream lock
+/// 14October2026, nik: Event driven logger thread with flush thresholds
+/// 14October2026, nik: Added log levels and the NIK_LOG statement macros
+/// 14October2026, nik: The NIK_LOG macros evaluate the logger once
+/// 14October2026, nik: Added deferred-format logging, see NIK_LOG_FMT
+/// 14October2026, nik: Added periodic reports from the logger thread
+/// 14October2026, nik: nik::log is a singleton destroyed last
+/// 14October2026, nik: Added GetLog(), safe to call during static
+///     initialisation
+/// 14October2026, nik: Added memory-mapped rotating output, see MappedLogFile
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_LOGGER_HEADER
 #define NIK_LOGGER_HEADER
@@ -11,26 +21,88 @@
 #include <fstream>
 #include <string>
 #include <sstream>
-#include <Util\Utility.h>
-#include <Util\ScopeLock.h>
+#include <atomic>
+#include <Util/Utility.h>
+#include <Util/ScopeLock.h>
+#include <Util/BinaryLog.h>
+#include <Util/Singleton.h>
+#include <Util/Function.h>
+#include <Util/LogFile.h>
+
+///////////////////////////////////////////////////////////////////////////////
+/// @name Log level values
+/// @brief Numeric values of the log levels for use in preprocessor checks
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_LOG_LEVEL_TRACE 0
+#define NIK_LOG_LEVEL_DEBUG 1
+#define NIK_LOG_LEVEL_INFO  2
+#define NIK_LOG_LEVEL_WARN  3
+#define NIK_LOG_LEVEL_ERROR 4
+#define NIK_LOG_LEVEL_OFF   5
+/// @}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Lowest level compiled into the build
+/// @details NIK_LOG statements below this level compile to nothing.  Define
+///     it on the command line, ex. -DNIK_LOG_MIN_LEVEL=NIK_LOG_LEVEL_INFO
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_LOG_MIN_LEVEL
+#define NIK_LOG_MIN_LEVEL NIK_LOG_LEVEL_TRACE
+#endif
 
 namespace nik{
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Severity of a log statement
+///////////////////////////////////////////////////////////////////////////////
+enum LogLevel
+{
+    LOG_TRACE = NIK_LOG_LEVEL_TRACE,
+    LOG_DEBUG = NIK_LOG_LEVEL_DEBUG,
+    LOG_INFO = NIK_LOG_LEVEL_INFO,
+    LOG_WARN = NIK_LOG_LEVEL_WARN,
+    LOG_ERROR = NIK_LOG_LEVEL_ERROR,
+    LOG_OFF = NIK_LOG_LEVEL_OFF
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Logger <Util\Logger.h>
 /// @brief Allows for the logging of data to file or command line
 /// @details This class is designed to give an entire project access to the
 ///     same out file for output.  This class creates its own thread to do
 ///     the writing to file.  
+///
+///     Every thread that logs gets its own stream and ring buffer.  The 
+///     stream operator << formats into the calling thread's stream without
+///     taking a lock.  Flush() moves the formatted text into the thread's
+///     ring buffer, which the logger thread drains.  Text flushed from one
+///     thread is written in the order it was flushed.
+///
+///     Statements written with NIK_LOG_FMT are not formatted on the calling
+///     thread.  The site ID and the raw argument bytes are copied into the
+///     ring buffer, and the logger thread formats them.  With BINARY_OUTPUT
+///     the records are written to the file as they are and formatted later
+///     by the LogDecode tool.
 /// @attention The SetFile function should be called before using the object.
-/// @warning This class is thread safe to a point.  Seperate calls of the
-///     stream operator << may not appear together.
+/// @warning Output from different threads is only interleaved at Flush() 
+///     boundaries.  Text that has not been flushed is not visible to the 
+///     logger thread until the owning thread exits.
 /// @note Logger is implemented by an impl class.
 ///////////////////////////////////////////////////////////////////////////////
 class Logger
 {
 public:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief How the logger thread writes the file
+    ///////////////////////////////////////////////////////////////////////////
+    enum OutputFormat
+    {
+        TEXT_OUTPUT,    ///< Format everything into text (default)
+        BINARY_OUTPUT   ///< Write the records unformatted, see LogDecode
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Constructor
     /// @attention Call SetFile(const char* const) before using this object.
@@ -54,6 +126,32 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     bool SetFile(const char* const fileName);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets a memory-mapped file for output
+    /// @details Like SetFile(const char* const), but the logger thread copies
+    ///     into a MappedLogFile instead of a stream.  What the thread has 
+    ///     written survives a crash of the process without being flushed.
+    ///     The segment is rotated between the thread's passes, so it may 
+    ///     pass its size by one pass of output and its age by about the 
+    ///     flush time, see SetFlushPolicy().  Each segment of a binary log
+    ///     starts with its own magic and site records, so it can be decoded
+    ///     alone.
+    /// @note This function will spawn the logger thread
+    /// @param[in] fileName The name of the active segment
+    /// @param[in] options The segment size, rotation and compression
+    /// @return @arg true - The file opened successfully
+    ///         @arg false - An error occured while trying to open the file
+    ///////////////////////////////////////////////////////////////////////////
+    bool SetFile(const char* const fileName, const LogFileOptions& options);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets how the logger thread writes the file
+    /// @attention Call before SetFile(const char* const).  The format only 
+    ///     takes effect when a file is opened.
+    /// @param[in] format The output format
+    ///////////////////////////////////////////////////////////////////////////
+    void SetOutputFormat(OutputFormat format);
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Outputs some data to file
     /// @details Call this function to write output to the out file.
@@ -64,8 +162,7 @@ public:
     template <class T>
     Logger& operator<<(const T& val)
     {
-        ScopeLock al(m_Lock); // create auto lock
-        m_Os << val;
+        GetThreadStream() << val;
         return *this;
     }
 
@@ -74,6 +171,24 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     typedef Logger& (*ManipFunc_t)(Logger&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Records a statement without formatting it
+    /// @details Encodes the arguments as raw bytes and commits them with the
+    ///     site ID to the calling thread's ring buffer.  Text written with 
+    ///     operator<< that has not been flushed is flushed first so that the
+    ///     thread's output stays in order.
+    /// @note Use NIK_LOG_FMT rather than calling this directly
+    /// @param[in] site The static site of the statement
+    /// @param[in] args The arguments of the statement
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    void Record(const LogSite& site, const ARGS&... args)
+    {
+        LogArgWriter writer;
+        writer.WriteAll(args...);
+        CommitRecord(site, writer.Data(), writer.Size());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Stream manipulator handler
     /// @details Thils function accepts a string manipulator and calls it
@@ -83,7 +198,6 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Logger& operator<<(ManipFunc_t op)
     {
-        ScopeLock al(m_Lock); // create auto lock
         return op(*this);
     }
 
@@ -97,15 +211,108 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Forces the stream out to file
+    /// @details Moves the text formatted by the calling thread into its ring
+    ///     buffer.  If the ring buffer is full, this function waits for the
+    ///     logger thread to make room.  The logger thread writes the text 
+    ///     according to the flush policy, see SetFlushPolicy().
+    /// @param[in] immediate @li true - Wake the logger thread and write the
+    ///                          text to disk right away
+    ///                      @li false - Follow the flush policy (default)
+    ///////////////////////////////////////////////////////////////////////////
+    void Flush(bool immediate = false);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets when the logger thread writes to disk
+    /// @details The logger thread sleeps until there is work to do.  It is 
+    ///     woken when a thread has at least flushBytes waiting in its ring 
+    ///     buffer, or when text is flushed with Flush(true).  Text that does
+    ///     not reach the byte threshold is written no later than flushMs 
+    ///     after it was flushed.
+    /// @param[in] flushBytes Pending bytes that wake the logger thread
+    /// @param[in] flushMs The longest time flushed text waits to be written
+    ///////////////////////////////////////////////////////////////////////////
+    void SetFlushPolicy(size_t flushBytes, size_t flushMs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the size of the per-thread ring buffers
+    /// @details Only affects threads that have not logged through this 
+    ///     object yet.  Sizes below 1KB are raised to 1KB.  A deferred-format
+    ///     record too big for the buffer is formatted on the calling thread
+    ///     and written as text.
+    /// @param[in] bytes The size of each ring buffer in bytes
+    ///////////////////////////////////////////////////////////////////////////
+    void SetThreadBufferSize(size_t bytes);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Function that appends a report to the string it is given
     ///////////////////////////////////////////////////////////////////////////
-    void Flush();
+    typedef Function<void(std::string&)> Reporter_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets a report the logger thread writes periodically
+    /// @details The logger thread calls the reporter every periodMs and 
+    ///     writes the text to the file, so the reporter never waits on a 
+    ///     ring buffer.  Replaces any earlier reporter; waits for a report 
+    ///     that is being written.
+    /// @warning The reporter runs on the logger thread and must not log.
+    /// @param[in] reporter Writes the report, empty to stop reporting
+    /// @param[in] periodMs Time between reports
+    ///////////////////////////////////////////////////////////////////////////
+    void SetReporter(Reporter_t&& reporter, size_t periodMs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets the lowest level that is logged at runtime
+    /// @details Levels below NIK_LOG_MIN_LEVEL are never logged, regardless
+    ///     of this setting.
+    /// @param[in] level The lowest level to log
+    ///////////////////////////////////////////////////////////////////////////
+    void SetLevel(LogLevel level)
+    {
+        m_Level.store(level, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the lowest level that is logged at runtime
+    ///////////////////////////////////////////////////////////////////////////
+    LogLevel GetLevel() const
+    {
+        return static_cast<LogLevel>(m_Level.load(std::memory_order_relaxed));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Checks if statements at the given level are logged
+    /// @param[in] level The level to check
+    /// @return @arg true - The level is logged
+    ///         @arg false - The level is filtered out
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsEnabled(LogLevel level) const
+    {
+        return level >= NIK_LOG_MIN_LEVEL && 
+            level >= m_Level.load(std::memory_order_relaxed);
+    }
 
 private:
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Buffer for storing output before writing it
+    /// @brief Gets the stream belonging to the calling thread
+    /// @details The first call from a thread sets up the thread's stream and
+    ///     ring buffer.  Later calls do not lock.
+    /// @return The calling thread's stream
     ///////////////////////////////////////////////////////////////////////////
-    std::ostringstream m_Os;
+    std::ostringstream& GetThreadStream();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Commits an encoded statement to the calling thread's buffer
+    /// @param[in] site The static site of the statement
+    /// @param[in] args The encoded arguments
+    /// @param[in] len The number of bytes of encoded arguments
+    ///////////////////////////////////////////////////////////////////////////
+    void CommitRecord(const LogSite& site, const char* args, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The stream and ring buffer owned by one producer thread
+    ///////////////////////////////////////////////////////////////////////////
+    class ThreadBuffer;
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief The implemenation class for Logger
@@ -119,14 +326,32 @@ private:
     LogImpl* m_LogImpl;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Lock for the output buffer
+    /// @brief The lowest level logged at runtime
     ///////////////////////////////////////////////////////////////////////////
-    Mutex* m_Lock;
+    std::atomic<int> m_Level;
 
 }; // end class Logger
 
 
-extern Logger log;
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the project wide logger
+/// @details Held by a Singleton in SINGLETON_PHASE_LOGGER, so it is destroyed
+///     after every other Singleton and after the statics of every file that
+///     includes this header, which may all log from their destructors.  It
+///     is created on the first call, so this may be called from any static
+///     constructor.
+///////////////////////////////////////////////////////////////////////////////
+inline Logger& GetLog()
+{
+    return Singleton<Logger, PhasedLifetime<SINGLETON_PHASE_LOGGER> >::Ref();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The project wide logger, kept for existing code
+/// @attention Only bound once the statics of Logger.cpp are initialised; a
+///     static constructor in another file must use GetLog() instead.
+///////////////////////////////////////////////////////////////////////////////
+extern Logger& log;
 
 ///////////////////////////////////////////////////////////////////////////
 /// @brief Flushes the Logger stream
@@ -140,6 +365,17 @@ inline Logger& endl(Logger& logger)
     return logger;
 }
 
+///////////////////////////////////////////////////////////////////////////
+/// @brief Flushes the Logger stream and writes it to disk right away
+/// @param[in] logger The logger object to modify
+/// @return A reference to the Logger object
+///////////////////////////////////////////////////////////////////////////
+inline Logger& flush(Logger& logger)
+{
+    logger.Flush(true);
+    return logger;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Thread safe logger
 /// @details This logger class is designed to write safely in an environment 
@@ -147,6 +383,10 @@ inline Logger& endl(Logger& logger)
 ///     to do the actually writing.  TLogger does not flush the stream to the
 ///     Logger object until Flush() is called or the TLogger object's 
 ///     destructor is called.
+///
+///     A TLogger can be given a level.  If the level is filtered out when 
+///     the TLogger is constructed, nothing is formatted or written.  Use the
+///     NIK_LOG macros to also skip evaluating the arguments.
 ///////////////////////////////////////////////////////////////////////////////
 template <bool USE_LOG>
 class TLogger
@@ -170,6 +410,22 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     TLogger(Logger& logger);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Create a TLogger on the global log object that writes at the
+    ///     given level.
+    /// @note Only implemented for USE_LOG == true
+    ///////////////////////////////////////////////////////////////////////////
+    explicit TLogger(LogLevel level);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Create a TLogger that will %log through the given Logger 
+    ///     object at the given level.
+    /// @note Only implemented for USE_LOG == false
+    ///////////////////////////////////////////////////////////////////////////
+    TLogger(Logger& logger, LogLevel level);
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Destructor
     /// @details Flush the stream on destruction.
@@ -186,7 +442,10 @@ public:
     template <typename T>
     inline TLogger& operator<<(const T& val)
     {
-        m_Os << val;
+        if(m_Enabled)
+        {
+            m_Os << val;
+        }
         return *this;
     }
 
@@ -211,8 +470,12 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void Flush()
     {
+        if( !m_Enabled)
+        {
+            return;
+        }
         *m_Log << m_Os.str();
-        m_Log->Flush();
+        m_Log->Flush(m_Level >= LOG_ERROR);
         m_Os.str("");
     }
 
@@ -229,6 +492,16 @@ private:
     /// @brief The logger to use for this object
     ///////////////////////////////////////////////////////////////////////////
     Logger* m_Log;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The level this object writes at
+    ///////////////////////////////////////////////////////////////////////////
+    LogLevel m_Level;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Indicates if the level was enabled on construction
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Enabled;
 }; // endl class TLogger
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -238,6 +511,12 @@ private:
 template<>
 TLogger<true>::TLogger();
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specialization for using the global log Logger at a given level
+///////////////////////////////////////////////////////////////////////////////
+template<>
+TLogger<true>::TLogger(LogLevel level);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief for using TLogger with the global log logger.
 ///////////////////////////////////////////////////////////////////////////////
@@ -252,6 +531,12 @@ typedef TLogger<true> TLog;
 template<>
 TLogger<false>::TLogger(Logger& logger);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specialization for using a specified Logger object at a given level
+///////////////////////////////////////////////////////////////////////////////
+template<>
+TLogger<false>::TLogger(Logger& logger, LogLevel level);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Flushes the TLogger object
 /// @details Calls TLogger::Flush() on the given TLogger object.  
@@ -264,8 +549,177 @@ inline TLogger<USE_LOG>& endl(TLogger<USE_LOG>& logger)
     return logger;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @class LogStatement Logger.h <Util\Logger.h>
+/// @brief A single log line written by the NIK_LOG macros
+/// @details Formats straight into the Logger's per-thread stream.  The line
+///     is ended and flushed when the statement goes out of scope.  ERROR 
+///     lines are written to disk immediately.
+/// @tparam ENABLED false if the level is compiled out, in which case the
+///     class does nothing
+///////////////////////////////////////////////////////////////////////////////
+template <bool ENABLED>
+class LogStatement
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] logger The logger to write to
+    /// @param[in] level The level of the statement
+    ///////////////////////////////////////////////////////////////////////////
+    LogStatement(Logger& logger, LogLevel level)
+    :
+    m_Log(logger),
+    m_Level(level)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Ends the line and flushes it to the logger thread
+    ///////////////////////////////////////////////////////////////////////////
+    ~LogStatement()
+    {
+        m_Log << "\n";
+        m_Log.Flush(m_Level >= LOG_ERROR);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Puts the given value into the line
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    LogStatement& operator<<(const T& val)
+    {
+        m_Log << val;
+        return *this;
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The logger to write to
+    ///////////////////////////////////////////////////////////////////////////
+    Logger& m_Log;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The level of the statement
+    ///////////////////////////////////////////////////////////////////////////
+    LogLevel m_Level;
+
+}; // end class LogStatement
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specialization for statements that are compiled out
+/// @details Every operation is empty so the optimizer removes the statement.
+///////////////////////////////////////////////////////////////////////////////
+template <>
+class LogStatement<false>
+{
+public:
+    LogStatement(Logger&, LogLevel)
+    {}
+
+    template <typename T>
+    LogStatement& operator<<(const T&)
+    {
+        return *this;
+    }
+}; // end class LogStatement<false>
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class LogGate Logger.h <Util\Logger.h>
+/// @brief Holds the logger and level of a NIK_LOG_TO statement
+/// @details Each macro argument is evaluated once, into the gate.  The 
+///     logger is only kept when the level is enabled, and NIK_LOG_TO runs 
+///     its statement while it is kept, so at most once.
+/// @tparam ENABLED false if the level is compiled out
+///////////////////////////////////////////////////////////////////////////////
+template <bool ENABLED>
+class LogGate
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] logger The logger to write to, 0 when compiled out
+    /// @param[in] level The level of the statement
+    ///////////////////////////////////////////////////////////////////////////
+    LogGate(Logger* logger, LogLevel level)
+    :
+    m_Log(ENABLED && logger && logger->IsEnabled(level) ? logger : 0),
+    m_Level(level)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The logger if the statement is to be written, 0 otherwise
+    ///////////////////////////////////////////////////////////////////////////
+    Logger* m_Log;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The level of the statement
+    ///////////////////////////////////////////////////////////////////////////
+    LogLevel m_Level;
+
+}; // end class LogGate
+
 } // end namespace nik
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Writes a line at the given level to the given Logger
+/// @details Usage: NIK_LOG_TO(myLog, nik::LOG_WARN) << "x=" << x;
+///     When the level is below NIK_LOG_MIN_LEVEL the statement compiles to
+///     nothing.  When the level is filtered out at runtime, the arguments
+///     are not evaluated.  LOGGER and LEVEL are evaluated once.  The line is
+///     ended with a new line.
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_LOG_TO(LOGGER, LEVEL) \
+    for(nik::LogGate<((LEVEL) >= NIK_LOG_MIN_LEVEL)> nikLogGate( \
+            ((LEVEL) >= NIK_LOG_MIN_LEVEL) ? &(LOGGER) : 0, (LEVEL)); \
+        nikLogGate.m_Log; nikLogGate.m_Log = 0) \
+        nik::LogStatement<((LEVEL) >= NIK_LOG_MIN_LEVEL)>(*nikLogGate.m_Log, nikLogGate.m_Level)
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Writes a line at the given level to the global log object
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_LOG(LEVEL) NIK_LOG_TO(nik::GetLog(), LEVEL)
+
+///////////////////////////////////////////////////////////////////////////////
+/// @name Level shortcuts for NIK_LOG
+/// @{
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_LOG_TRACE NIK_LOG(nik::LOG_TRACE)
+#define NIK_LOG_DEBUG NIK_LOG(nik::LOG_DEBUG)
+#define NIK_LOG_INFO NIK_LOG(nik::LOG_INFO)
+#define NIK_LOG_WARN NIK_LOG(nik::LOG_WARN)
+#define NIK_LOG_ERROR NIK_LOG(nik::LOG_ERROR)
+/// @}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Records a deferred-format line at the given level to the Logger
+/// @details Usage: NIK_LOG_FMT_TO(myLog, nik::LOG_INFO, "x={} y={}", x, y);
+///     The format must be a string literal with {} for each argument.  Only
+///     the arguments are copied on the calling thread, the formatting is done
+///     by the logger thread or by LogDecode.  Levels are filtered, and LOGGER
+///     and LEVEL evaluated, the same as NIK_LOG_TO.
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_LOG_FMT_TO(LOGGER, LEVEL, FORMAT, ...) \
+    do \
+    { \
+        nik::LogGate<((LEVEL) >= NIK_LOG_MIN_LEVEL)> nikLogGate( \
+            ((LEVEL) >= NIK_LOG_MIN_LEVEL) ? &(LOGGER) : 0, (LEVEL)); \
+        if(nikLogGate.m_Log) \
+        { \
+            static const nik::LogSite nikLogSite((LEVEL), __FILE__, __LINE__, FORMAT); \
+            nikLogGate.m_Log->Record(nikLogSite, ##__VA_ARGS__); \
+        } \
+    } while(0)
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Records a deferred-format line to the global log object
+///////////////////////////////////////////////////////////////////////////////
+#define NIK_LOG_FMT(LEVEL, FORMAT, ...) \
+    NIK_LOG_FMT_TO(nik::GetLog(), LEVEL, FORMAT, ##__VA_ARGS__)
+
 #endif 
 
 ////////////////////////End-of-File////////////////////////////////////////////
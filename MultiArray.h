@@ -1,80 +1,433 @@
 ///////////////////////////////////////////////////////////////////////////////
 /// @file MultiArray.h
 /// @brief Declaration of the MutliArray class
+/// @details Contains the following:
+///     @li MultiArray - N dimensional array sized at run time
+///     @li FixedMultiArray - N dimensional array sized at compile time
 /// @internal
 ///
 /// 03March2010, nik: initial
 /// 21July2010, nik: Removed default initial value template parameter
+/// 14October2026, nik: Stored in one contiguous, aligned buffer
+/// 14October2026, nik: STRIDE_ALIGNED aligns rows of any element size
+/// 14October2026, nik: Added the number of dimensions, views and
+///     FixedMultiArray
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_MULTIARRAY_HEADER
 #define NIK_MULTIARRAY_HEADER
 
-#include <vector>
+#include <Util/ArrayView.h>
+#include <Util/Span.h>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
 
 namespace nik {
 
+namespace MultiArrayDetail {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Checks if a value is all zero bytes, so it can be set by memset
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE>
+bool IsZero(const TYPE& value, std::true_type)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for(size_t i = 0; i < sizeof(TYPE); ++i)
+    {
+        if(bytes[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename TYPE>
+bool IsZero(const TYPE&, std::false_type)
+{
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sets count elements to value in one pass
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE>
+void Fill(TYPE* data, size_t count, const TYPE& value)
+{
+    if(IsZero(value, std::is_trivially_copyable<TYPE>()))
+    {
+        std::memset(static_cast<void*>(data), 0, count * sizeof(TYPE));
+        return;
+    }
+    std::fill(data, data + count, value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Product of the extents
+///////////////////////////////////////////////////////////////////////////////
+template <size_t... EXTENTS>
+struct Product;
+
+template <>
+struct Product<>
+{
+    static const size_t VALUE = 1;
+};
+
+template <size_t FIRST, size_t... REST>
+struct Product<FIRST, REST...>
+{
+    static const size_t VALUE = FIRST * Product<REST...>::VALUE;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Greatest common divisor
+///////////////////////////////////////////////////////////////////////////////
+template <size_t A, size_t B>
+struct Gcd
+{
+    static const size_t VALUE = Gcd<B, A % B>::VALUE;
+};
+
+template <size_t A>
+struct Gcd<A, 0>
+{
+    static const size_t VALUE = A;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Offset of an index in a row major array of the extents
+/// @details The strides are constants, so the arithmetic folds away.
+///////////////////////////////////////////////////////////////////////////////
+template <size_t... EXTENTS>
+struct Offset;
+
+template <>
+struct Offset<>
+{
+    static size_t Get()
+    {
+        return 0;
+    }
+};
+
+template <size_t FIRST, size_t... REST>
+struct Offset<FIRST, REST...>
+{
+    template <typename... ARGS>
+    static size_t Get(size_t index, ARGS... rest)
+    {
+        assert(index < FIRST);
+        return index * Product<REST...>::VALUE + Offset<REST...>::Get(rest...);
+    }
+};
+
+} // end namespace MultiArrayDetail
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @class MultiArray MultiArray.h <Util/MultiArray.h>
-/// @brief Two dimensional array
+/// @brief N dimensional array
+/// @details The elements are kept in one buffer aligned to ALIGNMENT bytes,
+///     in row major order: the last dimension is contiguous.  In two
+///     dimensions element (x, y) is at Data()[x * Stride() + y], so a row is
+///     every element with the same x.  With STRIDE_ALIGNED each row is padded
+///     to start on an ALIGNMENT boundary, which lets kernels use aligned
+///     vector loads on every row.  The padding elements are constructed and
+///     set by SetAll(), but are otherwise unused.
+///
+///     View() gives an ArrayView of the elements, from which sub-blocks,
+///     slices and transposes can be taken without copying.
 /// @tparam TYPE The type of the values stored in the array
+/// @tparam N The number of dimensions
+/// @see nik::FixedMultiArray for sizes known at compile time
 ///////////////////////////////////////////////////////////////////////////////
-template<typename TYPE>
+template<typename TYPE, size_t N = 2>
 class MultiArray
 {
 public:
 
+    static_assert(N > 0, "An array needs at least one dimension");
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Alignment of the buffer, and of the rows with STRIDE_ALIGNED
+    ///////////////////////////////////////////////////////////////////////////
+    static const size_t ALIGNMENT = 64;
+
+    static const size_t DIMENSIONS = N;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The fewest elements that fill whole ALIGNMENT lines
+    /// @details STRIDE_ALIGNED rounds the rows up to a multiple of this.
+    ///     It is one line for a type that divides ALIGNMENT, and more for
+    ///     one that does not, ex. 8 elements of 24 bytes.
+    ///////////////////////////////////////////////////////////////////////////
+    static const size_t ROW_ELEMENTS =
+        ALIGNMENT / MultiArrayDetail::Gcd<ALIGNMENT, sizeof(TYPE)>::VALUE;
+    static_assert(ROW_ELEMENTS * sizeof(TYPE) % ALIGNMENT == 0,
+        "STRIDE_ALIGNED rows cannot be aligned for TYPE");
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief How far apart the rows are
+    ///////////////////////////////////////////////////////////////////////////
+    enum Stride_t
+    {
+        STRIDE_PACKED,  ///< The rows follow each other
+        STRIDE_ALIGNED  ///< Each row starts on an ALIGNMENT boundary
+    };
+
+    typedef Span<TYPE> Row_t;
+    typedef Span<const TYPE> ConstRow_t;
+    typedef ArrayView<TYPE, N> View_t;
+    typedef ArrayView<const TYPE, N> ConstView_t;
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Default constructor
     ///////////////////////////////////////////////////////////////////////////
     MultiArray()
-    {}
+    :
+    m_Raw(0),
+    m_Data(0)
+    {
+        Clear();
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Constructor
     /// @details Creates a two dimensional array given the parameters
     /// @param[in] x The X dimension of the array
     /// @param[in] y The Y dimension of the array
+    /// @param[in] stride How far apart the rows are
     ///////////////////////////////////////////////////////////////////////////
-    MultiArray(int x, int y)
+    template <size_t M = N, typename = typename std::enable_if<M == 2>::type>
+    MultiArray(int x, int y, Stride_t stride = STRIDE_PACKED)
     :
-    m_Array(x, std::vector<TYPE>(y))
+    m_Raw(0),
+    m_Data(0)
     {
+        assert(x >= 0 && y >= 0);
+        const size_t sizes[N] = { size_t(x), size_t(y) };
+        Allocate(sizes, stride, TYPE());
     }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Constructor
-    /// @details Creates a two dimensional array given the parameters and 
+    /// @details Creates a two dimensional array given the parameters and
     ///     sets the default value for all items in the array.
     /// @param[in] x The X dimension of the array
     /// @param[in] y The Y dimension of the array
     /// @param[in] val The default value for all of the array elements
+    /// @param[in] stride How far apart the rows are
     ///////////////////////////////////////////////////////////////////////////
-    MultiArray(int x, int y, TYPE val)
+    template <size_t M = N, typename = typename std::enable_if<M == 2>::type>
+    MultiArray(int x, int y, TYPE val, Stride_t stride = STRIDE_PACKED)
     :
-    m_Array(x, std::vector<TYPE>(y, val))
+    m_Raw(0),
+    m_Data(0)
     {
+        assert(x >= 0 && y >= 0);
+        const size_t sizes[N] = { size_t(x), size_t(y) };
+        Allocate(sizes, stride, val);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Creates an array of any number of dimensions.
+    /// @param[in] sizes The size of each dimension
+    /// @param[in] stride How far apart the rows are
+    ///////////////////////////////////////////////////////////////////////////
+    explicit MultiArray(const size_t (&sizes)[N], Stride_t stride = STRIDE_PACKED)
+    :
+    m_Raw(0),
+    m_Data(0)
+    {
+        Allocate(sizes, stride, TYPE());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] sizes The size of each dimension
+    /// @param[in] val The default value for all of the array elements
+    /// @param[in] stride How far apart the rows are
+    ///////////////////////////////////////////////////////////////////////////
+    MultiArray(const size_t (&sizes)[N], const TYPE& val, Stride_t stride = STRIDE_PACKED)
+    :
+    m_Raw(0),
+    m_Data(0)
+    {
+        Allocate(sizes, stride, val);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy constructor
+    /// @details The copy has the same strides.
+    ///////////////////////////////////////////////////////////////////////////
+    MultiArray(const MultiArray& orig)
+    :
+    m_Raw(0),
+    m_Data(0)
+    {
+        Clear();
+        if(orig.m_Data)
+        {
+            AllocateRaw(orig.m_Size, orig.m_Stride);
+            size_t i = 0;
+            try
+            {
+                for(; i < orig.Capacity(); ++i)
+                {
+                    new(m_Data + i) TYPE(orig.m_Data[i]);
+                }
+            }
+            catch(...)
+            {
+                Destroy(i);
+                throw;
+            }
+        }
+        else
+        {
+            std::copy(orig.m_Size, orig.m_Size + N, m_Size);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Move constructor
+    /// @details Takes the buffer, leaving orig empty.
+    ///////////////////////////////////////////////////////////////////////////
+    MultiArray(MultiArray&& orig)
+    :
+    m_Raw(0),
+    m_Data(0)
+    {
+        Clear();
+        Swap(orig);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    ///////////////////////////////////////////////////////////////////////////
+    ~MultiArray()
+    {
+        Destroy(Capacity());
+    }
+
+    MultiArray& operator=(MultiArray rhs)
+    {
+        Swap(rhs);
+        return *this;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Swaps the contents of two arrays
+    ///////////////////////////////////////////////////////////////////////////
+    void Swap(MultiArray& other)
+    {
+        std::swap(m_Raw, other.m_Raw);
+        std::swap(m_Data, other.m_Data);
+        std::swap_ranges(m_Size, m_Size + N, other.m_Size);
+        std::swap_ranges(m_Stride, m_Stride + N, other.m_Stride);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Get the element reference at the given index
-    /// @param[in] x X dimension
-    /// @param[in] y Y dimension
+    /// @param[in] idx One index per dimension, e.g. (x, y)
     /// @return Reference to the array element
     ///////////////////////////////////////////////////////////////////////////
-    TYPE& operator()(int x, int y)
+    template <typename... ARGS>
+    TYPE& operator()(ARGS... idx)
     {
-        return m_Array[x][y];
+        return m_Data[Offset(idx...)];
     }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Get the element value at the given index
-    /// @param[in] x X dimension
-    /// @param[in] y Y dimension
+    /// @param[in] idx One index per dimension, e.g. (x, y)
     /// @return Element value
     ///////////////////////////////////////////////////////////////////////////
-    const TYPE& operator()(int x, int y) const
+    template <typename... ARGS>
+    const TYPE& operator()(ARGS... idx) const
+    {
+        return m_Data[Offset(idx...)];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a row of the array
+    /// @param[in] idx One index for each dimension but the last, e.g. (x)
+    /// @return The elements along the last dimension, contiguous
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    Row_t Row(ARGS... idx)
+    {
+        return Row_t(m_Data + Offset(idx..., 0), m_Size[N - 1]);
+    }
+
+    template <typename... ARGS>
+    ConstRow_t Row(ARGS... idx) const
+    {
+        return ConstRow_t(m_Data + Offset(idx..., 0), m_Size[N - 1]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a view of the whole array
+    /// @details The view refers to this array's elements, it does not copy
+    ///     them.  It is valid until the array is destroyed or assigned.
+    ///////////////////////////////////////////////////////////////////////////
+    View_t View()
+    {
+        return View_t(m_Data, m_Size, m_Stride);
+    }
+
+    ConstView_t View() const
+    {
+        return ConstView_t(m_Data, m_Size, m_Stride);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the start of the buffer
+    /// @details The pointer is aligned to ALIGNMENT bytes.
+    /// @return The first element, 0 if the array is empty
+    ///////////////////////////////////////////////////////////////////////////
+    TYPE* Data()
+    {
+        return m_Data;
+    }
+
+    const TYPE* Data() const
+    {
+        return m_Data;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the size of a dimension
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Size(size_t dim) const
     {
-        return m_Array[x][y];
+        assert(dim < N);
+        return m_Size[dim];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the distance between consecutive indexes of a dimension
+    /// @return The stride, in elements
+    ///////////////////////////////////////////////////////////////////////////
+    ptrdiff_t Stride(size_t dim) const
+    {
+        assert(dim < N);
+        return m_Stride[dim];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the distance between rows, in elements
+    /// @return SizeRow(), or more if the rows are padded
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Stride() const
+    {
+        return N > 1 ? size_t(m_Stride[N > 1 ? N - 2 : 0]) : m_Size[0];
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -83,7 +436,7 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     size_t SizeCol() const
     {
-        return m_Array.size();
+        return m_Size[0];
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -92,52 +445,248 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     size_t SizeRow() const
     {
-        // Check that the column vector exists
-        return (m_Array.size() > 0) ? m_Array[0].size() : 0;
+        // An array with no elements has no rows
+        for(size_t d = 0; d < N; ++d)
+        {
+            if(m_Size[d] == 0)
+            {
+                return 0;
+            }
+        }
+        return m_Size[N - 1];
     }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Sets all of the array elements to the given value
+    /// @details One pass over the whole buffer, padding included; a memset
+    ///     where the value is all zero bytes.
     /// @param[in] value The value to set for all array elements
     ///////////////////////////////////////////////////////////////////////////
     void SetAll(const TYPE& value)
     {
-        // March through the vectors and set the value
-        // Iterators to the outer vector
-        Array2D_t::iterator itOuter, endOuter;
-        itOuter = m_Array.begin();
-        endOuter = m_Array.end();
-        for(; itOuter != endOuter; ++itOuter)
+        MultiArrayDetail::Fill(m_Data, Capacity(), value);
+    } // end SetAll
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Offset of an element from the first
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    size_t Offset(ARGS... idx) const
+    {
+        static_assert(sizeof...(ARGS) == N, "One index per dimension");
+        const size_t index[N] = { size_t(idx)... };
+        size_t offset = 0;
+        for(size_t d = 0; d < N; ++d)
         {
-            // Iterators to the inner vector
-            Array1D_t::iterator itInner, endInner;
-            itInner = itOuter->begin();
-            endInner = itOuter->end();
-            for(; itInner != endInner; ++itInner)
+            assert(index[d] < m_Size[d] || (d == N - 1 && index[d] == 0));
+            offset += index[d] * size_t(m_Stride[d]);
+        }
+        return offset;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Number of elements in the buffer, padding included
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Capacity() const
+    {
+        return m_Size[0] * size_t(m_Stride[0]);
+    }
+
+    void Clear()
+    {
+        std::fill(m_Size, m_Size + N, size_t(0));
+        std::fill(m_Stride, m_Stride + N, ptrdiff_t(0));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Allocates the buffer and constructs the elements
+    ///////////////////////////////////////////////////////////////////////////
+    void Allocate(const size_t (&sizes)[N], Stride_t stride, const TYPE& val)
+    {
+        ptrdiff_t strides[N];
+        strides[N - 1] = 1;
+        size_t rowSize = sizes[N - 1];
+        if(N > 1 && stride == STRIDE_ALIGNED)
+        {
+            rowSize = (rowSize + ROW_ELEMENTS - 1) / ROW_ELEMENTS * ROW_ELEMENTS;
+        }
+        for(size_t d = N - 1; d > 0; --d)
+        {
+            strides[d - 1] = ptrdiff_t(d == N - 1 ? rowSize : sizes[d] * strides[d]);
+        }
+        Clear();
+        AllocateRaw(sizes, strides);
+        size_t i = 0;
+        try
+        {
+            for(; i < Capacity(); ++i)
             {
-                (*itInner) = value;
+                new(m_Data + i) TYPE(val);
             }
         }
-    } // end SetAll
+        catch(...)
+        {
+            Destroy(i);
+            throw;
+        }
+    } // end Allocate
 
-private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Allocates the buffer, leaving the elements unconstructed
+    ///////////////////////////////////////////////////////////////////////////
+    void AllocateRaw(const size_t (&sizes)[N], const ptrdiff_t (&strides)[N])
+    {
+        static_assert(alignof(TYPE) <= ALIGNMENT, "TYPE is over aligned");
+        std::copy(sizes, sizes + N, m_Size);
+        size_t count = sizes[0] * size_t(strides[0]);
+        if(count == 0)
+        {
+            return;
+        }
+        std::copy(strides, strides + N, m_Stride);
+        m_Raw = ::operator new(count * sizeof(TYPE) + ALIGNMENT - 1);
+        uintptr_t address = reinterpret_cast<uintptr_t>(m_Raw);
+        address = (address + ALIGNMENT - 1) & ~uintptr_t(ALIGNMENT - 1);
+        m_Data = reinterpret_cast<TYPE*>(address);
+    } // end AllocateRaw
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief One dimensional array typedef
+    /// @brief Destroys the first count elements and frees the buffer
     ///////////////////////////////////////////////////////////////////////////
-    typedef std::vector<TYPE> Array1D_t;
+    void Destroy(size_t count)
+    {
+        for(size_t i = 0; i < count; ++i)
+        {
+            m_Data[i].~TYPE();
+        }
+        ::operator delete(m_Raw);
+        m_Raw = 0;
+        m_Data = 0;
+        Clear();
+    } // end Destroy
+
+    void* m_Raw;            ///< The allocation, m_Data rounded up within it
+    TYPE* m_Data;           ///< The first element, aligned
+    size_t m_Size[N];       ///< Size of each dimension
+    ptrdiff_t m_Stride[N];  ///< Stride of each dimension, in elements
+
+}; // end class MultiArray
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class FixedMultiArray MultiArray.h <Util/MultiArray.h>
+/// @brief N dimensional array with its sizes fixed at compile time
+/// @details The elements are held in the object, in row major order, with no
+///     padding.  The strides are constants, so indexing compiles to a
+///     constant offset computation.
+/// @tparam TYPE The type of the values stored in the array
+/// @tparam EXTENTS The size of each dimension
+/// @note The elements are aligned to ALIGNMENT bytes on the stack and in
+///     static storage; new does not honour the alignment before C++17.
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE, size_t... EXTENTS>
+class FixedMultiArray
+{
+public:
+
+    static_assert(sizeof...(EXTENTS) > 0, "An array needs at least one dimension");
+
+    static const size_t ALIGNMENT = 64;
+    static const size_t DIMENSIONS = sizeof...(EXTENTS);
+    static const size_t COUNT = MultiArrayDetail::Product<EXTENTS...>::VALUE;
+
+    typedef ArrayView<TYPE, DIMENSIONS> View_t;
+    typedef ArrayView<const TYPE, DIMENSIONS> ConstView_t;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Two dimensional array typedef
+    /// @brief Default constructor
+    /// @details The elements are default constructed.
     ///////////////////////////////////////////////////////////////////////////
-    typedef std::vector< Array1D_t > Array2D_t;
+    FixedMultiArray()
+    {}
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief The underlying array object
+    /// @brief Constructor
+    /// @param[in] val The default value for all of the array elements
     ///////////////////////////////////////////////////////////////////////////
-    Array2D_t m_Array;
+    explicit FixedMultiArray(const TYPE& val)
+    {
+        SetAll(val);
+    }
 
-}; // end class MultiArray
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the element reference at the given index
+    /// @param[in] idx One index per dimension
+    /// @return Reference to the array element
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    TYPE& operator()(ARGS... idx)
+    {
+        static_assert(sizeof...(ARGS) == DIMENSIONS, "One index per dimension");
+        return m_Data[MultiArrayDetail::Offset<EXTENTS...>::Get(size_t(idx)...)];
+    }
+
+    template <typename... ARGS>
+    const TYPE& operator()(ARGS... idx) const
+    {
+        static_assert(sizeof...(ARGS) == DIMENSIONS, "One index per dimension");
+        return m_Data[MultiArrayDetail::Offset<EXTENTS...>::Get(size_t(idx)...)];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a view of the whole array
+    /// @see MultiArray::View
+    ///////////////////////////////////////////////////////////////////////////
+    View_t View()
+    {
+        return MakeView<TYPE>(m_Data);
+    }
+
+    ConstView_t View() const
+    {
+        return MakeView<const TYPE>(m_Data);
+    }
+
+    TYPE* Data() { return m_Data; }
+    const TYPE* Data() const { return m_Data; }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the size of a dimension
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t Size(size_t dim)
+    {
+        static const size_t sizes[] = { EXTENTS... };
+        assert(dim < DIMENSIONS);
+        return sizes[dim];
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc MultiArray::SetAll
+    ///////////////////////////////////////////////////////////////////////////
+    void SetAll(const TYPE& value)
+    {
+        MultiArrayDetail::Fill(m_Data, COUNT, value);
+    }
+
+private:
+
+    template <typename VIEW_TYPE>
+    static ArrayView<VIEW_TYPE, DIMENSIONS> MakeView(VIEW_TYPE* data)
+    {
+        const size_t sizes[DIMENSIONS] = { EXTENTS... };
+        ptrdiff_t strides[DIMENSIONS];
+        strides[DIMENSIONS - 1] = 1;
+        for(size_t d = DIMENSIONS - 1; d > 0; --d)
+        {
+            strides[d - 1] = strides[d] * ptrdiff_t(sizes[d]);
+        }
+        return ArrayView<VIEW_TYPE, DIMENSIONS>(data, sizes, strides);
+    }
+
+    alignas(ALIGNMENT) TYPE m_Data[COUNT];  ///< The elements
+
+}; // end class FixedMultiArray
 
 } // end namespace nik
 
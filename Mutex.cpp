@@ -5,204 +5,571 @@
 ///
 /// 08May2010, nik: initial
 /// 27May2010, nik: Convert mutex functions into the Mutex class
+/// 14October2026, nik: User-space spin-then-park lock, added RWMutex
+/// 14October2026, nik: Added the Linux futex implementation
+/// 14October2026, nik: Added named mutexes with contention counters
+/// 14October2026, nik: Added WaitWord
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "Mutex.h"
+#include "Timer.h"
 #include "Utility.h"
 
 #include <sstream>
 #include <cassert>
+#include <chrono>
+#include <thread>
+#include <climits>
 
+#ifdef NIK_USE_WINDOWS
 #include <Windows.h>
+#pragma comment(lib, "Synchronization.lib") // WaitOnAddress
+#define NIK_WAIT_FOREVER INFINITE
+#elif defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#define NIK_WAIT_FOREVER static_cast<size_t>(-1)
+#else
+#error "Mutex has no thread parking primitive for this platform"
+#endif
 
-namespace nik {
-
-///////////////////////////////////////////////////////////////////////////////
-/// @class Mutex::MutexImpl Mutex.h <Util\Mutex.h>
-/// @brief Implementation class for Mutex
-/// @details Implements the Mutex functionality.
-/// @note Only supports Windows
-///////////////////////////////////////////////////////////////////////////////
-class Mutex::MutexImpl 
-{
-public:
-
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief Constructor
-    /// @details Mutex resources are aquired on construction
-    /// @attention Throws a nik::Error if the mutex resources could not be
-    ///     aquired.
-    ///////////////////////////////////////////////////////////////////////////
-    MutexImpl();
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#define NIK_CPU_RELAX() _mm_pause()
+#else
+#define NIK_CPU_RELAX() ((void)0)
+#endif
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief Destructor
-    /// @details Mutex resources are released on destruction
-    ///////////////////////////////////////////////////////////////////////////
-    ~MutexImpl();
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief Locks the mutex
-    /// @copydetails Mutex::Lock(size_t)
-    ///////////////////////////////////////////////////////////////////////////
-    bool Lock(size_t timeOut);
+const int MinSpin = 16;     ///< Spin at least this many times before parking
+const int MaxSpin = 4000;   ///< Upper bound on the adaptive spin
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief Unlocks the mutex
-    /// @copydetails Mutex::Unlock()
-    ///////////////////////////////////////////////////////////////////////////
-    bool Unlock();
+typedef std::chrono::steady_clock Clock;
 
-private:
+size_t Remaining(size_t timeOut, Clock::time_point start);
+bool ParkOn(volatile void* word, unsigned int expected, size_t timeOut);
+void WakeOne(void* word);
+void WakeAll(void* word);
 
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief The mutex resource
-    ///////////////////////////////////////////////////////////////////////////
-    HANDLE m_Mutex;
+} // end namespace
 
-}; // end Mutex::MutexImpl
+namespace nik {
 
 //----------------------Mutex-Implementation---------------------------------//
 //----------------------Static-Members---------------------------------------//
-size_t Mutex::FOREVER = INFINITE;
+size_t Mutex::FOREVER = NIK_WAIT_FOREVER;
 //----------------------Public-Implementation--------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 27May2010: nik, initial
+// 14October2026, nik: Added the name
 ///////////////////////////////////////////////////////////////////////////////
-Mutex* Mutex::Create()
+Mutex* Mutex::Create
+    (
+    const char* name
+    )
 {
-    return new Mutex();
+    Mutex* mutex = new Mutex();
+#if NIK_LOCK_STATS
+    if(name)
+    {
+        mutex->m_Stats = new SyncStats(name, SyncStats::KIND_MUTEX);
+    }
+#else
+    (void)name;
+#endif
+    return mutex;
 } // end Mutex::Create
 
 ///////////////////////////////////////////////////////////////////////////////
 // 27May2010: nik, initial
+// 14October2026, nik: Nothing to release for the user-space lock
 ///////////////////////////////////////////////////////////////////////////////
 Mutex::~Mutex()
 {
-    delete m_Impl;
+    delete m_Stats;
 } // end Mutex::~Mutex
 
+//----------------------Private-Implementation-------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 27May2010: nik, initial
 ///////////////////////////////////////////////////////////////////////////////
-bool Mutex::Lock
+Mutex::Mutex()
+:
+m_State(UNLOCKED),
+m_Spin(MinSpin),
+m_Stats(0)
+{
+} // end Mutex::Mutex
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Mutex::LockSlow
     (
     size_t timeOut
     )
 {
-    return m_Impl->Lock(timeOut);
-} // end Mutex::Lock
+    if(timeOut == 0)
+    {
+        return false;
+    }
+
+    // Spin first; the owner is most likely about to release.  The spin limit
+    // follows how long it has recently taken to get the lock by spinning.
+    int spin = m_Spin.load(std::memory_order_relaxed);
+    int limit = spin * 2 < MaxSpin ? spin * 2 : MaxSpin;
+    int count = 0;
+    bool locked = false;
+    for( ; count < limit && !locked; ++count)
+    {
+        locked = m_State.load(std::memory_order_relaxed) == UNLOCKED && try_lock();
+        NIK_CPU_RELAX();
+    }
+    spin += (count - spin) / 8;
+    m_Spin.store(spin > MinSpin ? spin : MinSpin, std::memory_order_relaxed);
+    if(locked)
+    {
+        return true;
+    }
+
+    // Mark the mutex contended so the owner knows to wake us, then park
+    Clock::time_point start = Clock::now();
+    while(m_State.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+    {
+        size_t remaining = Remaining(timeOut, start);
+        if(remaining == 0 || !ParkOn(&m_State, CONTENDED, remaining))
+        {
+            // Leaving the state CONTENDED at worst costs the owner one
+            // unnecessary wake
+            return false;
+        }
+    }
+    return true;
+} // end Mutex::LockSlow
 
 ///////////////////////////////////////////////////////////////////////////////
-// 27May2010: nik, initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-bool Mutex::Unlock()
+void Mutex::WakeWaiter()
 {
-    return m_Impl->Unlock();
-} // end Mutex::Unlock
+    WakeOne(&m_State);
+} // end Mutex::WakeWaiter
 
-//----------------------Private-Implementation-------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
-// 27May2010: nik, initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-Mutex::Mutex()
+bool Mutex::LockCounted
+    (
+    size_t timeOut
+    )
 {
-    m_Impl = new MutexImpl;
-} // end Mutex::Mutex
+    if(try_lock())
+    {
+        m_Stats->RecordWait(false, 0);
+        return true;
+    }
+    uint64_t start = Timer::NowNs();
+    bool locked = LockSlow(timeOut);
+    m_Stats->RecordWait(true, Timer::NowNs() - start);
+    return locked;
+} // end Mutex::LockCounted
+
+//----------------------RWMutex-Implementation-------------------------------//
+//----------------------Static-Members---------------------------------------//
+size_t RWMutex::FOREVER = NIK_WAIT_FOREVER;
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+RWMutex* RWMutex::Create()
+{
+    return new RWMutex();
+} // end RWMutex::Create
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+RWMutex::~RWMutex()
+{
+} // end RWMutex::~RWMutex
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RWMutex::Lock
+    (
+    size_t timeOut
+    )
+{
+    if(try_lock())
+    {
+        return true;
+    }
+
+    Clock::time_point start = Clock::now();
+    int spin = 0;
+    unsigned int state = m_State.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        if((state & (READER_MASK | WRITER)) == 0)
+        {
+            // Free; take it, keeping PARKED so blocked readers get woken
+            if(m_State.compare_exchange_weak(state, WRITER | (state & PARKED),
+                std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        size_t remaining = Remaining(timeOut, start);
+        if(remaining == 0)
+        {
+            // Stop holding off readers; other waiting writers will set the
+            // flag again once woken
+            unsigned int prev = m_State.fetch_and(~(WRITER_WAITING | PARKED),
+                std::memory_order_relaxed);
+            if(prev & PARKED)
+            {
+                WakeAll(&m_State);
+            }
+            return false;
+        }
+
+        if(spin < MinSpin)
+        {
+            ++spin;
+            NIK_CPU_RELAX();
+            state = m_State.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        unsigned int waiting = state | WRITER_WAITING | PARKED;
+        if(state != waiting &&
+            !m_State.compare_exchange_weak(state, waiting, std::memory_order_relaxed))
+        {
+            continue;
+        }
+        ParkOn(&m_State, waiting, remaining);
+        state = m_State.load(std::memory_order_relaxed);
+    }
+} // end RWMutex::Lock
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RWMutex::Unlock()
+{
+    unsigned int prev = m_State.fetch_and(~(WRITER | PARKED),
+        std::memory_order_release);
+    if(prev & PARKED)
+    {
+        WakeAll(&m_State);
+    }
+    return (prev & WRITER) != 0;
+} // end RWMutex::Unlock
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RWMutex::LockShared
+    (
+    size_t timeOut
+    )
+{
+    if(try_lock_shared())
+    {
+        return true;
+    }
+
+    Clock::time_point start = Clock::now();
+    int spin = 0;
+    unsigned int state = m_State.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        if((state & (WRITER | WRITER_WAITING)) == 0)
+        {
+            assert((state & READER_MASK) != READER_MASK);
+            if(m_State.compare_exchange_weak(state, state + 1,
+                std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        size_t remaining = Remaining(timeOut, start);
+        if(remaining == 0)
+        {
+            return false;
+        }
 
+        if(spin < MinSpin)
+        {
+            ++spin;
+            NIK_CPU_RELAX();
+            state = m_State.load(std::memory_order_relaxed);
+            continue;
+        }
 
-//----------------------Mutex::MutexImpl-Implementation----------------------//
+        unsigned int waiting = state | PARKED;
+        if(state != waiting &&
+            !m_State.compare_exchange_weak(state, waiting, std::memory_order_relaxed))
+        {
+            continue;
+        }
+        ParkOn(&m_State, waiting, remaining);
+        state = m_State.load(std::memory_order_relaxed);
+    }
+} // end RWMutex::LockShared
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RWMutex::UnlockShared()
+{
+    unsigned int prev = m_State.fetch_sub(1, std::memory_order_release);
+    assert(prev & READER_MASK);
+    if((prev & READER_MASK) == 1 && (prev & PARKED))
+    {
+        // Last reader out; let the waiting writer in
+        m_State.fetch_and(~PARKED, std::memory_order_relaxed);
+        WakeAll(&m_State);
+    }
+    return (prev & READER_MASK) != 0;
+} // end RWMutex::UnlockShared
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RWMutex::try_lock()
+{
+    unsigned int state = m_State.load(std::memory_order_relaxed);
+    return (state & (READER_MASK | WRITER)) == 0 &&
+        m_State.compare_exchange_strong(state, WRITER | (state & PARKED),
+            std::memory_order_acquire, std::memory_order_relaxed);
+} // end RWMutex::try_lock
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RWMutex::try_lock_shared()
+{
+    unsigned int state = m_State.load(std::memory_order_relaxed);
+    return (state & (WRITER | WRITER_WAITING)) == 0 &&
+        m_State.compare_exchange_strong(state, state + 1,
+            std::memory_order_acquire, std::memory_order_relaxed);
+} // end RWMutex::try_lock_shared
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+RWMutex::RWMutex()
+:
+m_State(0)
+{
+} // end RWMutex::RWMutex
+
+//----------------------WaitWord-Implementation------------------------------//
 //----------------------Static-Members---------------------------------------//
+size_t WaitWord::FOREVER = NIK_WAIT_FOREVER;
 //----------------------Public-Implementation--------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
-// 27May2010: nik, initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-Mutex::MutexImpl::MutexImpl()
+WaitWord::WaitWord()
 :
-m_Mutex(0)
+m_Epoch(0),
+m_Waiters(0)
 {
-    m_Mutex = CreateMutex( 
-        NULL,              // default security attributes
-        FALSE,             // initially not owned
-        NULL);             // unnamed mutex
-    if(!m_Mutex)
+} // end WaitWord::WaitWord
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool WaitWord::Wait
+    (
+    unsigned int epoch,
+    size_t timeOut
+    )
+{
+    bool woken = true;
+    try
+    {
+        // Returns straight away if a wake advanced the epoch already
+        woken = timeOut != 0 && ParkOn(&m_Epoch, epoch, timeOut);
+    }
+    catch(...)
     {
-        assert(0);
-        DWORD errCode = GetLastError();
-        std::ostringstream msg;
-        msg << "Mutex::Mutex - Create mutex failed with code: ";
-        msg << errCode << std::endl;
-        throw Error(msg.str());
+        CancelWait();
+        throw;
     }
-}
+    CancelWait();
+    return woken;
+} // end WaitWord::Wait
 
+//----------------------Private-Implementation-------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
-// 27May2010: nik, initial
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void WaitWord::Wake
+    (
+    bool all
+    )
+{
+    m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+    if(all)
+    {
+        WakeAll(&m_Epoch);
+    }
+    else
+    {
+        WakeOne(&m_Epoch);
+    }
+} // end WaitWord::Wake
+
+} // end namespace nik
+
+//----------------------Free-Function-Implementations------------------------//
+namespace {
 ///////////////////////////////////////////////////////////////////////////////
-Mutex::MutexImpl::~MutexImpl()
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t Remaining
+    (
+    size_t timeOut,
+    Clock::time_point start
+    )
 {
-    CloseHandle(m_Mutex);
-}
+    if(timeOut == nik::Mutex::FOREVER)
+    {
+        return timeOut;
+    }
+    size_t elapsed = static_cast<size_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - start).count());
+    return elapsed < timeOut ? timeOut - elapsed : 0;
+} // end Remaining
 
+#ifdef NIK_USE_WINDOWS
 ///////////////////////////////////////////////////////////////////////////////
-// 27May2010: nik, initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-bool Mutex::MutexImpl::Lock
+bool ParkOn
     (
+    volatile void* word,
+    unsigned int expected,
     size_t timeOut
     )
 {
-    DWORD result = WaitForSingleObject(m_Mutex, timeOut);  
-    // Check for timeout
-    if(result == WAIT_TIMEOUT)
+    // Returns straight away if the word no longer holds the expected value,
+    // so a wake between the caller's check and here is never lost
+    if(WaitOnAddress(word, &expected, sizeof(expected),
+        static_cast<DWORD>(timeOut)))
     {
-        // couldn't get the mutex, return without writing
-        return false;
+        return true;
     }
-    if(result != WAIT_OBJECT_0)
+    DWORD errCode = GetLastError();
+    if(errCode == ERROR_TIMEOUT)
     {
-        assert(false);
-        DWORD errCode = GetLastError();
-        std::ostringstream msg;
-        msg << "Mutex::Lock - Wait failed with code: ";
-        msg << errCode;
-        throw nik::Error(msg.str());
+        return false;
     }
-    return true;
-} // end Mutex::MutexImpl::Lock
+    assert(false);
+    std::ostringstream msg;
+    msg << "Mutex::Lock - Wait failed with code: ";
+    msg << errCode;
+    throw nik::Error(msg.str());
+} // end ParkOn
 
 ///////////////////////////////////////////////////////////////////////////////
-// 27May2010: nik, initial
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void WakeOne
+    (
+    void* word
+    )
+{
+    WakeByAddressSingle(word);
+} // end WakeOne
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-bool Mutex::MutexImpl::Unlock()
+void WakeAll
+    (
+    void* word
+    )
 {
-    // ReleaseMutex returns 0 on failure
-    return ReleaseMutex(m_Mutex) != 0;
-} // end Mutex::MutexImpl::Unlock
+    WakeByAddressAll(word);
+} // end WakeAll
 
+#else // Linux
 ///////////////////////////////////////////////////////////////////////////////
-// 08May2010, nik: initial
+// 14October2026, nik: initial
 ///////////////////////////////////////////////////////////////////////////////
-bool GetMutexLock(HANDLE mutex, DWORD timeout)
+bool ParkOn
+    (
+    volatile void* word,
+    unsigned int expected,
+    size_t timeOut
+    )
 {
-    DWORD result = WaitForSingleObject(mutex, timeout);  
-    // Check for timeout
-    if(result == WAIT_TIMEOUT)
+    timespec relative;
+    timespec* wait = 0;
+    if(timeOut != NIK_WAIT_FOREVER)
     {
-        // couldn't get the mutex, return without writing
-        return false;
+        relative.tv_sec = static_cast<time_t>(timeOut / 1000);
+        relative.tv_nsec = static_cast<long>(timeOut % 1000) * 1000000;
+        wait = &relative;
     }
-    if(result != WAIT_OBJECT_0)
+    // Returns straight away (EAGAIN) if the word no longer holds the
+    // expected value, so a wake between the caller's check and here is
+    // never lost
+    long result = syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, wait, 0, 0);
+    if(result == 0 || errno == EAGAIN || errno == EINTR)
     {
-        DWORD errCode = GetLastError();
-        std::ostringstream msg;
-        msg << "Error: ScopeLock->Wait failed with code: ";
-        msg << errCode << std::endl;
-        throw nik::Error(msg.str());
+        return true;
     }
-    return true;
-} // end GetMutex
+    if(errno == ETIMEDOUT)
+    {
+        return false;
+    }
+    assert(false);
+    std::ostringstream msg;
+    msg << "Mutex::Lock - Wait failed with code: ";
+    msg << errno;
+    throw nik::Error(msg.str());
+} // end ParkOn
 
-} // end namespace nik
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void WakeOne
+    (
+    void* word
+    )
+{
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);
+} // end WakeOne
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void WakeAll
+    (
+    void* word
+    )
+{
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, INT_MAX, 0, 0, 0);
+} // end WakeAll
+#endif
+
+} // end namespace
 
 ////////////////////////End-of-File////////////////////////////////////////////
@@ -5,10 +5,18 @@
 ///
 /// 08May2010, nik: initial
 /// 27May2010, nik: Converted the mutex Windows functions into a mutex class
+/// 14October2026, nik: Replaced the kernel mutex with a user-space lock, added
+///     RWMutex
+/// 14October2026, nik: Added named mutexes with contention counters
+/// 14October2026, nik: Added WaitWord
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_MUTEX_HEADER
 #define NIK_MUTEX_HEADER
 
+#include <Util/SyncStats.h>
+#include <atomic>
+#include <cstddef>
+
 namespace nik {
 
 
@@ -18,9 +26,19 @@ namespace nik {
 /// @details Mutex object that allows for the locking and unlocking of a mutex.
 ///     This object is created through the Create() function and should be 
 ///     freed with the delete operator.
-/// @attention Only un-named mutexes are currently supported.  Additional 
-///     functionality will be implemented as needed.
-/// @note Mutex currently only supports Windows
+///
+///     The mutex is a single word in user space.  An uncontended Lock() or
+///     Unlock() is one atomic operation inline; a contended Lock() spins for
+///     a short, adaptive period and then parks the thread in the kernel until
+///     the owner releases the mutex.
+///
+///     lock(), unlock() and try_lock() are provided so the mutex can be used
+///     with std::lock_guard and std::unique_lock.
+///     A mutex may be given a name.  In a NIK_LOCK_STATS build a named
+///     mutex counts its locks, contended locks and wait times, see
+///     SyncStats.  The name is not visible to other processes.
+/// @attention The mutex is not recursive.
+/// @note Parks with WaitOnAddress on Windows and a futex on Linux
 ///////////////////////////////////////////////////////////////////////////////
 class Mutex
 {
@@ -30,8 +48,10 @@ public:
     /// @brief Creates a new Mutex object
     /// @details This function creates a mutex that is ready to be used.
     /// @attention The returned pointer created with new.
+    /// @param[in] name Name the counters are reported under, or 0 for a
+    ///     mutex that is not counted
     ///////////////////////////////////////////////////////////////////////////
-    static Mutex* Create();
+    static Mutex* Create(const char* name = 0);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Destructor
@@ -48,17 +68,64 @@ public:
     ///         @arg false - The mutex was not aquired due to timeout
     /// @see FOREVER
     ///////////////////////////////////////////////////////////////////////////
-    bool Lock(size_t timeOut = FOREVER);
+    bool Lock(size_t timeOut = FOREVER)
+    {
+#if NIK_LOCK_STATS
+        if(m_Stats)
+        {
+            return LockCounted(timeOut);
+        }
+#endif
+        return try_lock() || LockSlow(timeOut);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Releases the mutex
     /// @details Unlocks the mutex.  The mutex should be owned by the calling
     ///     thread.
     /// @return @arg true - Lock has been released
-    ///         @arg false - The mutex is not currently locked by the calling
-    ///         thread.
+    ///         @arg false - The mutex is not currently locked
     ///////////////////////////////////////////////////////////////////////////
-    bool Unlock();
+    bool Unlock()
+    {
+        int prev = m_State.exchange(UNLOCKED, std::memory_order_release);
+        if(prev == CONTENDED)
+        {
+            WakeWaiter();
+        }
+        return prev != UNLOCKED;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Locks the mutex, waiting forever
+    /// @details Standard library Lockable interface
+    ///////////////////////////////////////////////////////////////////////////
+    void lock() { Lock(FOREVER); }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Releases the mutex
+    /// @details Standard library Lockable interface
+    ///////////////////////////////////////////////////////////////////////////
+    void unlock() { Unlock(); }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Attempts to lock the mutex without waiting
+    /// @details Standard library Lockable interface
+    /// @return @arg true - The mutex has been locked
+    ///         @arg false - The mutex is owned by another thread
+    ///////////////////////////////////////////////////////////////////////////
+    bool try_lock()
+    {
+        int expected = UNLOCKED;
+        return m_State.compare_exchange_strong(expected, LOCKED,
+            std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the counters of a named mutex
+    /// @return The counters, or 0 if the mutex is not counted
+    ///////////////////////////////////////////////////////////////////////////
+    SyncStats* GetStats() const { return m_Stats; }
 
     static size_t FOREVER; ///< Flags Lock(size_t) to wait forever for the lock
 
@@ -66,7 +133,7 @@ private:
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Constructor
-    /// @details On construction, the mutex resources are aquired.
+    /// @details The mutex starts unlocked.
     /// @attention Use Create() to create a mutex object.
     /// @note Construction is disallowed in client code.
     ///////////////////////////////////////////////////////////////////////////
@@ -82,15 +149,271 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     Mutex& operator=(const Mutex&);
 
-    class MutexImpl; // Implementation clas for Mutex
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Contended path of Lock(size_t)
+    /// @details Spins, then parks the thread until the mutex is released or
+    ///     the time out expires.
+    /// @copydetails Mutex::Lock(size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    bool LockSlow(size_t timeOut);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wakes one thread parked in LockSlow(size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    void WakeWaiter();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Lock(size_t) of a counted mutex
+    /// @details Times the contended path and records it in m_Stats.
+    /// @copydetails Mutex::Lock(size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    bool LockCounted(size_t timeOut);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Values of m_State
+    ///////////////////////////////////////////////////////////////////////////
+    enum State
+    {
+        UNLOCKED,   ///< Not owned
+        LOCKED,     ///< Owned, no thread is parked
+        CONTENDED   ///< Owned, threads may be parked waiting for the mutex
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The lock word
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<int> m_State;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Running estimate of how long to spin before parking
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<int> m_Spin;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief The implementation object for this Mutex.
+    /// @brief Counters of a named mutex, 0 if the mutex is not counted
     ///////////////////////////////////////////////////////////////////////////
-    MutexImpl* m_Impl;
+    SyncStats* m_Stats;
 
 }; // end class Mutex
 
+///////////////////////////////////////////////////////////////////////////////
+/// @class RWMutex Mutex.h <Util\Mutex.h>
+/// @brief Reader/writer mutex
+/// @details Any number of readers may hold the mutex at once, or a single
+///     writer.  Intended for read-mostly data where readers should not
+///     serialize on each other.  A waiting writer blocks new readers so that
+///     writers are not starved.
+///
+///     Lock()/Unlock() take the mutex exclusively and LockShared()/
+///     UnlockShared() take it for reading.  The standard library Lockable and
+///     SharedLockable interfaces are also provided.
+///
+///     This object is created through the Create() function and should be
+///     freed with the delete operator.
+/// @attention The mutex is not recursive, and a reader cannot upgrade to a
+///     writer.
+/// @see nik::Mutex
+///////////////////////////////////////////////////////////////////////////////
+class RWMutex
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Creates a new RWMutex object
+    /// @attention The returned pointer created with new.
+    ///////////////////////////////////////////////////////////////////////////
+    static RWMutex* Create();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    ///////////////////////////////////////////////////////////////////////////
+    ~RWMutex();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Attempts to lock the mutex for writing
+    /// @details Waits the given amount of time for all readers and writers to
+    ///     release the mutex.  Use FOREVER to disable the time out.
+    /// @attention Throws nik::Error if there was an error aquiring the lock
+    /// @return @arg true - The mutex has been locked
+    ///         @arg false - The mutex was not aquired due to timeout
+    ///////////////////////////////////////////////////////////////////////////
+    bool Lock(size_t timeOut = FOREVER);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Releases a write lock
+    /// @return @arg true - Lock has been released
+    ///         @arg false - The mutex is not currently write locked
+    ///////////////////////////////////////////////////////////////////////////
+    bool Unlock();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Attempts to lock the mutex for reading
+    /// @details Waits the given amount of time for the writer to release the
+    ///     mutex.  Use FOREVER to disable the time out.
+    /// @attention Throws nik::Error if there was an error aquiring the lock
+    /// @return @arg true - The mutex has been locked
+    ///         @arg false - The mutex was not aquired due to timeout
+    ///////////////////////////////////////////////////////////////////////////
+    bool LockShared(size_t timeOut = FOREVER);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Releases a read lock
+    /// @return @arg true - Lock has been released
+    ///         @arg false - The mutex is not currently read locked
+    ///////////////////////////////////////////////////////////////////////////
+    bool UnlockShared();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Standard library Lockable and SharedLockable interface
+    ///////////////////////////////////////////////////////////////////////////
+    void lock() { Lock(FOREVER); }
+    void unlock() { Unlock(); }
+    bool try_lock();
+    void lock_shared() { LockShared(FOREVER); }
+    void unlock_shared() { UnlockShared(); }
+    bool try_lock_shared();
+
+    static size_t FOREVER; ///< Flags Lock(size_t) to wait forever for the lock
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @attention Use Create() to create a mutex object.
+    ///////////////////////////////////////////////////////////////////////////
+    RWMutex();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy construction has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    RWMutex(const RWMutex&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    RWMutex& operator=(const RWMutex&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Bits of m_State
+    ///////////////////////////////////////////////////////////////////////////
+    enum StateBits
+    {
+        READER_MASK    = 0x0FFFFFFF,  ///< Number of readers holding the mutex
+        WRITER         = 0x10000000,  ///< A writer holds the mutex
+        WRITER_WAITING = 0x20000000,  ///< A writer is waiting, readers back off
+        PARKED         = 0x40000000   ///< Threads may be parked on m_State
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The lock word, a combination of StateBits
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<unsigned int> m_State;
+
+}; // end class RWMutex
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class WaitWord Mutex.h <Util\Mutex.h>
+/// @brief Parks threads until another thread reports a change
+/// @details For lock-free structures that only want to block when they
+///     have to, ex. a queue that is empty.  A waiter calls PrepareWait(),
+///     checks its condition again, and then calls Wait() or CancelWait().
+///     A notifier makes the condition true and then calls NotifyOne() or
+///     NotifyAll().  A notify that happens after PrepareWait() is never
+///     lost, and a notify with no waiters is a load and a fence, without a
+///     system call.
+/// @code
+///     while( !queue.TryPop(item))
+///     {
+///         unsigned int epoch = notEmpty.PrepareWait();
+///         if(queue.TryPop(item))
+///         {
+///             notEmpty.CancelWait();
+///             break;
+///         }
+///         notEmpty.Wait(epoch, WaitWord::FOREVER);
+///     }
+/// @endcode
+/// @note Parks on the same primitives as Mutex
+///////////////////////////////////////////////////////////////////////////////
+class WaitWord
+{
+public:
+
+    WaitWord();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Announce a wait
+    /// @return The epoch to pass to Wait(unsigned int, size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned int PrepareWait()
+    {
+        m_Waiters.fetch_add(1, std::memory_order_seq_cst);
+        return m_Epoch.load(std::memory_order_seq_cst);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Withdraw a wait announced by PrepareWait()
+    ///////////////////////////////////////////////////////////////////////////
+    void CancelWait()
+    {
+        m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Park until notified after PrepareWait()
+    /// @details May also return early; the caller checks its condition
+    ///     again either way.
+    /// @param[in] epoch The value returned by PrepareWait()
+    /// @param[in] timeOut The longest time to wait in ms, or FOREVER
+    /// @return @arg true - Notified, or returned early
+    ///         @arg false - Timed out
+    ///////////////////////////////////////////////////////////////////////////
+    bool Wait(unsigned int epoch, size_t timeOut);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wake one waiting thread, if there is one
+    ///////////////////////////////////////////////////////////////////////////
+    void NotifyOne()
+    {
+        // Order the caller's change before reading the waiters, pairs with
+        // the increment in PrepareWait()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(m_Waiters.load(std::memory_order_relaxed) != 0)
+        {
+            Wake(false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wake every waiting thread
+    ///////////////////////////////////////////////////////////////////////////
+    void NotifyAll()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(m_Waiters.load(std::memory_order_relaxed) != 0)
+        {
+            Wake(true);
+        }
+    }
+
+    static size_t FOREVER; ///< Flags Wait(unsigned int, size_t) to wait forever
+
+private:
+
+    WaitWord(const WaitWord&);
+    WaitWord& operator=(const WaitWord&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Advance the epoch and wake one or every parked thread
+    ///////////////////////////////////////////////////////////////////////////
+    void Wake(bool all);
+
+    std::atomic<unsigned int> m_Epoch;  ///< Changed by every wake, parked on
+    std::atomic<int> m_Waiters;         ///< Threads between PrepareWait() and
+                                        ///< the end of Wait()
+
+}; // end class WaitWord
+
 } // end namespace nik
 
 #endif
@@ -0,0 +1,895 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\NikBench.cpp
+/// @brief Micro-benchmarks of the library's hot paths
+/// @details Usage: nik_bench [-o <json file>] [-q] [-t <threads>]
+///     [-f <group>] [-d <dir>]
+///     @li -o Writes the results as JSON to the file, standard out otherwise
+///     @li -q Quick run, a twentieth of the operations
+///     @li -t The most threads a benchmark uses, the core count by default
+///     @li -f Only runs the groups whose name contains the text, ex. mutex
+///     @li -d Directory for the log file of the logger group, . by default
+///
+///     The groups are logger, mutex, postboard, multiarray, callback and
+///     threadcoord.  A line per result is written to standard error as it
+///     completes.  Each JSON result has the benchmark name, its parameters,
+///     the operation count, the elapsed seconds, ns_per_op, ops_per_sec and
+///     any extra metrics, ex. latency percentiles in nanoseconds.
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: Added logger.mapped
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CallBack.h"
+#include "CmdLine.h"
+#include "LatencyHistogram.h"
+#include "Logger.h"
+#include "MultiArray.h"
+#include "Mutex.h"
+#include "ScopeLock.h"
+#include "ThreadObj.h"
+#include "Timer.h"
+#include "postboard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief What to run, from the command line
+///////////////////////////////////////////////////////////////////////////////
+struct Options
+{
+    bool m_Quick;               ///< Run a twentieth of the operations
+    size_t m_MaxThreads;        ///< Most threads a benchmark uses
+    std::string m_Filter;       ///< Only groups containing this, if not empty
+    std::string m_Dir;          ///< Directory for the logger's file
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Scale an operation count for a quick run
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t Scale(uint64_t ops) const
+    {
+        return m_Quick ? (ops + 19) / 20 : ops;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Check a group is selected
+    ///////////////////////////////////////////////////////////////////////////
+    bool Selects(const char* group) const
+    {
+        return m_Filter.empty() || std::string(group).find(m_Filter) != std::string::npos;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The measurements of one benchmark
+///////////////////////////////////////////////////////////////////////////////
+struct Result
+{
+    typedef std::vector<std::pair<std::string, uint64_t> > Params_t;
+    typedef std::vector<std::pair<std::string, double> > Metrics_t;
+
+    std::string m_Name;
+    Params_t m_Params;          ///< ex. threads, observers
+    uint64_t m_Ops;             ///< Operations timed
+    uint64_t m_ElapsedNs;       ///< Time taken by the operations
+    Metrics_t m_Metrics;        ///< Extra measurements
+
+    Result(const std::string& name, uint64_t ops, uint64_t elapsedNs)
+    :
+    m_Name(name),
+    m_Ops(ops),
+    m_ElapsedNs(elapsedNs ? elapsedNs : 1)
+    {}
+
+    Result& Param(const char* name, uint64_t value)
+    {
+        m_Params.push_back(std::make_pair(std::string(name), value));
+        return *this;
+    }
+
+    Result& Metric(const char* name, double value)
+    {
+        m_Metrics.push_back(std::make_pair(std::string(name), value));
+        return *this;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Add the p50, p99, p999 and max of a histogram, in nanoseconds
+    ///////////////////////////////////////////////////////////////////////////
+    Result& Latency(const nik::LatencyHistogram& histogram);
+
+    double NsPerOp() const
+    {
+        return m_Ops ? double(m_ElapsedNs) / double(m_Ops) : 0.0;
+    }
+
+    double OpsPerSec() const
+    {
+        return double(m_Ops) * 1e9 / double(m_ElapsedNs);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Collects the results and writes them out
+///////////////////////////////////////////////////////////////////////////////
+class Report
+{
+public:
+
+    explicit Report(const Options& options) : m_Options(options) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Keep a result and write its line to standard error
+    ///////////////////////////////////////////////////////////////////////////
+    void Add(const Result& result);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Write every result as one JSON object
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteJson(std::ostream& out) const;
+
+private:
+    const Options& m_Options;
+    std::vector<Result> m_Results;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Run func(index) on threads started together
+/// @details Every thread is created before any starts its work, so thread
+///     creation is not timed.
+/// @return The time the threads were released, see nik::Timer::NowNs()
+///////////////////////////////////////////////////////////////////////////////
+uint64_t RunThreads(size_t threads, const std::function<void(size_t)>& func);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The thread counts to run at: powers of two up to the most allowed
+/// @param[in] least The fewest threads worth running
+///////////////////////////////////////////////////////////////////////////////
+std::vector<size_t> ThreadCounts(const Options& options, size_t least);
+
+void BenchLogger(const Options& options, Report& report);
+void BenchMutex(const Options& options, Report& report);
+void BenchPostBoard(const Options& options, Report& report);
+void BenchMultiArray(const Options& options, Report& report);
+void BenchCallBack(const Options& options, Report& report);
+void BenchThreadCoord(const Options& options, Report& report);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Results are added to this so the compiler keeps the work
+///////////////////////////////////////////////////////////////////////////////
+volatile uint64_t g_Sink = 0;
+
+} // end namespace
+
+//----------------------Main-------------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+int main
+    (
+    int argc,
+    char** argv
+    )
+{
+    nik::CmdLine cmdLine(argc, argv);
+    if(cmdLine.IsFlagSet('h'))
+    {
+        std::cerr << "Usage: nik_bench [-o <json file>] [-q] [-t <threads>] "
+            "[-f <group>] [-d <dir>]\n";
+        return 0;
+    }
+
+    Options options;
+    options.m_Quick = cmdLine.IsFlagSet('q');
+    options.m_MaxThreads = std::thread::hardware_concurrency();
+    const char* threads = cmdLine.GetArg('t');
+    if(threads && *threads)
+    {
+        options.m_MaxThreads = strtoul(threads, 0, 10);
+    }
+    if(options.m_MaxThreads < 2)
+    {
+        options.m_MaxThreads = 2;
+    }
+    const char* filter = cmdLine.GetArg('f');
+    options.m_Filter = filter ? filter : "";
+    const char* dir = cmdLine.GetArg('d');
+    options.m_Dir = dir && *dir ? dir : ".";
+
+    const char* outName = cmdLine.GetArg('o');
+    std::ofstream outFile;
+    if(outName && *outName)
+    {
+        outFile.open(outName);
+        if( !outFile)
+        {
+            std::cerr << "Unable to open " << outName << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = outFile.is_open() ? outFile : std::cout;
+
+    Report report(options);
+    if(options.Selects("logger"))
+    {
+        BenchLogger(options, report);
+    }
+    if(options.Selects("mutex"))
+    {
+        BenchMutex(options, report);
+    }
+    if(options.Selects("postboard"))
+    {
+        BenchPostBoard(options, report);
+    }
+    if(options.Selects("multiarray"))
+    {
+        BenchMultiArray(options, report);
+    }
+    if(options.Selects("callback"))
+    {
+        BenchCallBack(options, report);
+    }
+    if(options.Selects("threadcoord"))
+    {
+        BenchThreadCoord(options, report);
+    }
+
+    report.WriteJson(out);
+    out.flush();
+    return out ? 0 : 1;
+} // end main
+
+//----------------------Free-Function-Implementations------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Result& Result::Latency
+    (
+    const nik::LatencyHistogram& histogram
+    )
+{
+    nik::LatencyHistogram::Snapshot snapshot = histogram.GetSnapshot();
+    Metric("p50_ns", snapshot.Percentile(50));
+    Metric("p99_ns", snapshot.Percentile(99));
+    Metric("p999_ns", snapshot.Percentile(99.9));
+    Metric("max_ns", snapshot.Max());
+    return *this;
+} // end Result::Latency
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Report::Add
+    (
+    const Result& result
+    )
+{
+    m_Results.push_back(result);
+
+    std::ostringstream line;
+    line << std::left << std::setw(32) << result.m_Name;
+    for(size_t i = 0; i < result.m_Params.size(); ++i)
+    {
+        line << " " << result.m_Params[i].first << "=" << result.m_Params[i].second;
+    }
+    line << std::fixed << std::setprecision(2) << "  " << result.NsPerOp() << " ns/op";
+    for(size_t i = 0; i < result.m_Metrics.size(); ++i)
+    {
+        line << "  " << result.m_Metrics[i].first << "=" << result.m_Metrics[i].second;
+    }
+    std::cerr << line.str() << std::endl;
+} // end Report::Add
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Report::WriteJson
+    (
+    std::ostream& out
+    ) const
+{
+    // The names are all plain identifiers, so nothing needs escaping
+    out << "{\n"
+        << "  \"suite\": \"nik_bench\",\n"
+        << "  \"quick\": " << (m_Options.m_Quick ? "true" : "false") << ",\n"
+        << "  \"max_threads\": " << m_Options.m_MaxThreads << ",\n"
+        << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+        << "  \"results\": [";
+    out << std::fixed << std::setprecision(3);
+    for(size_t r = 0; r < m_Results.size(); ++r)
+    {
+        const Result& result = m_Results[r];
+        out << (r ? ",\n" : "\n")
+            << "    {\"name\": \"" << result.m_Name << "\", \"params\": {";
+        for(size_t i = 0; i < result.m_Params.size(); ++i)
+        {
+            out << (i ? ", " : "") << "\"" << result.m_Params[i].first << "\": "
+                << result.m_Params[i].second;
+        }
+        out << "}, \"ops\": " << result.m_Ops
+            << ", \"seconds\": " << std::setprecision(6) << result.m_ElapsedNs / 1e9
+            << std::setprecision(3)
+            << ", \"ns_per_op\": " << result.NsPerOp()
+            << ", \"ops_per_sec\": " << result.OpsPerSec();
+        for(size_t i = 0; i < result.m_Metrics.size(); ++i)
+        {
+            out << ", \"" << result.m_Metrics[i].first << "\": " << result.m_Metrics[i].second;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+} // end Report::WriteJson
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t RunThreads
+    (
+    size_t threads,
+    const std::function<void(size_t)>& func
+    )
+{
+    std::atomic<size_t> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for(size_t i = 0; i < threads; ++i)
+    {
+        workers.push_back(std::thread([&, i]()
+            {
+                ready.fetch_add(1);
+                while( !go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                func(i);
+            }));
+    }
+    while(ready.load() < threads)
+    {
+        std::this_thread::yield();
+    }
+    uint64_t start = nik::Timer::NowNs();
+    go.store(true, std::memory_order_release);
+    for(size_t i = 0; i < threads; ++i)
+    {
+        workers[i].join();
+    }
+    return start;
+} // end RunThreads
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+std::vector<size_t> ThreadCounts
+    (
+    const Options& options,
+    size_t least
+    )
+{
+    std::vector<size_t> counts;
+    for(size_t threads = least; threads <= options.m_MaxThreads; threads *= 2)
+    {
+        counts.push_back(threads);
+    }
+    return counts;
+} // end ThreadCounts
+
+//----------------------Logger-----------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void BenchLogger
+    (
+    const Options& options,
+    Report& report
+    )
+{
+    const std::string path = options.m_Dir + "/nik_bench.log";
+    const uint64_t lines = options.Scale(400000);
+    const std::vector<size_t> counts = ThreadCounts(options, 1);
+
+    // Text to a stream, binary to a stream and binary to a mapped file
+    const char* const names[] = {"logger.stream", "logger.deferred", "logger.mapped"};
+    for(int variant = 0; variant < 3; ++variant)
+    {
+        const bool deferred = variant > 0;
+        const bool mapped = variant == 2;
+        for(size_t c = 0; c < counts.size(); ++c)
+        {
+            const size_t threads = counts[c];
+            const uint64_t perThread = lines / threads;
+            nik::LatencyHistogram latency;
+            uint64_t start;
+            {
+                // A mapped file would rotate the last run's file out of the way
+                std::remove(path.c_str());
+                nik::Logger logger;
+                logger.SetOutputFormat(deferred ? nik::Logger::BINARY_OUTPUT : nik::Logger::TEXT_OUTPUT);
+                bool opened = mapped ?
+                    logger.SetFile(path.c_str(), nik::LogFileOptions()) :
+                    logger.SetFile(path.c_str());
+                if( !opened)
+                {
+                    std::cerr << "Unable to open " << path << ", skipping the logger\n";
+                    return;
+                }
+                start = RunThreads(threads, [&](size_t thread)
+                    {
+                        for(uint64_t i = 0; i < perThread; ++i)
+                        {
+                            nik::ScopedTimer timer(latency);
+                            if(deferred)
+                            {
+                                NIK_LOG_FMT_TO(logger, nik::LOG_INFO, "bench line {} thread {}", i, thread);
+                            }
+                            else
+                            {
+                                NIK_LOG_TO(logger, nik::LOG_INFO) << "bench line " << i << " thread " << thread;
+                            }
+                        }
+                    });
+                // The destructor writes out whatever is still buffered, so
+                // the throughput includes getting every line to the file
+            }
+            uint64_t elapsed = nik::Timer::NowNs() - start;
+            report.Add(Result(names[variant], perThread * threads, elapsed)
+                .Param("threads", threads)
+                .Latency(latency));
+        }
+    }
+    std::remove(path.c_str());
+} // end BenchLogger
+
+//----------------------Mutex------------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void BenchMutex
+    (
+    const Options& options,
+    Report& report
+    )
+{
+    const uint64_t ops = options.Scale(20000000);
+    nik::Mutex* mutex = nik::Mutex::Create();
+    std::mutex stdMutex;
+    uint64_t counter = 0;
+
+    uint64_t start = nik::Timer::NowNs();
+    for(uint64_t i = 0; i < ops; ++i)
+    {
+        mutex->Lock();
+        ++counter;
+        mutex->Unlock();
+    }
+    report.Add(Result("mutex.uncontended", ops, nik::Timer::NowNs() - start));
+
+    start = nik::Timer::NowNs();
+    for(uint64_t i = 0; i < ops; ++i)
+    {
+        nik::ScopeLock lock(mutex);
+        ++counter;
+    }
+    report.Add(Result("scopelock.uncontended", ops, nik::Timer::NowNs() - start));
+
+    start = nik::Timer::NowNs();
+    for(uint64_t i = 0; i < ops; ++i)
+    {
+        std::lock_guard<std::mutex> lock(stdMutex);
+        ++counter;
+    }
+    report.Add(Result("std_mutex.uncontended", ops, nik::Timer::NowNs() - start));
+
+    // Contended: every thread increments the one counter under the lock
+    const std::vector<size_t> counts = ThreadCounts(options, 2);
+    const uint64_t contendedOps = options.Scale(4000000);
+    for(size_t c = 0; c < counts.size(); ++c)
+    {
+        const size_t threads = counts[c];
+        const uint64_t perThread = contendedOps / threads;
+
+        counter = 0;
+        start = RunThreads(threads, [&](size_t)
+            {
+                for(uint64_t i = 0; i < perThread; ++i)
+                {
+                    nik::ScopeLock lock(mutex);
+                    ++counter;
+                }
+            });
+        uint64_t elapsed = nik::Timer::NowNs() - start;
+        if(counter != perThread * threads)
+        {
+            std::cerr << "scopelock.contended lost updates\n";
+        }
+        report.Add(Result("scopelock.contended", perThread * threads, elapsed)
+            .Param("threads", threads));
+
+        counter = 0;
+        start = RunThreads(threads, [&](size_t)
+            {
+                for(uint64_t i = 0; i < perThread; ++i)
+                {
+                    std::lock_guard<std::mutex> lock(stdMutex);
+                    ++counter;
+                }
+            });
+        elapsed = nik::Timer::NowNs() - start;
+        report.Add(Result("std_mutex.contended", perThread * threads, elapsed)
+            .Param("threads", threads));
+    }
+    g_Sink += counter;
+    delete mutex;
+} // end BenchMutex
+
+//----------------------PostBoard--------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Observer that sums the posted values
+///////////////////////////////////////////////////////////////////////////////
+class SumObserver : public nik::Observer<nik::Post<uint64_t> >
+{
+public:
+    SumObserver() : m_Sum(0) {}
+    uint64_t m_Sum;
+private:
+    virtual void notify(const NotifyDataType& post)
+    {
+        m_Sum += post.getData();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void BenchPostBoard
+    (
+    const Options& options,
+    Report& report
+    )
+{
+    static const size_t OBSERVERS[] = { 0, 1, 4, 16, 64, 256 };
+    const uint64_t notifies = options.Scale(20000000);
+    for(size_t o = 0; o < sizeof(OBSERVERS) / sizeof(OBSERVERS[0]); ++o)
+    {
+        const size_t observers = OBSERVERS[o];
+        const uint64_t posts = std::max<uint64_t>(
+            notifies / std::max<size_t>(observers, 1), options.Scale(200000));
+
+        nik::PostBoard<uint64_t> board;
+        std::vector<SumObserver> sums(observers);
+        for(size_t i = 0; i < observers; ++i)
+        {
+            board.registerObs(&sums[i]);
+        }
+
+        // Remove each post so the table stays small and only the post and
+        // the fan-out are measured
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < posts; ++i)
+        {
+            board.remove(board.post(i));
+        }
+        uint64_t elapsed = nik::Timer::NowNs() - start;
+
+        Result result("postboard.post", posts, elapsed);
+        result.Param("observers", observers);
+        if(observers)
+        {
+            result.Metric("ns_per_notify", double(elapsed) / double(posts * observers));
+        }
+        report.Add(result);
+        for(size_t i = 0; i < observers; ++i)
+        {
+            g_Sink += sums[i].m_Sum;
+            board.unregisterObs(&sums[i]);
+        }
+    }
+} // end BenchPostBoard
+
+//----------------------MultiArray-------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void BenchMultiArray
+    (
+    const Options& options,
+    Report& report
+    )
+{
+    typedef nik::MultiArray<double, 2> Array_t;
+
+    // A 1000 x 1000 array of doubles is bigger than most L2 caches; the odd
+    // row length leaves room for padding with STRIDE_ALIGNED
+    const size_t rows = 1000;
+    const size_t cols = 1003;
+    const uint64_t elements = uint64_t(rows) * cols;
+    const uint64_t passes = options.Scale(40);
+
+    for(int aligned = 0; aligned < 2; ++aligned)
+    {
+        Array_t array(int(rows), int(cols), 1.0,
+            aligned ? Array_t::STRIDE_ALIGNED : Array_t::STRIDE_PACKED);
+        const char* suffix = aligned ? "_aligned" : "";
+        double sum = 0;
+
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t p = 0; p < passes; ++p)
+        {
+            for(size_t x = 0; x < rows; ++x)
+            {
+                for(size_t y = 0; y < cols; ++y)
+                {
+                    sum += array(x, y);
+                }
+            }
+        }
+        uint64_t elapsed = nik::Timer::NowNs() - start;
+        report.Add(Result(std::string("multiarray.index_row_major") + suffix,
+                elements * passes, elapsed)
+            .Metric("gb_per_sec", elements * passes * sizeof(double) / double(elapsed)));
+
+        start = nik::Timer::NowNs();
+        for(uint64_t p = 0; p < passes; ++p)
+        {
+            for(size_t y = 0; y < cols; ++y)
+            {
+                for(size_t x = 0; x < rows; ++x)
+                {
+                    sum += array(x, y);
+                }
+            }
+        }
+        elapsed = nik::Timer::NowNs() - start;
+        report.Add(Result(std::string("multiarray.index_column_major") + suffix,
+                elements * passes, elapsed)
+            .Metric("gb_per_sec", elements * passes * sizeof(double) / double(elapsed)));
+
+        start = nik::Timer::NowNs();
+        for(uint64_t p = 0; p < passes; ++p)
+        {
+            for(size_t x = 0; x < rows; ++x)
+            {
+                for(double value : array.Row(x))
+                {
+                    sum += value;
+                }
+            }
+        }
+        elapsed = nik::Timer::NowNs() - start;
+        report.Add(Result(std::string("multiarray.row_span") + suffix,
+                elements * passes, elapsed)
+            .Metric("gb_per_sec", elements * passes * sizeof(double) / double(elapsed)));
+
+        start = nik::Timer::NowNs();
+        for(uint64_t p = 0; p < passes; ++p)
+        {
+            array.View().Transpose().ForEach([&sum](double value) { sum += value; });
+        }
+        elapsed = nik::Timer::NowNs() - start;
+        report.Add(Result(std::string("multiarray.view_transposed") + suffix,
+                elements * passes, elapsed)
+            .Metric("gb_per_sec", elements * passes * sizeof(double) / double(elapsed)));
+
+        g_Sink += uint64_t(sum);
+    }
+} // end BenchMultiArray
+
+//----------------------CallBack---------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Functor that counts its calls through the virtual interface
+///////////////////////////////////////////////////////////////////////////////
+class CountFunctor : public nik::GenericFunctor
+{
+public:
+    explicit CountFunctor(uint64_t* count) : m_Count(count) {}
+    virtual void CallFunc() { ++*m_Count; }
+private:
+    uint64_t* m_Count;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void BenchCallBack
+    (
+    const Options& options,
+    Report& report
+    )
+{
+    const uint64_t ops = options.Scale(50000000);
+    uint64_t count = 0;
+
+    {
+        nik::CallBack callBack([&count]() { ++count; });
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < ops; ++i)
+        {
+            callBack.Call();
+        }
+        report.Add(Result("callback.lambda", ops, nik::Timer::NowNs() - start));
+    }
+
+    {
+        // Too big for the small buffer, so the callable is on the heap
+        uint64_t state[16] = {};
+        nik::CallBack callBack([&count, state]() { count += state[0] + 1; });
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < ops; ++i)
+        {
+            callBack.Call();
+        }
+        report.Add(Result("callback.large_lambda", ops, nik::Timer::NowNs() - start));
+    }
+
+    {
+        nik::CallBack callBack(new CountFunctor(&count));
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < ops; ++i)
+        {
+            callBack.Call();
+        }
+        report.Add(Result("callback.generic_functor", ops, nik::Timer::NowNs() - start));
+    }
+
+    {
+        std::function<void()> function([&count]() { ++count; });
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < ops; ++i)
+        {
+            function();
+        }
+        report.Add(Result("std_function", ops, nik::Timer::NowNs() - start));
+    }
+
+    {
+        const uint64_t constructs = ops / 10;
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < constructs; ++i)
+        {
+            nik::CallBack callBack([&count, i]() { count += i; });
+            callBack.Call();
+        }
+        report.Add(Result("callback.construct_call", constructs, nik::Timer::NowNs() - start));
+    }
+    g_Sink += count;
+} // end BenchCallBack
+
+//----------------------ThreadCoord------------------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Shared by the ThreadCoord clients and the benchmark
+///////////////////////////////////////////////////////////////////////////////
+struct LoopState
+{
+    LoopState() : m_Calls(0), m_Target(0), m_FirstNs(0), m_LastNs(0) {}
+    std::atomic<uint64_t> m_Calls;
+    uint64_t m_Target;
+    uint64_t m_FirstNs;
+    std::atomic<uint64_t> m_LastNs;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Client returning straight away, m_Target times
+///////////////////////////////////////////////////////////////////////////////
+class PollClient
+{
+public:
+    PollClient() : m_State(0) {}
+    explicit PollClient(LoopState* state) : m_State(state) {}
+
+    bool Run(bool)
+    {
+        uint64_t calls = m_State->m_Calls.load(std::memory_order_relaxed) + 1;
+        m_State->m_Calls.store(calls, std::memory_order_relaxed);
+        if(calls == 1)
+        {
+            m_State->m_FirstNs = nik::Timer::NowNs();
+        }
+        if(calls < m_State->m_Target)
+        {
+            return true;
+        }
+        m_State->m_LastNs.store(nik::Timer::NowNs(), std::memory_order_release);
+        return false;
+    }
+
+private:
+    LoopState* m_State;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Client counting the times it is woken
+///////////////////////////////////////////////////////////////////////////////
+class WakeClient
+{
+public:
+    WakeClient() : m_State(0) {}
+    explicit WakeClient(LoopState* state) : m_State(state) {}
+
+    bool Run(bool)
+    {
+        m_State->m_Calls.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    LoopState* m_State;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void BenchThreadCoord
+    (
+    const Options& options,
+    Report& report
+    )
+{
+    {
+        // Per call cost of the RUN_POLL loop around a client that does nothing
+        LoopState state;
+        state.m_Target = options.Scale(20000000);
+        nik::ThreadObj<nik::ThreadCoord<PollClient> > thread;
+        thread.Run(nik::ThreadCoord<PollClient>(PollClient(&state)));
+        while( !state.m_LastNs.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+        thread.WaitForStop();
+        report.Add(Result("threadcoord.poll_loop", state.m_Target - 1,
+            state.m_LastNs.load() - state.m_FirstNs));
+    }
+
+    {
+        // Round trip of NotifyWork() to a RUN_WAIT_FOR_WORK client
+        const uint64_t wakes = options.Scale(100000);
+        LoopState state;
+        nik::LatencyHistogram latency;
+        nik::ThreadObj<nik::ThreadCoord<WakeClient> > thread;
+        thread.Run(nik::ThreadCoord<WakeClient>(WakeClient(&state), nik::RUN_WAIT_FOR_WORK));
+        while(state.m_Calls.load(std::memory_order_acquire) == 0)
+        {
+            std::this_thread::yield();
+        }
+
+        uint64_t start = nik::Timer::NowNs();
+        for(uint64_t i = 0; i < wakes; ++i)
+        {
+            nik::ScopedTimer timer(latency);
+            uint64_t target = state.m_Calls.load(std::memory_order_acquire) + 1;
+            thread.NotifyWork();
+            while(state.m_Calls.load(std::memory_order_acquire) < target)
+            {
+                std::this_thread::yield();
+            }
+        }
+        uint64_t elapsed = nik::Timer::NowNs() - start;
+        thread.Stop();
+        thread.WaitForStop();
+        report.Add(Result("threadcoord.notify_roundtrip", wakes, elapsed)
+            .Latency(latency));
+    }
+} // end BenchThreadCoord
+
+} // end namespace
+
+//----------------------End-File---------------------------------------------//
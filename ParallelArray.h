@@ -0,0 +1,581 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\ParallelArray.h
+/// @brief Contains the parallel bulk operations on arrays
+/// @details Contains the following:
+///     @li ParallelForEach - Calls a function on every element
+///     @li ParallelTransform - Sets every element from another array
+///     @li ParallelReduce - Combines every element into one value
+///     @li ParallelStencil - Sets every element from a neighbourhood
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_PARALLEL_ARRAY_HEADER
+#define NIK_PARALLEL_ARRAY_HEADER
+
+#include <Util/ArrayView.h>
+#include <Util/MultiArray.h>
+#include <Util/ThreadPool.h>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Default tile size, about what fits in a core's L2 next to the
+///     other operand
+///////////////////////////////////////////////////////////////////////////////
+const size_t DEFAULT_TILE_BYTES = 64 * 1024;
+
+namespace ParallelArrayDetail {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief A tile: the first index and the count along each dimension
+///////////////////////////////////////////////////////////////////////////////
+template <size_t N>
+struct Tile
+{
+    size_t m_First[N];
+    size_t m_Count[N];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Splits a shape into tiles of about tileBytes
+/// @details Tiles are bands of whole rows along dimension 0.  Rows longer
+///     than a tile are also split along the last dimension, so a tile's
+///     rows stay contiguous for the inner loops.
+///////////////////////////////////////////////////////////////////////////////
+template <size_t N>
+std::vector<Tile<N> > MakeTiles
+    (
+    const size_t (&sizes)[N],
+    size_t elementSize,
+    size_t tileBytes
+    )
+{
+    std::vector<Tile<N> > tiles;
+    size_t count = 1;
+    for(size_t d = 0; d < N; ++d)
+    {
+        count *= sizes[d];
+    }
+    if(count == 0)
+    {
+        return tiles;
+    }
+
+    size_t tileElements = std::max<size_t>(1, tileBytes / elementSize);
+    // Elements per index of dimension 0, and per index of the last
+    // dimension within one index of dimension 0
+    size_t inner = count / sizes[0];
+    size_t middle = N > 1 ? inner / sizes[N - 1] : 1;
+
+    size_t bandRows = std::max<size_t>(1, tileElements / inner);
+    size_t lastChunk = sizes[N - 1];
+    if(N > 1 && inner > tileElements)
+    {
+        lastChunk = std::max<size_t>(1, tileElements / middle);
+    }
+    else if(N == 1)
+    {
+        bandRows = tileElements;
+    }
+
+    for(size_t first = 0; first < sizes[0]; first += bandRows)
+    {
+        size_t lastFirst = 0;
+        do
+        {
+            Tile<N> tile;
+            for(size_t d = 0; d < N; ++d)
+            {
+                tile.m_First[d] = 0;
+                tile.m_Count[d] = sizes[d];
+            }
+            tile.m_First[0] = first;
+            tile.m_Count[0] = std::min(bandRows, sizes[0] - first);
+            if(N > 1)
+            {
+                tile.m_First[N - 1] = lastFirst;
+                tile.m_Count[N - 1] = std::min(lastChunk, sizes[N - 1] - lastFirst);
+            }
+            tiles.push_back(tile);
+            lastFirst += lastChunk;
+        } while(N > 1 && lastFirst < sizes[N - 1]);
+    }
+    return tiles;
+} // end MakeTiles
+
+template <typename TYPE, size_t N>
+void GetSizes
+    (
+    const ArrayView<TYPE, N>& view,
+    size_t (&sizes)[N]
+    )
+{
+    for(size_t d = 0; d < N; ++d)
+    {
+        sizes[d] = view.Size(d);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Calls func(rowA, rowB) for the start of each row of two views of
+///     the same shape
+///////////////////////////////////////////////////////////////////////////////
+template <typename A, typename B, size_t N, typename FUNC>
+void ForEachRow
+    (
+    const ArrayView<A, N>& a,
+    const ArrayView<B, N>& b,
+    FUNC& func
+    )
+{
+    if(a.Count() == 0)
+    {
+        return;
+    }
+    size_t index[N] = {};
+    A* rowA = a.Data();
+    B* rowB = b.Data();
+    for(;;)
+    {
+        func(rowA, rowB);
+        size_t d = N - 1;
+        for(;;)
+        {
+            if(d == 0)
+            {
+                return;
+            }
+            --d;
+            rowA += a.Stride(d);
+            rowB += b.Stride(d);
+            if(++index[d] < a.Size(d))
+            {
+                break;
+            }
+            rowA -= a.Stride(d) * ptrdiff_t(a.Size(d));
+            rowB -= b.Stride(d) * ptrdiff_t(b.Size(d));
+            index[d] = 0;
+        }
+    }
+} // end ForEachRow
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Runs func(tile) for every tile on the pool and the calling thread
+/// @details The pool's workers and the caller take tiles from a shared
+///     counter until none are left.  Called from one of the pool's own
+///     workers, the tiles are run on that worker, since blocking it on the
+///     others could deadlock.
+/// @attention Rethrows the first exception thrown by func, once every tile
+///     that was started has finished
+///////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+void RunTiles
+    (
+    ThreadPool& pool,
+    size_t tileCount,
+    const FUNC& func
+    )
+{
+    size_t helperCount = std::min(pool.GetThreadCount(), tileCount - (tileCount > 0));
+    if(helperCount == 0 || pool.GetWorkerIndex() < pool.GetThreadCount())
+    {
+        for(size_t i = 0; i < tileCount; ++i)
+        {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    auto work = [&func, &next, tileCount]()
+    {
+        size_t i;
+        while((i = next.fetch_add(1, std::memory_order_relaxed)) < tileCount)
+        {
+            func(i);
+        }
+    };
+
+    std::vector<Future<void> > helpers;
+    helpers.reserve(helperCount);
+    std::exception_ptr error;
+    try
+    {
+        for(size_t i = 0; i < helperCount; ++i)
+        {
+            helpers.push_back(pool.Async(work));
+        }
+        work();
+    }
+    catch(...)
+    {
+        error = std::current_exception();
+        next.store(tileCount, std::memory_order_relaxed);
+    }
+    // Every helper refers to this frame, so wait for all before any rethrow
+    for(size_t i = 0; i < helpers.size(); ++i)
+    {
+        helpers[i].Wait();
+    }
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+    for(size_t i = 0; i < helpers.size(); ++i)
+    {
+        helpers[i].Get();
+    }
+} // end RunTiles
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief An element and its neighbours, passed to a ParallelStencil
+///     function
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE>
+class StencilWindow
+{
+public:
+    StencilWindow(const TYPE* center, ptrdiff_t strideX, ptrdiff_t strideY)
+    :
+    m_Center(center),
+    m_StrideX(strideX),
+    m_StrideY(strideY)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a neighbour
+    /// @param[in] dx Offset along X, at most the stencil radius
+    /// @param[in] dy Offset along Y, at most the stencil radius
+    /// @return The element at (x + dx, y + dy)
+    ///////////////////////////////////////////////////////////////////////////
+    const TYPE& operator()(ptrdiff_t dx, ptrdiff_t dy) const
+    {
+        return m_Center[dx * m_StrideX + dy * m_StrideY];
+    }
+
+    const TYPE* m_Center;   ///< The element at (x, y)
+    ptrdiff_t m_StrideX;    ///< Distance to (x + 1, y)
+    ptrdiff_t m_StrideY;    ///< Distance to (x, y + 1)
+};
+
+} // end namespace ParallelArrayDetail
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Calls func(element) for every element, in parallel
+/// @details The view is split into tiles of about tileBytes, which are run
+///     on the pool's workers and the calling thread.  Within a tile the
+///     rows are walked with plain pointer loops, which the compiler can
+///     vectorize when func is simple arithmetic.
+/// @param[in] pool Runs the tiles
+/// @param[in] view The elements
+/// @param[in] func Called with a reference to each element, from several
+///     threads at once
+/// @param[in] tileBytes About how many bytes of elements each task handles
+/// @attention Rethrows the first exception thrown by func
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE, size_t N, typename FUNC>
+void ParallelForEach
+    (
+    ThreadPool& pool,
+    const ArrayView<TYPE, N>& view,
+    const FUNC& func,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    using namespace ParallelArrayDetail;
+    size_t sizes[N];
+    GetSizes(view, sizes);
+    const std::vector<Tile<N> > tiles = MakeTiles(sizes, sizeof(TYPE), tileBytes);
+    RunTiles(pool, tiles.size(), [&](size_t i)
+    {
+        ArrayView<TYPE, N> tile = view.Block(tiles[i].m_First, tiles[i].m_Count);
+        const size_t count = tile.Size(N - 1);
+        const ptrdiff_t step = tile.Stride(N - 1);
+        FUNC f(func);
+        auto row = [&](TYPE* p, TYPE*)
+        {
+            if(step == 1)
+            {
+                for(size_t j = 0; j < count; ++j)
+                {
+                    f(p[j]);
+                }
+            }
+            else
+            {
+                for(size_t j = 0; j < count; ++j)
+                {
+                    f(p[ptrdiff_t(j) * step]);
+                }
+            }
+        };
+        ForEachRow(tile, tile, row);
+    });
+} // end ParallelForEach
+
+template <typename TYPE, size_t N, typename FUNC>
+void ParallelForEach
+    (
+    ThreadPool& pool,
+    MultiArray<TYPE, N>& array,
+    const FUNC& func,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    ParallelForEach(pool, array.View(), func, tileBytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sets dst(i) = func(src(i)) for every index, in parallel
+/// @param[in] pool Runs the tiles
+/// @param[in] src The input, the same shape as dst
+/// @param[in] dst The output, may be src itself but must not otherwise
+///     overlap it
+/// @param[in] func Called with each input element, from several threads
+/// @param[in] tileBytes About how many bytes of input each task handles
+/// @see ParallelForEach
+///////////////////////////////////////////////////////////////////////////////
+template <typename SRC, typename DST, size_t N, typename FUNC>
+void ParallelTransform
+    (
+    ThreadPool& pool,
+    const ArrayView<SRC, N>& src,
+    const ArrayView<DST, N>& dst,
+    const FUNC& func,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    using namespace ParallelArrayDetail;
+    size_t sizes[N];
+    GetSizes(src, sizes);
+    for(size_t d = 0; d < N; ++d)
+    {
+        assert(dst.Size(d) == sizes[d]);
+    }
+    const std::vector<Tile<N> > tiles = MakeTiles(sizes, sizeof(SRC), tileBytes);
+    RunTiles(pool, tiles.size(), [&](size_t i)
+    {
+        ArrayView<SRC, N> in = src.Block(tiles[i].m_First, tiles[i].m_Count);
+        ArrayView<DST, N> out = dst.Block(tiles[i].m_First, tiles[i].m_Count);
+        const size_t count = in.Size(N - 1);
+        const ptrdiff_t inStep = in.Stride(N - 1);
+        const ptrdiff_t outStep = out.Stride(N - 1);
+        FUNC f(func);
+        auto row = [&](SRC* p, DST* q)
+        {
+            if(inStep == 1 && outStep == 1)
+            {
+                for(size_t j = 0; j < count; ++j)
+                {
+                    q[j] = f(p[j]);
+                }
+            }
+            else
+            {
+                for(size_t j = 0; j < count; ++j)
+                {
+                    q[ptrdiff_t(j) * outStep] = f(p[ptrdiff_t(j) * inStep]);
+                }
+            }
+        };
+        ForEachRow(in, out, row);
+    });
+} // end ParallelTransform
+
+template <typename SRC, typename DST, size_t N, typename FUNC>
+void ParallelTransform
+    (
+    ThreadPool& pool,
+    const MultiArray<SRC, N>& src,
+    MultiArray<DST, N>& dst,
+    const FUNC& func,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    ParallelTransform(pool, src.View(), dst.View(), func, tileBytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Combines every element into one value, in parallel
+/// @details Each tile is reduced from identity, then the tile results are
+///     combined in tile order, so the result does not depend on how the
+///     tiles were scheduled.
+/// @param[in] pool Runs the tiles
+/// @param[in] view The elements
+/// @param[in] identity The value for no elements, e.g. 0 for a sum
+/// @param[in] op Associative; op(R, element) and op(R, R) must both give R
+/// @param[in] tileBytes About how many bytes of elements each task handles
+/// @return The combined value
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE, size_t N, typename R, typename OP>
+R ParallelReduce
+    (
+    ThreadPool& pool,
+    const ArrayView<TYPE, N>& view,
+    const R& identity,
+    const OP& op,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    using namespace ParallelArrayDetail;
+    size_t sizes[N];
+    GetSizes(view, sizes);
+    const std::vector<Tile<N> > tiles = MakeTiles(sizes, sizeof(TYPE), tileBytes);
+    std::vector<R> partials(tiles.size(), identity);
+    RunTiles(pool, tiles.size(), [&](size_t i)
+    {
+        ArrayView<TYPE, N> tile = view.Block(tiles[i].m_First, tiles[i].m_Count);
+        const size_t count = tile.Size(N - 1);
+        const ptrdiff_t step = tile.Stride(N - 1);
+        OP o(op);
+        R acc(identity);
+        auto row = [&](TYPE* p, TYPE*)
+        {
+            if(step == 1)
+            {
+                for(size_t j = 0; j < count; ++j)
+                {
+                    acc = o(acc, p[j]);
+                }
+            }
+            else
+            {
+                for(size_t j = 0; j < count; ++j)
+                {
+                    acc = o(acc, p[ptrdiff_t(j) * step]);
+                }
+            }
+        };
+        ForEachRow(tile, tile, row);
+        partials[i] = acc;
+    });
+    R result(identity);
+    for(size_t i = 0; i < partials.size(); ++i)
+    {
+        result = op(result, partials[i]);
+    }
+    return result;
+} // end ParallelReduce
+
+template <typename TYPE, size_t N, typename R, typename OP>
+R ParallelReduce
+    (
+    ThreadPool& pool,
+    const MultiArray<TYPE, N>& array,
+    const R& identity,
+    const OP& op,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    return ParallelReduce(pool, array.View(), identity, op, tileBytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sets dst(x, y) from the neighbourhood of src(x, y), in parallel
+/// @details func is called with a window on src centred on (x, y); window(dx,
+///     dy) is src(x + dx, y + dy) for dx and dy in [-radius, radius].  Only
+///     the interior, where the whole window is inside src, is set; the
+///     border of dst is left alone.  The interior is tiled in both
+///     dimensions so each tile's neighbourhood stays in cache.
+/// @param[in] pool Runs the tiles
+/// @param[in] src The input
+/// @param[in] dst The output, the same shape as src, must not overlap it
+/// @param[in] radius How far the window reaches from the centre
+/// @param[in] func Returns the new value from a window, called from several
+///     threads
+/// @param[in] tileBytes About how many bytes of input each task handles
+///////////////////////////////////////////////////////////////////////////////
+template <typename SRC, typename DST, typename FUNC>
+void ParallelStencil
+    (
+    ThreadPool& pool,
+    const ArrayView<const SRC, 2>& src,
+    const ArrayView<DST, 2>& dst,
+    size_t radius,
+    const FUNC& func,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    using namespace ParallelArrayDetail;
+    assert(src.Size(0) == dst.Size(0) && src.Size(1) == dst.Size(1));
+    if(src.Size(0) <= 2 * radius || src.Size(1) <= 2 * radius)
+    {
+        return;
+    }
+    const size_t sizes[2] = { src.Size(0) - 2 * radius, src.Size(1) - 2 * radius };
+
+    // Square-ish tiles, so the rows above and below a tile are reused
+    size_t tileElements = std::max<size_t>(1, tileBytes / sizeof(SRC));
+    size_t side = 1;
+    while((side * 2) * (side * 2) <= tileElements)
+    {
+        side *= 2;
+    }
+    std::vector<Tile<2> > tiles;
+    for(size_t x = 0; x < sizes[0]; x += side)
+    {
+        for(size_t y = 0; y < sizes[1]; y += side)
+        {
+            Tile<2> tile = { { x, y },
+                { std::min(side, sizes[0] - x), std::min(side, sizes[1] - y) } };
+            tiles.push_back(tile);
+        }
+    }
+
+    RunTiles(pool, tiles.size(), [&](size_t i)
+    {
+        const Tile<2>& tile = tiles[i];
+        const ptrdiff_t sx = src.Stride(0);
+        const ptrdiff_t sy = src.Stride(1);
+        const ptrdiff_t dy = dst.Stride(1);
+        FUNC f(func);
+        for(size_t x = 0; x < tile.m_Count[0]; ++x)
+        {
+            size_t gx = tile.m_First[0] + x + radius;
+            size_t gy = tile.m_First[1] + radius;
+            const SRC* in = &src(gx, gy);
+            DST* out = &dst(gx, gy);
+            if(sy == 1 && dy == 1)
+            {
+                for(size_t y = 0; y < tile.m_Count[1]; ++y)
+                {
+                    out[y] = f(StencilWindow<SRC>(in + y, sx, 1));
+                }
+            }
+            else
+            {
+                for(size_t y = 0; y < tile.m_Count[1]; ++y)
+                {
+                    out[ptrdiff_t(y) * dy] = f(StencilWindow<SRC>(in + ptrdiff_t(y) * sy, sx, sy));
+                }
+            }
+        }
+    });
+} // end ParallelStencil
+
+template <typename SRC, typename DST, typename FUNC>
+void ParallelStencil
+    (
+    ThreadPool& pool,
+    const MultiArray<SRC, 2>& src,
+    MultiArray<DST, 2>& dst,
+    size_t radius,
+    const FUNC& func,
+    size_t tileBytes = DEFAULT_TILE_BYTES
+    )
+{
+    ParallelStencil(pool, src.View(), dst.View(), radius, func, tileBytes);
+}
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\RingBuffer.cpp
+/// @brief Contains the implementation of the RingBuffer class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+
+#include "RingBuffer.h"
+#include <cstring>
+#include <cassert>
+
+namespace nik {
+
+//----------------------RingBuffer-Implementation----------------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+RingBuffer::RingBuffer
+    (
+    size_t capacity
+    )
+:
+m_WritePos(0),
+m_ReadPos(0),
+m_Data(0),
+m_Mask(0)
+{
+    // Round up to a power of two so the positions can be wrapped with a mask
+    size_t size = 1;
+    while(size < capacity)
+    {
+        size <<= 1;
+    }
+    m_Data = new char[size];
+    m_Mask = size - 1;
+} // end RingBuffer::RingBuffer
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+RingBuffer::~RingBuffer()
+{
+    delete [] m_Data;
+} // end RingBuffer::~RingBuffer
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t RingBuffer::WriteAvailable() const
+{
+    size_t writePos = m_WritePos.load(std::memory_order_relaxed);
+    size_t readPos = m_ReadPos.load(std::memory_order_acquire);
+    return Capacity() - (writePos - readPos);
+} // end RingBuffer::WriteAvailable
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t RingBuffer::ReadAvailable() const
+{
+    size_t readPos = m_ReadPos.load(std::memory_order_relaxed);
+    size_t writePos = m_WritePos.load(std::memory_order_acquire);
+    return writePos - readPos;
+} // end RingBuffer::ReadAvailable
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RingBuffer::TryWrite
+    (
+    const void* data,
+    size_t len
+    )
+{
+    if(len > WriteAvailable())
+    {
+        return false;
+    }
+    size_t writePos = m_WritePos.load(std::memory_order_relaxed);
+    CopyIn(writePos, static_cast<const char*>(data), len);
+    // Publish the bytes to the consumer
+    m_WritePos.store(writePos + len, std::memory_order_release);
+    return true;
+} // end RingBuffer::TryWrite
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool RingBuffer::TryWrite
+    (
+    const void* head,
+    size_t headLen,
+    const void* data,
+    size_t len
+    )
+{
+    if(headLen + len > WriteAvailable())
+    {
+        return false;
+    }
+    size_t writePos = m_WritePos.load(std::memory_order_relaxed);
+    CopyIn(writePos, static_cast<const char*>(head), headLen);
+    CopyIn(writePos + headLen, static_cast<const char*>(data), len);
+    m_WritePos.store(writePos + headLen + len, std::memory_order_release);
+    return true;
+} // end RingBuffer::TryWrite
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t RingBuffer::Write
+    (
+    const void* data,
+    size_t len
+    )
+{
+    size_t available = WriteAvailable();
+    if(len > available)
+    {
+        len = available;
+    }
+    if(len == 0)
+    {
+        return 0;
+    }
+    size_t writePos = m_WritePos.load(std::memory_order_relaxed);
+    CopyIn(writePos, static_cast<const char*>(data), len);
+    m_WritePos.store(writePos + len, std::memory_order_release);
+    return len;
+} // end RingBuffer::Write
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t RingBuffer::Read
+    (
+    void* data,
+    size_t maxLen
+    )
+{
+    size_t len = ReadAvailable();
+    if(len > maxLen)
+    {
+        len = maxLen;
+    }
+    if(len == 0)
+    {
+        return 0;
+    }
+    size_t readPos = m_ReadPos.load(std::memory_order_relaxed);
+    size_t start = readPos & m_Mask;
+    size_t first = Capacity() - start;
+    if(first > len)
+    {
+        first = len;
+    }
+    char* out = static_cast<char*>(data);
+    memcpy(out, m_Data + start, first);
+    memcpy(out + first, m_Data, len - first);
+    // Hand the space back to the producer
+    m_ReadPos.store(readPos + len, std::memory_order_release);
+    return len;
+} // end RingBuffer::Read
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t RingBuffer::Read
+    (
+    std::string& out
+    )
+{
+    size_t len = ReadAvailable();
+    if(len == 0)
+    {
+        return 0;
+    }
+    size_t readPos = m_ReadPos.load(std::memory_order_relaxed);
+    size_t start = readPos & m_Mask;
+    size_t first = Capacity() - start;
+    if(first > len)
+    {
+        first = len;
+    }
+    out.append(m_Data + start, first);
+    out.append(m_Data, len - first);
+    m_ReadPos.store(readPos + len, std::memory_order_release);
+    return len;
+} // end RingBuffer::Read
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void RingBuffer::CopyIn
+    (
+    size_t pos,
+    const char* data,
+    size_t len
+    )
+{
+    assert(len <= Capacity());
+    size_t start = pos & m_Mask;
+    size_t first = Capacity() - start;
+    if(first > len)
+    {
+        first = len;
+    }
+    memcpy(m_Data + start, data, first);
+    memcpy(m_Data, data + first, len - first);
+} // end RingBuffer::CopyIn
+
+} // end namespace nik
+
+////////////////////////End-of-File////////////////////////////////////////////
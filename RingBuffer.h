@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\RingBuffer.h
+/// @brief Contains the declaration of the RingBuffer class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_RING_BUFFER_HEADER
+#define NIK_RING_BUFFER_HEADER
+
+#include <atomic>
+#include <string>
+#include <cstddef>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class RingBuffer RingBuffer.h <Util\RingBuffer.h>
+/// @brief Single producer, single consumer byte ring buffer
+/// @details The buffer is allocated once on construction and never grows.
+///     One thread may write to the buffer while one other thread reads from
+///     it without any locking.  The read and write positions are padded
+///     onto separate cache lines so that the producer and consumer do not
+///     contend on the same line.
+/// @attention Only one thread may call the Write functions and only one
+///     thread may call the Read functions at any given time.
+///////////////////////////////////////////////////////////////////////////////
+class RingBuffer
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Allocates the storage for the buffer.
+    /// @param[in] capacity The number of bytes the buffer can hold.  The
+    ///     value is rounded up to the next power of two.
+    ///////////////////////////////////////////////////////////////////////////
+    explicit RingBuffer(size_t capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Frees the buffer storage
+    ///////////////////////////////////////////////////////////////////////////
+    ~RingBuffer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of bytes the buffer can hold
+    /// @return The capacity of the buffer in bytes
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Capacity() const
+    {
+        return m_Mask + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of bytes that can currently be written
+    /// @note Only meaningful for the producer thread
+    ///////////////////////////////////////////////////////////////////////////
+    size_t WriteAvailable() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the number of bytes that can currently be read
+    /// @note Only meaningful for the consumer thread
+    ///////////////////////////////////////////////////////////////////////////
+    size_t ReadAvailable() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes the data to the buffer if all of it fits
+    /// @details Either all of the data is written or nothing is written.
+    /// @param[in] data The bytes to write
+    /// @param[in] len The number of bytes to write
+    /// @return @arg true - The data was written
+    ///         @arg false - There was not enough room, nothing was written
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryWrite(const void* data, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes two pieces of data to the buffer if both fit
+    /// @details Both pieces are published together, so the consumer never 
+    ///     sees the first piece without the second.
+    /// @param[in] head The first bytes to write
+    /// @param[in] headLen The number of bytes in head
+    /// @param[in] data The bytes to write after head
+    /// @param[in] len The number of bytes in data
+    /// @return @arg true - The data was written
+    ///         @arg false - There was not enough room, nothing was written
+    ///////////////////////////////////////////////////////////////////////////
+    bool TryWrite(const void* head, size_t headLen, const void* data, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Writes as much of the data as currently fits
+    /// @param[in] data The bytes to write
+    /// @param[in] len The number of bytes to write
+    /// @return The number of bytes written
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Write(const void* data, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Reads up to maxLen bytes out of the buffer
+    /// @param[out] data Destination for the bytes
+    /// @param[in] maxLen The maximum number of bytes to read
+    /// @return The number of bytes read
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Read(void* data, size_t maxLen);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Appends everything currently in the buffer to the string
+    /// @param[out] out The string to append to
+    /// @return The number of bytes read
+    ///////////////////////////////////////////////////////////////////////////
+    size_t Read(std::string& out);
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Prevent copy construction
+    ///////////////////////////////////////////////////////////////////////////
+    RingBuffer(const RingBuffer&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Prevent assignment
+    ///////////////////////////////////////////////////////////////////////////
+    RingBuffer& operator=(const RingBuffer&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copies bytes into the storage starting at the given position
+    /// @details Handles wrapping around the end of the storage.
+    ///////////////////////////////////////////////////////////////////////////
+    void CopyIn(size_t pos, const char* data, size_t len);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Size of a cache line, used to pad the positions
+    ///////////////////////////////////////////////////////////////////////////
+    enum { CacheLineSize = 64 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Total number of bytes written, only modified by the producer
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> m_WritePos;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps the write position on its own cache line
+    ///////////////////////////////////////////////////////////////////////////
+    char m_WritePad[CacheLineSize - sizeof(std::atomic<size_t>)];
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Total number of bytes read, only modified by the consumer
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> m_ReadPos;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps the read position on its own cache line
+    ///////////////////////////////////////////////////////////////////////////
+    char m_ReadPad[CacheLineSize - sizeof(std::atomic<size_t>)];
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The buffer storage
+    /// @note Created with new[]
+    ///////////////////////////////////////////////////////////////////////////
+    char* m_Data;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Capacity minus one, used to wrap the positions
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_Mask;
+
+}; // end class RingBuffer
+
+} // end namespace nik
+
+#endif
+
+////////////////////////End-of-File////////////////////////////////////////////
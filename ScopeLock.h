@@ -4,13 +4,15 @@
 /// @internal
 ///
 /// ??????2010, nik: initial
+/// 14October2026, nik: Records hold times of named mutexes
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_SCOPE_LOCK_HEADER
 #define NIK_SCOPE_LOCK_HEADER
 
-#include <Util\Mutex.h>
+#include <Util/Mutex.h>
+#include <Util/Timer.h>
 #include <sstream>
-#include <Util\Utility.h>
+#include <Util/Utility.h>
 #include <cassert>
 
 namespace nik {
@@ -20,6 +22,9 @@ namespace nik {
 /// @details Used in conjunction with Mutex to lock a scope.  The mutex is
 ///     locked upon creation of the ScopeLock and released on the deletion of
 ///     the ScopeLock object.
+///
+///     In a NIK_LOCK_STATS build, the time a named mutex is held is added
+///     to its counters, see SyncStats.
 /// @see nik::Mutex
 ///////////////////////////////////////////////////////////////////////////////
 class ScopeLock
@@ -34,7 +39,8 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     ScopeLock(Mutex* mutex)
         :
-    m_Mutex(mutex)
+    m_Mutex(mutex),
+    m_Start(0)
     {
         #ifdef NIK_DEBUG
         bool result = m_Mutex->Lock(500);
@@ -47,6 +53,12 @@ public:
         #else
         m_Mutex->Lock();
         #endif 
+        #if NIK_LOCK_STATS
+        if(m_Mutex->GetStats())
+        {
+            m_Start = Timer::NowNs();
+        }
+        #endif
     } // end ScopeLock
 
     ///////////////////////////////////////////////////////////////////////////
@@ -55,6 +67,12 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     ~ScopeLock()
     {
+        #if NIK_LOCK_STATS
+        if(SyncStats* stats = m_Mutex->GetStats())
+        {
+            stats->RecordHold(Timer::NowNs() - m_Start);
+        }
+        #endif
         m_Mutex->Unlock();
     }
 
@@ -65,6 +83,11 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     Mutex* m_Mutex;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief When the mutex was locked, only set for a counted mutex
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t m_Start;
+
 }; // end class ScopeLock
 
 } // end namespace nik
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\Singleton.cpp
+/// @brief Implements the singleton teardown declared in Util\Singleton.h
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Singleton.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief A scheduled destroy function
+///////////////////////////////////////////////////////////////////////////////
+struct Teardown
+{
+    int m_Phase;
+    size_t m_Order;         ///< Creation order, destroyed last first
+    void (*m_Destroy)();
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The scheduled destroy functions
+/// @details Never destroyed, it is used from the atexit handler.  The lock
+///     is a std::mutex rather than a nik::Mutex, which may itself be used by
+///     singletons.
+///////////////////////////////////////////////////////////////////////////////
+struct TeardownList
+{
+    std::mutex m_Lock;
+    std::vector<Teardown> m_Entries;
+    size_t m_Next;          ///< Order of the next entry
+    bool m_Registered;      ///< RunTeardown() is registered with atexit
+};
+
+TeardownList& GetTeardownList();
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Register RunTeardown() with atexit, once
+/// @note Called with the list lock held
+///////////////////////////////////////////////////////////////////////////////
+void RegisterTeardown(TeardownList& list);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Destroy the singletons, lowest phase first
+///////////////////////////////////////////////////////////////////////////////
+void RunTeardown();
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Orders teardown by phase, then latest created first
+///////////////////////////////////////////////////////////////////////////////
+bool TeardownBefore(const Teardown& lhs, const Teardown& rhs);
+
+} // end namespace
+
+namespace nik {
+namespace SingletonDetail {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void ScheduleTeardown
+    (
+    int phase,
+    void (*destroy)()
+    )
+{
+    TeardownList& list = GetTeardownList();
+    std::lock_guard<std::mutex> lock(list.m_Lock);
+    Teardown teardown = { phase, list.m_Next++, destroy };
+    list.m_Entries.push_back(teardown);
+    RegisterTeardown(list);
+} // end ScheduleTeardown
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TeardownInit::TeardownInit()
+{
+    TeardownList& list = GetTeardownList();
+    std::lock_guard<std::mutex> lock(list.m_Lock);
+    RegisterTeardown(list);
+} // end TeardownInit::TeardownInit
+
+} // end namespace SingletonDetail
+} // end namespace nik
+
+//----------------------Free-Function-Implementation-------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TeardownList& GetTeardownList()
+{
+    static TeardownList* list = new TeardownList();
+    return *list;
+} // end GetTeardownList
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void RegisterTeardown
+    (
+    TeardownList& list
+    )
+{
+    if( !list.m_Registered)
+    {
+        list.m_Registered = true;
+        std::atexit(RunTeardown);
+    }
+} // end RegisterTeardown
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void RunTeardown()
+{
+    TeardownList& list = GetTeardownList();
+    for(;;)
+    {
+        // Take one at a time; a destructor may create another singleton
+        Teardown next;
+        {
+            std::lock_guard<std::mutex> lock(list.m_Lock);
+            if(list.m_Entries.empty())
+            {
+                return;
+            }
+            std::vector<Teardown>::iterator first = std::min_element(
+                list.m_Entries.begin(), list.m_Entries.end(), TeardownBefore);
+            next = *first;
+            list.m_Entries.erase(first);
+        }
+        next.m_Destroy();
+    }
+} // end RunTeardown
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool TeardownBefore
+    (
+    const Teardown& lhs,
+    const Teardown& rhs
+    )
+{
+    if(lhs.m_Phase != rhs.m_Phase)
+    {
+        return lhs.m_Phase < rhs.m_Phase;
+    }
+    return lhs.m_Order > rhs.m_Order;
+} // end TeardownBefore
+
+} // end namespace
+
+//----------------------End-File---------------------------------------------//
@@ -4,40 +4,251 @@
 /// @internal
 ///
 /// 13March2010, nik: initial
+/// 14October2026, nik: Thread safe creation, lifetime policies with
+///     teardown phases, added ThreadLocalSingleton
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_SINGLETON_HEADER
 #define NIK_SINGLETON_HEADER
 
+#include <atomic>
+#include <thread>
+
 namespace nik {
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The order singletons are destroyed in at exit
+/// @details Lower phases are destroyed first, so a singleton may use any
+///     singleton of a higher phase from its destructor.  Within a phase the
+///     last created is destroyed first.  Any value between these may be used.
+///////////////////////////////////////////////////////////////////////////////
+enum SingletonPhase_t
+{
+    SINGLETON_PHASE_DEFAULT = 0,    ///< Singletons of the application
+    SINGLETON_PHASE_SERVICE = 100,  ///< Services used by other singletons
+    SINGLETON_PHASE_LOGGER = 1000   ///< The logger, destroyed last
+};
+
+namespace SingletonDetail {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Schedule a destroy function to run at exit in its phase
+/// @details The teardown runs from an atexit handler, see TeardownInit.
+/// @param[in] phase The phase to destroy in, see SingletonPhase_t
+/// @param[in] destroy The function that destroys the singleton
+///////////////////////////////////////////////////////////////////////////////
+void ScheduleTeardown(int phase, void (*destroy)());
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Registers the teardown with atexit before any static is built
+/// @details Every file including this header constructs one before its own
+///     statics, and the first one registers the handler.  An atexit handler
+///     runs after the destructors of the statics constructed after it was
+///     registered, so the singletons outlive the statics of those files.
+///////////////////////////////////////////////////////////////////////////////
+struct TeardownInit
+{
+    TeardownInit();
+};
+
+static TeardownInit s_TeardownInit;
+
+} // end namespace SingletonDetail
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Lifetime policy destroying the singleton at exit, in a phase
+/// @tparam PHASE The phase to destroy in, see SingletonPhase_t
+///////////////////////////////////////////////////////////////////////////////
+template <int PHASE = SINGLETON_PHASE_DEFAULT>
+struct PhasedLifetime
+{
+    static void ScheduleDestruction(void (*destroy)())
+    {
+        SingletonDetail::ScheduleTeardown(PHASE, destroy);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Lifetime policy never destroying the singleton
+/// @details For objects that must stay usable until the process ends.
+///////////////////////////////////////////////////////////////////////////////
+struct LeakedLifetime
+{
+    static void ScheduleDestruction(void (*)())
+    {
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Singleton Singleton.h <Util/Singleton.h>
 /// @brief Generic singleton
-/// @details This class implements the Singleton pattern.  
-/// @tparam T The type of the class to make into a singleton
+/// @details This class implements the Singleton pattern.  The object is
+///     created with new on the first call to Ref(), from whichever thread
+///     gets there first; other threads wait for it.  After that Ref() is one
+///     atomic load, and does not rely on the compiler making function-local
+///     statics thread safe.
+///
+///     The lifetime policy decides when the object is destroyed, see
+///     PhasedLifetime and LeakedLifetime.  Calling Ref() after the object has
+///     been destroyed creates it again, and the new object is never
+///     destroyed.
+/// @tparam T The type of the class to make into a singleton, default
+///     constructible
+/// @tparam LIFETIME The lifetime policy
+/// @attention T's constructor must not call Ref() of its own singleton.
 ///////////////////////////////////////////////////////////////////////////////
-template <class T>
+template <class T, class LIFETIME = PhasedLifetime<> >
 class Singleton
 {
 public:
-    
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Get a reference to the singleton
     /// @return Refernce to the singleton
     ///////////////////////////////////////////////////////////////////////////
     static T& Ref()
     {
-        static T this_ptr;
-        return this_ptr;
+        T* instance = s_Instance.load(std::memory_order_acquire);
+        return instance ? *instance : Create();
     }
 
 protected:
     Singleton();
 private:
-    
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The life cycle of the object
+    ///////////////////////////////////////////////////////////////////////////
+    enum State_t
+    {
+        STATE_EMPTY,        ///< Not created yet
+        STATE_CREATING,     ///< Being created by one thread
+        STATE_READY,        ///< Created
+        STATE_DESTROYED     ///< Destroyed by the lifetime policy
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Create the object, or wait for another thread to
+    ///////////////////////////////////////////////////////////////////////////
+    static T& Create()
+    {
+        for(;;)
+        {
+            int state = s_State.load(std::memory_order_acquire);
+            if(state == STATE_READY)
+            {
+                return *s_Instance.load(std::memory_order_acquire);
+            }
+            if(state == STATE_CREATING ||
+                !s_State.compare_exchange_strong(state, STATE_CREATING))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            T* instance;
+            try
+            {
+                instance = new T;
+            }
+            catch(...)
+            {
+                s_State.store(state, std::memory_order_release);
+                throw;
+            }
+            if(state == STATE_EMPTY)
+            {
+                LIFETIME::ScheduleDestruction(&Destroy);
+            }
+            s_Instance.store(instance, std::memory_order_release);
+            s_State.store(STATE_READY, std::memory_order_release);
+            return *instance;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destroy the object, called by the lifetime policy
+    ///////////////////////////////////////////////////////////////////////////
+    static void Destroy()
+    {
+        T* instance = s_Instance.exchange(0, std::memory_order_acq_rel);
+        s_State.store(STATE_DESTROYED, std::memory_order_release);
+        delete instance;
+    }
+
+    static std::atomic<T*> s_Instance;  ///< The object once it is ready
+    static std::atomic<int> s_State;    ///< See State_t
 
 }; // end class Singleton
 
+template <class T, class LIFETIME>
+std::atomic<T*> Singleton<T, LIFETIME>::s_Instance(0);
+
+template <class T, class LIFETIME>
+std::atomic<int> Singleton<T, LIFETIME>::s_State(0);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ThreadLocalSingleton Singleton.h <Util/Singleton.h>
+/// @brief A singleton per thread
+/// @details Each thread gets its own object, created with new on the
+///     thread's first call to Ref() and destroyed when the thread exits.  No
+///     other thread can reach it, so caches kept in it need no lock.
+/// @tparam T The type of the class, default constructible
+/// @attention The object of the main thread is destroyed with the other
+///     thread-local objects at exit, before any Singleton.
+///////////////////////////////////////////////////////////////////////////////
+template <class T>
+class ThreadLocalSingleton
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get a reference to the calling thread's object
+    ///////////////////////////////////////////////////////////////////////////
+    static T& Ref()
+    {
+        Holder& holder = s_Holder;
+        if( !holder.m_Instance)
+        {
+            holder.m_Instance = new T;
+        }
+        return *holder.m_Instance;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Check the calling thread has created its object
+    ///////////////////////////////////////////////////////////////////////////
+    static bool Exists()
+    {
+        return s_Holder.m_Instance != 0;
+    }
+
+protected:
+    ThreadLocalSingleton();
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Deletes the thread's object when the thread exits
+    ///////////////////////////////////////////////////////////////////////////
+    struct Holder
+    {
+        Holder() : m_Instance(0) {}
+        ~Holder()
+        {
+            T* instance = m_Instance;
+            m_Instance = 0;
+            delete instance;
+        }
+
+        T* m_Instance;
+    };
+
+    static thread_local Holder s_Holder;
+
+}; // end class ThreadLocalSingleton
+
+template <class T>
+thread_local typename ThreadLocalSingleton<T>::Holder ThreadLocalSingleton<T>::s_Holder;
+
 } // end namespace nik
 
 #endif
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\Span.h
+/// @brief Contains the declaration of the Span class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_SPAN_HEADER
+#define NIK_SPAN_HEADER
+
+#include <cassert>
+#include <cstddef>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class Span Span.h <Util/Span.h>
+/// @brief A pointer and a count, referring to contiguous elements owned by
+///     someone else
+/// @tparam TYPE The element type, const for a read only span
+///////////////////////////////////////////////////////////////////////////////
+template <typename TYPE>
+class Span
+{
+public:
+
+    typedef TYPE* iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Creates an empty span.
+    ///////////////////////////////////////////////////////////////////////////
+    Span()
+    :
+    m_Data(0),
+    m_Size(0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] data The first element
+    /// @param[in] size The number of elements
+    ///////////////////////////////////////////////////////////////////////////
+    Span(TYPE* data, size_t size)
+    :
+    m_Data(data),
+    m_Size(size)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Converts a span, e.g. to a read only span.
+    /// @param[in] other The span to refer to the elements of
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OTHER>
+    Span(const Span<OTHER>& other)
+    :
+    m_Data(other.Data()),
+    m_Size(other.Size())
+    {}
+
+    TYPE& operator[](size_t i) const
+    {
+        assert(i < m_Size);
+        return m_Data[i];
+    }
+
+    TYPE* Data() const { return m_Data; }
+    size_t Size() const { return m_Size; }
+    bool Empty() const { return m_Size == 0; }
+
+    iterator begin() const { return m_Data; }
+    iterator end() const { return m_Data + m_Size; }
+
+private:
+
+    TYPE* m_Data;   ///< The first element
+    size_t m_Size;  ///< The number of elements
+
+}; // end class Span
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
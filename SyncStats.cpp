@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\SyncStats.cpp
+/// @brief Implements the SyncStats class defined in Util\SyncStats.h
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SyncStats.h"
+#include "Mutex.h"
+#include "ScopeLock.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Every live SyncStats and the totals of the destroyed ones
+/// @details Never destroyed, so objects destroyed during static destruction
+///     can still remove themselves.  The lock is unnamed, so it is not
+///     counted itself.
+///////////////////////////////////////////////////////////////////////////////
+struct Registry
+{
+    Registry() : m_Lock(nik::Mutex::Create()), m_Head(0) {}
+    nik::Mutex* m_Lock;
+    nik::SyncStats* m_Head;
+    std::map<std::string, nik::SyncStats::Values> m_Retired;
+};
+
+Registry& GetRegistry();
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Add counters to a total of the same name
+///////////////////////////////////////////////////////////////////////////////
+void Accumulate(nik::SyncStats::Values& total, const nik::SyncStats::Values& values);
+
+} // end namespace
+
+namespace nik {
+
+//----------------------SyncStats-Implementation-----------------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+SyncStats::Values::Values()
+:
+m_Kind(KIND_MUTEX),
+m_Count(0),
+m_Contended(0),
+m_WaitNs(0),
+m_MaxWaitNs(0),
+m_HoldCount(0),
+m_HoldNs(0),
+m_MaxHoldNs(0)
+{
+} // end SyncStats::Values::Values
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+SyncStats::SyncStats
+    (
+    const char* name,
+    Kind_t kind
+    )
+:
+m_Name(name),
+m_Kind(kind),
+m_Count(0),
+m_Contended(0),
+m_WaitNs(0),
+m_MaxWaitNs(0),
+m_HoldCount(0),
+m_HoldNs(0),
+m_MaxHoldNs(0),
+m_Prev(0),
+m_Next(0)
+{
+    Registry& registry = GetRegistry();
+    ScopeLock lock(registry.m_Lock);
+    m_Next = registry.m_Head;
+    if(m_Next)
+    {
+        m_Next->m_Prev = this;
+    }
+    registry.m_Head = this;
+} // end SyncStats::SyncStats
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+SyncStats::~SyncStats()
+{
+    Registry& registry = GetRegistry();
+    ScopeLock lock(registry.m_Lock);
+    if(m_Prev)
+    {
+        m_Prev->m_Next = m_Next;
+    }
+    else
+    {
+        registry.m_Head = m_Next;
+    }
+    if(m_Next)
+    {
+        m_Next->m_Prev = m_Prev;
+    }
+    Accumulate(registry.m_Retired[m_Name], GetValues());
+} // end SyncStats::~SyncStats
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+SyncStats::Values SyncStats::GetValues() const
+{
+    Values values;
+    values.m_Name = m_Name;
+    values.m_Kind = m_Kind;
+    AddTo(values);
+    return values;
+} // end SyncStats::GetValues
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+std::vector<SyncStats::Values> SyncStats::GetAll()
+{
+    Registry& registry = GetRegistry();
+    std::map<std::string, Values> totals;
+    {
+        ScopeLock lock(registry.m_Lock);
+        totals = registry.m_Retired;
+        for(SyncStats* stats = registry.m_Head; stats; stats = stats->m_Next)
+        {
+            Accumulate(totals[stats->m_Name], stats->GetValues());
+        }
+    }
+    std::vector<Values> all;
+    all.reserve(totals.size());
+    std::map<std::string, Values>::const_iterator it = totals.begin();
+    for(; it != totals.end(); ++it)
+    {
+        all.push_back(it->second);
+    }
+    return all;
+} // end SyncStats::GetAll
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void SyncStats::Report
+    (
+    std::string& out
+    )
+{
+    if( !NIK_LOCK_STATS)
+    {
+        return;
+    }
+    std::vector<Values> all = GetAll();
+    for(size_t i = 0; i < all.size(); ++i)
+    {
+        const Values& v = all[i];
+        if(v.m_Count == 0 && v.m_HoldCount == 0)
+        {
+            continue;
+        }
+        double contended = v.m_Count ? 100.0 * v.m_Contended / v.m_Count : 0;
+        double meanWait = v.m_Count ? v.m_WaitNs / 1000.0 / v.m_Count : 0;
+        double meanHold = v.m_HoldCount ? v.m_HoldNs / 1000.0 / v.m_HoldCount : 0;
+        char line[320];
+        if(v.m_Kind == KIND_MUTEX)
+        {
+            snprintf(line, sizeof(line),
+                "[lock] %s n=%llu contended=%.1f%% wait=%.3fus max_wait=%.3fus "
+                "hold=%.3fus max_hold=%.3fus\n",
+                v.m_Name.c_str(), static_cast<unsigned long long>(v.m_Count),
+                contended, meanWait, v.m_MaxWaitNs / 1000.0,
+                meanHold, v.m_MaxHoldNs / 1000.0);
+        }
+        else
+        {
+            snprintf(line, sizeof(line),
+                "[event] %s n=%llu timed_out=%.1f%% wait=%.3fus max_wait=%.3fus\n",
+                v.m_Name.c_str(), static_cast<unsigned long long>(v.m_Count),
+                contended, meanWait, v.m_MaxWaitNs / 1000.0);
+        }
+        out += line;
+    }
+} // end SyncStats::Report
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void SyncStats::AddTo
+    (
+    Values& values
+    ) const
+{
+    values.m_Count += m_Count.load(std::memory_order_relaxed);
+    values.m_Contended += m_Contended.load(std::memory_order_relaxed);
+    values.m_WaitNs += m_WaitNs.load(std::memory_order_relaxed);
+    values.m_MaxWaitNs = std::max(values.m_MaxWaitNs,
+        m_MaxWaitNs.load(std::memory_order_relaxed));
+    values.m_HoldCount += m_HoldCount.load(std::memory_order_relaxed);
+    values.m_HoldNs += m_HoldNs.load(std::memory_order_relaxed);
+    values.m_MaxHoldNs = std::max(values.m_MaxHoldNs,
+        m_MaxHoldNs.load(std::memory_order_relaxed));
+} // end SyncStats::AddTo
+
+} // end namespace nik
+
+//----------------------Free-Function-Implementation-------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Registry& GetRegistry()
+{
+    static Registry* registry = new Registry;
+    return *registry;
+} // end GetRegistry
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void Accumulate
+    (
+    nik::SyncStats::Values& total,
+    const nik::SyncStats::Values& values
+    )
+{
+    total.m_Name = values.m_Name;
+    total.m_Kind = values.m_Kind;
+    total.m_Count += values.m_Count;
+    total.m_Contended += values.m_Contended;
+    total.m_WaitNs += values.m_WaitNs;
+    total.m_MaxWaitNs = std::max(total.m_MaxWaitNs, values.m_MaxWaitNs);
+    total.m_HoldCount += values.m_HoldCount;
+    total.m_HoldNs += values.m_HoldNs;
+    total.m_MaxHoldNs = std::max(total.m_MaxHoldNs, values.m_MaxHoldNs);
+} // end Accumulate
+
+} // end namespace
+
+//----------------------End-File---------------------------------------------//
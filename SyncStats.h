@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\SyncStats.h
+/// @brief Contains the declaration of the SyncStats class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_SYNC_STATS_HEADER
+#define NIK_SYNC_STATS_HEADER
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Records contention and wait times of named Mutex and Event objects
+/// @details Define it to 1 for the whole build, ex. -DNIK_LOCK_STATS=1.
+///     Without it names are accepted and ignored, and nothing is recorded.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_LOCK_STATS
+#define NIK_LOCK_STATS 0
+#endif
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class SyncStats SyncStats.h <Util/SyncStats.h>
+/// @brief Counters of one named Mutex or Event
+/// @details Created by Mutex::Create(const char*) and Event::Create(const
+///     char*) in a NIK_LOCK_STATS build.  Every SyncStats is listed in a
+///     process-wide registry until it is destroyed, so GetAll() and Report()
+///     can read the counters at runtime.  Objects with the same name, such
+///     as the shards of one board, are added together.
+///
+///     For a Mutex, a count is a Lock() and a contended count is a Lock()
+///     that had to wait; the wait is the time spent waiting.  Hold times are
+///     recorded by ScopeLock.  For an Event, a count is a WaitForEvent(), a
+///     contended count is a wait that timed out, and the wait is the time
+///     spent in WaitForEvent().
+/// @note The counters are shared by every thread using the object.  The
+///     cost is only paid in a NIK_LOCK_STATS build.
+///////////////////////////////////////////////////////////////////////////////
+class SyncStats
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The kind of object the counters belong to
+    ///////////////////////////////////////////////////////////////////////////
+    enum Kind_t
+    {
+        KIND_MUTEX,
+        KIND_EVENT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A copy of the counters
+    ///////////////////////////////////////////////////////////////////////////
+    struct Values
+    {
+        Values();
+
+        std::string m_Name;
+        Kind_t m_Kind;
+        uint64_t m_Count;       ///< Locks or waits
+        uint64_t m_Contended;   ///< Locks that waited, or waits that timed out
+        uint64_t m_WaitNs;      ///< Total time waited
+        uint64_t m_MaxWaitNs;   ///< Longest wait
+        uint64_t m_HoldCount;   ///< Holds timed by ScopeLock
+        uint64_t m_HoldNs;      ///< Total time held
+        uint64_t m_MaxHoldNs;   ///< Longest hold
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Adds the counters to the registry.
+    /// @param[in] name The name reported
+    /// @param[in] kind The kind of object counted
+    ///////////////////////////////////////////////////////////////////////////
+    SyncStats(const char* name, Kind_t kind);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Removes the counters from the registry.  The counts are
+    ///     kept in the registry's totals for the name.
+    ///////////////////////////////////////////////////////////////////////////
+    ~SyncStats();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Record a lock or a wait
+    /// @param[in] contended The lock had to wait, or the wait timed out
+    /// @param[in] waitNs The time waited
+    ///////////////////////////////////////////////////////////////////////////
+    void RecordWait(bool contended, uint64_t waitNs)
+    {
+        m_Count.fetch_add(1, std::memory_order_relaxed);
+        if(contended)
+        {
+            m_Contended.fetch_add(1, std::memory_order_relaxed);
+        }
+        if(waitNs)
+        {
+            m_WaitNs.fetch_add(waitNs, std::memory_order_relaxed);
+            StoreMax(m_MaxWaitNs, waitNs);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Record how long a lock was held
+    /// @param[in] holdNs The time between locking and unlocking
+    ///////////////////////////////////////////////////////////////////////////
+    void RecordHold(uint64_t holdNs)
+    {
+        m_HoldCount.fetch_add(1, std::memory_order_relaxed);
+        m_HoldNs.fetch_add(holdNs, std::memory_order_relaxed);
+        StoreMax(m_MaxHoldNs, holdNs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy the counters
+    ///////////////////////////////////////////////////////////////////////////
+    Values GetValues() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy the counters of every object, added together by name
+    /// @details Includes objects that have been destroyed.
+    /// @return The counters, sorted by name
+    ///////////////////////////////////////////////////////////////////////////
+    static std::vector<Values> GetAll();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Write one line per name of GetAll()
+    /// @details Writes the counts, the contended percentage and the mean and
+    ///     max wait and hold times in microseconds.  Nothing is written
+    ///     unless NIK_LOCK_STATS is set.
+    /// @param[out] out The text is appended to this string
+    /// @see MetricsRegistry::Report(std::string&)
+    ///////////////////////////////////////////////////////////////////////////
+    static void Report(std::string& out);
+
+private:
+
+    SyncStats(const SyncStats&);
+    SyncStats& operator=(const SyncStats&);
+
+    static void StoreMax(std::atomic<uint64_t>& max, uint64_t value)
+    {
+        uint64_t current = max.load(std::memory_order_relaxed);
+        while(value > current &&
+            !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {}
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Add the counters to a copy
+    ///////////////////////////////////////////////////////////////////////////
+    void AddTo(Values& values) const;
+
+    std::string m_Name;
+    Kind_t m_Kind;
+    std::atomic<uint64_t> m_Count;
+    std::atomic<uint64_t> m_Contended;
+    std::atomic<uint64_t> m_WaitNs;
+    std::atomic<uint64_t> m_MaxWaitNs;
+    std::atomic<uint64_t> m_HoldCount;
+    std::atomic<uint64_t> m_HoldNs;
+    std::atomic<uint64_t> m_MaxHoldNs;
+
+    SyncStats* m_Prev;  ///< Registry list, guarded by the registry lock
+    SyncStats* m_Next;  ///< Registry list, guarded by the registry lock
+
+}; // end class SyncStats
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
@@ -4,20 +4,28 @@
 /// @internal
 ///
 /// 26May2010, nik: initial
+/// 14October2026, nik: Added the POSIX implementation, affinity and naming
+/// 14October2026, nik: Added GetCurrentId()
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "Thread.h"
 #include "Utility.h"
-#include <Windows.h>
 #include <cassert>
 
+#ifdef NIK_USE_WINDOWS
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
 namespace nik {
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Thread::ThreadImpl Thread.cpp <Util\Thread.cpp>
 /// @brief The implementation of the Thread class
 /// @details Defines the behavior of the Thread class.
-/// @note Thread currently only supports Windows
 ///////////////////////////////////////////////////////////////////////////////
 class Thread::ThreadImpl
 {
@@ -37,6 +45,16 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     bool StartThread(ThreadFunc_t threadFunc, ThreadFuncArgType_t arg);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc Thread::SetAffinity(size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    bool SetAffinity(size_t core);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc Thread::SetName(const std::string&)
+    ///////////////////////////////////////////////////////////////////////////
+    bool SetName(const std::string& name);
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Destructor
     /// @details Frees the thread resource
@@ -45,11 +63,59 @@ public:
 
 private:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Applies m_Core to the started thread
+    ///////////////////////////////////////////////////////////////////////////
+    bool ApplyAffinity();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Applies m_Name to the started thread
+    ///////////////////////////////////////////////////////////////////////////
+    bool ApplyName();
+
+    static const size_t NO_CORE = static_cast<size_t>(-1); ///< No affinity
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Core to pin the thread to, NO_CORE if not pinned
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_Core;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Name of the thread, empty if not named
+    ///////////////////////////////////////////////////////////////////////////
+    std::string m_Name;
+
+#ifdef NIK_USE_WINDOWS
     ///////////////////////////////////////////////////////////////////////////
     /// @brief The thread resource
-    /// @note Currently only support windows
     ///////////////////////////////////////////////////////////////////////////
     HANDLE m_Thread;
+#else
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Function and argument handed to the new thread
+    ///////////////////////////////////////////////////////////////////////////
+    struct StartArgs
+    {
+        ThreadFunc_t m_Func;        ///< User thread function
+        ThreadFuncArgType_t m_Arg;  ///< User argument
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Adapts ThreadFunc_t to the pthread start routine
+    /// @param[in] args Points to a StartArgs, deleted by this function
+    ///////////////////////////////////////////////////////////////////////////
+    static void* ThreadStart(void* args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The thread resource
+    ///////////////////////////////////////////////////////////////////////////
+    pthread_t m_Thread;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Indicates if m_Thread refers to a started thread
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Started;
+#endif
 
 }; // end class Thread::ThreadImpl
 
@@ -83,6 +149,57 @@ bool Thread::StartThread
 {
     return m_Impl->StartThread(threadFunc, arg);
 } // end Thread::StartThread
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::SetAffinity
+    (
+    size_t core
+    )
+{
+    return m_Impl->SetAffinity(core);
+} // end Thread::SetAffinity
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::SetName
+    (
+    const std::string& name
+    )
+{
+    return m_Impl->SetName(name);
+} // end Thread::SetName
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t Thread::GetCoreCount()
+{
+#ifdef NIK_USE_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    size_t count = info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return count > 0 ? static_cast<size_t>(count) : 1;
+} // end Thread::GetCoreCount
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t Thread::GetCurrentId()
+{
+#ifdef NIK_USE_WINDOWS
+    return GetCurrentThreadId();
+#else
+    // pthread_t is opaque, the address of a thread local is not
+    static thread_local char marker;
+    return reinterpret_cast<size_t>(&marker);
+#endif
+} // end Thread::GetCurrentId
 //----------------------Private-Implementation-------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 26May2010: nik, initial
@@ -100,9 +217,40 @@ Thread::Thread()
 ///////////////////////////////////////////////////////////////////////////////
 Thread::ThreadImpl::ThreadImpl()
 :
+m_Core(NO_CORE),
+#ifdef NIK_USE_WINDOWS
 m_Thread(0)
+#else
+m_Thread(),
+m_Started(false)
+#endif
 {}
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::SetAffinity
+    (
+    size_t core
+    )
+{
+    m_Core = core;
+    return ApplyAffinity();
+} // end Thread::ThreadImpl::SetAffinity
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::SetName
+    (
+    const std::string& name
+    )
+{
+    m_Name = name;
+    return ApplyName();
+} // end Thread::ThreadImpl::SetName
+
+#ifdef NIK_USE_WINDOWS
 ///////////////////////////////////////////////////////////////////////////////
 // 26May2010: nik, initial
 ///////////////////////////////////////////////////////////////////////////////
@@ -128,6 +276,11 @@ bool Thread::ThreadImpl::StartThread
                         &threadID);      // returns the thread identifier 
 
     assert(m_Thread);
+    if(m_Thread)
+    {
+        ApplyAffinity();
+        ApplyName();
+    }
     return m_Thread != 0;
 } // end Thread::ThreadImpl::StartThread
 
@@ -142,6 +295,138 @@ Thread::ThreadImpl::~ThreadImpl()
     }
 } // end Thread::ThreadImpl::~ThreadImpl
 
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::ApplyAffinity()
+{
+    if( !m_Thread || m_Core == NO_CORE)
+    {
+        return true;
+    }
+    if(m_Core >= sizeof(DWORD_PTR) * 8)
+    {
+        return false;
+    }
+    return SetThreadAffinityMask(m_Thread, DWORD_PTR(1) << m_Core) != 0;
+} // end Thread::ThreadImpl::ApplyAffinity
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::ApplyName()
+{
+    if( !m_Thread || m_Name.empty())
+    {
+        return true;
+    }
+    std::wstring name(m_Name.begin(), m_Name.end());
+    return SUCCEEDED(SetThreadDescription(m_Thread, name.c_str()));
+} // end Thread::ThreadImpl::ApplyName
+
+#else // POSIX
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::StartThread
+    (
+    ThreadFunc_t threadFunc,
+    ThreadFuncArgType_t arg
+    )
+{
+    if(m_Started)
+    {
+        // Thread already created
+        return true;
+    }
+
+    StartArgs* args = new StartArgs;
+    args->m_Func = threadFunc;
+    args->m_Arg = arg;
+    int result = pthread_create(&m_Thread, 0, ThreadStart, args);
+    assert(result == 0);
+    if(result != 0)
+    {
+        delete args;
+        return false;
+    }
+    m_Started = true;
+    ApplyAffinity();
+    ApplyName();
+    return true;
+} // end Thread::ThreadImpl::StartThread
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+Thread::ThreadImpl::~ThreadImpl()
+{
+    if(m_Started)
+    {
+        // Like closing the Windows handle, the thread keeps running.  The
+        // Thread may be deleted from its own thread, so never join here.
+        pthread_detach(m_Thread);
+    }
+} // end Thread::ThreadImpl::~ThreadImpl
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::ApplyAffinity()
+{
+    if( !m_Started || m_Core == NO_CORE)
+    {
+        return true;
+    }
+#ifdef __linux__
+    if(m_Core >= CPU_SETSIZE)
+    {
+        return false;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(m_Core, &cpus);
+    return pthread_setaffinity_np(m_Thread, sizeof(cpus), &cpus) == 0;
+#else
+    return false; // Not supported on this platform
+#endif
+} // end Thread::ThreadImpl::ApplyAffinity
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool Thread::ThreadImpl::ApplyName()
+{
+    if( !m_Started || m_Name.empty())
+    {
+        return true;
+    }
+#ifdef __linux__
+    // Linux limits names to 16 bytes including the terminator
+    std::string name = m_Name.substr(0, 15);
+    return pthread_setname_np(m_Thread, name.c_str()) == 0;
+#else
+    return false; // Only a thread can name itself on other platforms
+#endif
+} // end Thread::ThreadImpl::ApplyName
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void* Thread::ThreadImpl::ThreadStart
+    (
+    void* args
+    )
+{
+    StartArgs start = *static_cast<StartArgs*>(args);
+    delete static_cast<StartArgs*>(args);
+    start.m_Func(start.m_Arg);
+    return 0;
+} // end Thread::ThreadImpl::ThreadStart
+#endif
+
 } // end namespace nik
 
 ////////////////////////End-of-File////////////////////////////////////////////
@@ -4,10 +4,15 @@
 /// @internal
 ///
 /// 26May2010, nik: initial
+/// 14October2026, nik: Added the POSIX implementation, affinity and naming
+/// 14October2026, nik: Added GetCurrentId()
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_THREAD_HEADER
 #define NIK_THREAD_HEADER
 
+#include <Util/Utility.h>
+#include <string>
+
 #ifdef NIK_USE_WINDOWS
 #include <Windows.h>
 #define NIK_API WINAPI
@@ -21,7 +26,7 @@ typedef ThreadFuncReturnType_t (NIK_API *ThreadFunc_t)(ThreadFuncArgType_t);
 namespace nik {
 typedef size_t ThreadFuncReturnType_t;
 typedef void* ThreadFuncArgType_t;
-typedef FuncReturnType_t (*ThreadFunc_t)(void*);
+typedef ThreadFuncReturnType_t (*ThreadFunc_t)(ThreadFuncArgType_t);
 } // end namespace nik
 #endif
 
@@ -32,7 +37,8 @@ namespace nik {
 /// @brief Class for creating and manipulating a native thread
 /// @details Thread objects can only be created through the Create() function.
 ///     The object is always created with new so remember to delete it.
-/// @note Thread currently only supports Windows
+/// @note Uses Win32 threads when NIK_USE_WINDOWS is defined and pthreads
+///     otherwise
 ///////////////////////////////////////////////////////////////////////////////
 class Thread
 {
@@ -60,6 +66,41 @@ public:
     ///         @arg false - Failed to set up the new thread
     ///////////////////////////////////////////////////////////////////////////
     bool StartThread(ThreadFunc_t threadFunc, ThreadFuncArgType_t arg);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Pins the thread to a single core
+    /// @details May be called before or after StartThread().  Before, the
+    ///     core is applied when the thread is started.
+    /// @param[in] core Zero based index of the core to run on
+    /// @return @arg true - The affinity was set, or will be set on start
+    ///         @arg false - The affinity could not be set
+    ///////////////////////////////////////////////////////////////////////////
+    bool SetAffinity(size_t core);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Names the thread for debuggers and system tools
+    /// @details May be called before or after StartThread().  Before, the
+    ///     name is applied when the thread is started.
+    /// @param[in] name The thread name.  Linux truncates names to 15
+    ///     characters.
+    /// @return @arg true - The name was set, or will be set on start
+    ///         @arg false - The name could not be set
+    ///////////////////////////////////////////////////////////////////////////
+    bool SetName(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the number of cores available
+    /// @return The number of cores, at least 1
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetCoreCount();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets an identifier of the calling thread
+    /// @details Never 0, and unique among the running threads.  An exited
+    ///     thread's identifier may be reused.
+    /// @return The identifier of the calling thread
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetCurrentId();
     
 private:
 
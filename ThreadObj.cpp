@@ -4,13 +4,27 @@
 /// @internal
 ///
 /// 24May2010, nik: initial
+/// 14October2026, nik: Stop requests use an atomic flag, added
+///     RUN_WAIT_FOR_WORK
+/// 14October2026, nik: Added PrepareRun() so the events exist before the
+///     thread starts
+/// 14October2026, nik: Added a latency probe around the user function
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "ThreadObj.h"
 #include "Utility.h"
-#include <Windows.h>
+#include "LatencyHistogram.h"
 #include <cassert>
 
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Calls the client function, recording how long it takes
+///////////////////////////////////////////////////////////////////////////////
+bool CallUserFunc(nik::SimpleThreadCoord::UserFunc_t func, bool continueThread);
+
+} // end namespace
 
 namespace nik {
 
@@ -22,15 +36,19 @@ namespace nik {
 ///////////////////////////////////////////////////////////////////////////////
 SimpleThreadCoord::SimpleThreadCoord
     (
-    UserFunc_t userFunc
+    UserFunc_t userFunc,
+    ThreadRunMode mode
     )
 :
-m_StopEvent(0),
+m_StopRequested(false),
+m_WorkEvent(0),
 m_ThreadStoppedEvent(0),
-m_UserFunc(userFunc)
+m_UserFunc(userFunc),
+m_Prepared(false)
 {
-   // The events are setup on Run.  This allows copying a ThreadObj
+   // The stopped event is setup on Run.  This allows copying a ThreadObj
    // to behave nicely before calling Run.
+   SetRunMode(mode);
 } // end SimpleThreadCoord::SimpleThreadCoord
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -38,11 +56,30 @@ m_UserFunc(userFunc)
 ///////////////////////////////////////////////////////////////////////////////
 SimpleThreadCoord::SimpleThreadCoord()
 :
-m_StopEvent(0),
+m_StopRequested(false),
+m_WorkEvent(0),
 m_ThreadStoppedEvent(0),
-m_UserFunc(0)
+m_UserFunc(0),
+m_Prepared(false)
 {}
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+SimpleThreadCoord::SimpleThreadCoord
+    (
+    const SimpleThreadCoord& orig
+    )
+:
+m_StopRequested(false),
+m_WorkEvent(0),
+m_ThreadStoppedEvent(0),
+m_UserFunc(orig.m_UserFunc),
+m_Prepared(false)
+{
+    SetRunMode(orig.m_WorkEvent ? RUN_WAIT_FOR_WORK : RUN_POLL);
+} // end SimpleThreadCoord::SimpleThreadCoord
+
 ///////////////////////////////////////////////////////////////////////////////
 // 24May2010: nik, initial
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,6 +90,7 @@ SimpleThreadCoord& SimpleThreadCoord::operator=
 {
     // Do not copy the events
     m_UserFunc = rhs.m_UserFunc;
+    SetRunMode(rhs.m_WorkEvent ? RUN_WAIT_FOR_WORK : RUN_POLL);
     return *this;
 } // end assignment operator
 
@@ -62,51 +100,79 @@ SimpleThreadCoord& SimpleThreadCoord::operator=
 ///////////////////////////////////////////////////////////////////////////////
 SimpleThreadCoord::~SimpleThreadCoord()
 {
-    // Only cleanup if the events have been created from Run()
-    if(m_StopEvent || m_ThreadStoppedEvent)
+    // Only wait if the events have been created from PrepareRun()
+    if(m_ThreadStoppedEvent)
     {
         WaitForStop();
-        delete m_StopEvent;
         delete m_ThreadStoppedEvent;
     }
+    delete m_WorkEvent;
 } // end SimpleThreadCoord::~SimpleThreadCoord
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void SimpleThreadCoord::PrepareRun()
+{
+    if( !m_ThreadStoppedEvent)
+    {
+        // Setup the events
+        m_ThreadStoppedEvent = Event::Create();
+        assert(m_ThreadStoppedEvent);
+    }
+    m_StopRequested.store(false);
+    m_ThreadStoppedEvent->ClearEvent();
+    m_Prepared = true;
+} // end SimpleThreadCoord::PrepareRun
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void SimpleThreadCoord::CancelRun()
+{
+    m_Prepared = false;
+    m_ThreadStoppedEvent->SetEvent();
+} // end SimpleThreadCoord::CancelRun
+
 ///////////////////////////////////////////////////////////////////////////////
 // 24May2010: nik, initial
+// 14October2026, nik: Uses the events from PrepareRun()
 ///////////////////////////////////////////////////////////////////////////////
 void SimpleThreadCoord::Run
     (
     )
 {
- 
-    assert(0 == m_StopEvent);
-    assert(0 == m_ThreadStoppedEvent);
-
-    // Neither event should be setup 
-    if(m_StopEvent || m_ThreadStoppedEvent)
+    if( !m_Prepared)
     {
-        throw nik::Error("SimpleThreadCoord::Run->Events have already been created");
+        // The event should not be setup unless PrepareRun() was called
+        if(m_ThreadStoppedEvent)
+        {
+            throw nik::Error("SimpleThreadCoord::Run->Events have already been created");
+        }
+        PrepareRun();
     }
-
-    // Setup the events
-    m_StopEvent = Event::Create();
-    assert(m_StopEvent);
-    m_ThreadStoppedEvent = Event::Create();
-    assert(m_ThreadStoppedEvent);
+    m_Prepared = false;
 
     // Begin execution
-    nik::log << "Run-> Loop start...\n";
+    nik::GetLog() << "Run-> Loop start..." << nik::endl;
     // Call the users function, if it returns false then quit the 
     // execution of the thread.  If true, then check for the quit
-    // event being set.
+    // flag being set.
     bool continueThread = true; // Flags if the thread will continue\quit
-    while(m_UserFunc(continueThread) && continueThread) // Note order of evaluation
+    while(CallUserFunc(m_UserFunc, continueThread) && continueThread) // Note order of evaluation
     {
-        // Check for the quit event
-        DWORD waitResult = m_StopEvent->WaitForEvent(0); // Don't wait
-        if( waitResult == Event::WAIT_SIGNALED)
+        if(m_WorkEvent && !m_StopRequested.load(std::memory_order_relaxed))
+        {
+            // Clear before calling the client so work posted while it runs
+            // wakes the next wait
+            m_WorkEvent->WaitForEvent(Event::FOREVER);
+            m_WorkEvent->ClearEvent();
+        }
+
+        // Check for the quit flag
+        if(m_StopRequested.load(std::memory_order_relaxed))
         {
-            nik::log << "Received stop event" << nik::endl;
+            nik::GetLog() << "Received stop event" << nik::endl;
             continueThread = false; // Flag the quit event, while loop will break
         }
     } // end while()
@@ -119,23 +185,72 @@ void SimpleThreadCoord::Run
 ///////////////////////////////////////////////////////////////////////////////
 void SimpleThreadCoord::SignalStop()
 {
-    // Set the stop event
-    assert(m_StopEvent);
-    m_StopEvent->SetEvent();
+    // Set the stop flag, and wake the thread if it is waiting for work
+    m_StopRequested.store(true, std::memory_order_relaxed);
+    NotifyWork();
 } // end SimpleThreadCoord::SignalStop
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void SimpleThreadCoord::NotifyWork()
+{
+    if(m_WorkEvent)
+    {
+        m_WorkEvent->SetEvent();
+    }
+} // end SimpleThreadCoord::NotifyWork
+
 ///////////////////////////////////////////////////////////////////////////////
 // 24May2010: nik, initial
 ///////////////////////////////////////////////////////////////////////////////
 void SimpleThreadCoord::WaitForStop()
 {
-    assert(m_StopEvent);
-    m_StopEvent->SetEvent(); // Set again just in case
+    SignalStop(); // Set again just in case
 
     assert(m_ThreadStoppedEvent);
     m_ThreadStoppedEvent->WaitForEvent(Event::FOREVER);
 } // end SimpleThreadCoord::WaitForStop
 
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void SimpleThreadCoord::SetRunMode
+    (
+    ThreadRunMode mode
+    )
+{
+    if(mode == RUN_WAIT_FOR_WORK && !m_WorkEvent)
+    {
+        m_WorkEvent = Event::Create("thread.work");
+        assert(m_WorkEvent);
+    }
+    else if(mode == RUN_POLL)
+    {
+        delete m_WorkEvent;
+        m_WorkEvent = 0;
+    }
+} // end SimpleThreadCoord::SetRunMode
+
 } // end namespace nik
 
+//----------------------Free-Function-Implementation-------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool CallUserFunc
+    (
+    nik::SimpleThreadCoord::UserFunc_t func,
+    bool continueThread
+    )
+{
+    NIK_LATENCY_SCOPE("thread.loop");
+    return func(continueThread);
+} // end CallUserFunc
+
+} // end namespace
+
 ////////////////////////End-of-File////////////////////////////////////////////
@@ -4,21 +4,37 @@
 /// @details Declarations for the following classes:
 ///     @li SimpleThreadCoord
 ///     @li ThreadObj
+///     @li ThreadCoord
 /// @internal
 ///
 /// 24May2010, nik: initial
+/// 14October2026, nik: Added thread affinity and naming to ThreadObj
+/// 14October2026, nik: Stop requests use an atomic flag, added
+///     RUN_WAIT_FOR_WORK
+/// 14October2026, nik: ThreadObj::Run() prepares the coordinator before the
+///     thread starts, so it can be stopped as soon as Run() returns
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_THREAD_OBJ_HEADER
 #define NIK_THREAD_OBJ_HEADER
 
-#include <Util\Utility.h>
-#include <Util\Logger.h>
+#include <Util/Utility.h>
+#include <Util/Logger.h>
 #include <cassert>
-#include <Util\Event.h>
-#include <Util\Thread.h>
+#include <atomic>
+#include <Util/Event.h>
+#include <Util/Thread.h>
 
 namespace nik {
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief How a thread coordinator calls the client code
+///////////////////////////////////////////////////////////////////////////////
+enum ThreadRunMode
+{
+    RUN_POLL,           ///< Call the client again as soon as it returns
+    RUN_WAIT_FOR_WORK   ///< Sleep between calls until NotifyWork() is called
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @class SimpleThreadCoord ThreadObj.h <Util\ThreadObj.h>
 /// @brief Manages client code running in a thread
@@ -35,7 +51,13 @@ namespace nik {
 ///     SimpleThreadCoord notifies the client code that the thread has been 
 ///     signaled to stop and will not be called again. When the client code
 ///     returns, SimpleThreadCoord stops the thread.
-/// @note Thread events are only created on the call to Run()
+///
+///     The stop request is a flag checked between calls, so a client that
+///     returns quickly costs no system call per loop.  In RUN_WAIT_FOR_WORK
+///     mode, instead of calling the client again straight away the thread
+///     sleeps until NotifyWork() or SignalStop() is called.  The client
+///     should handle all work that is available on each call.
+/// @note Thread events are only created on the call to PrepareRun() or Run()
 /// @see ThreadObj
 ///////////////////////////////////////////////////////////////////////////////
 class SimpleThreadCoord
@@ -51,8 +73,10 @@ public:
     /// @brief Constructor
     /// @details Sets up the object with the user function to call in the
     ///     thread.
+    /// @param[in] userFunc The client function
+    /// @param[in] mode How the client is called, see ThreadRunMode
     ///////////////////////////////////////////////////////////////////////////
-    SimpleThreadCoord(UserFunc_t userFunc);
+    SimpleThreadCoord(UserFunc_t userFunc, ThreadRunMode mode = RUN_POLL);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Default constructor
@@ -76,8 +100,24 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     ~SimpleThreadCoord();
 
-    // Use default copy construction
-    //SimpleThreadCoord(const SimpleThreadCoord& orig);
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy constructor
+    /// @details Copies the user function and run mode.
+    /// @note The event objects are not copied from the original object.
+    ///////////////////////////////////////////////////////////////////////////
+    SimpleThreadCoord(const SimpleThreadCoord& orig);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets up the events before the thread is started
+    /// @details Called by ThreadObj::Run() so SignalStop() and WaitForStop()
+    ///     work as soon as it returns.  Run() calls it if it has not been.
+    ///////////////////////////////////////////////////////////////////////////
+    void PrepareRun();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Undoes PrepareRun() when the thread could not be started
+    ///////////////////////////////////////////////////////////////////////////
+    void CancelRun();
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Runs the thread and starts the calls to client code
@@ -92,6 +132,13 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void SignalStop();
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wakes the thread in RUN_WAIT_FOR_WORK mode
+    /// @details The client is called at least once after this call.  Has no
+    ///     effect in RUN_POLL mode.
+    ///////////////////////////////////////////////////////////////////////////
+    void NotifyWork();
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Waits until the thread function in Run() signals that it has
     ///     stopped.
@@ -101,9 +148,19 @@ public:
 private:
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Event that indicates the stop signal has been set
+    /// @brief Creates or frees the work event to match the run mode
+    ///////////////////////////////////////////////////////////////////////////
+    void SetRunMode(ThreadRunMode mode);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set when the thread has been signaled to stop
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> m_StopRequested;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Signaled when there is work, only used in RUN_WAIT_FOR_WORK
     ///////////////////////////////////////////////////////////////////////////
-    Event* m_StopEvent;
+    Event* m_WorkEvent;
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Event that indicates the thread function has ended
@@ -114,6 +171,11 @@ private:
     /// @brief The client code to call
     ///////////////////////////////////////////////////////////////////////////
     UserFunc_t m_UserFunc;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set by PrepareRun() until Run() starts
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Prepared;
 }; // end class SimpleThreadCoord
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -139,7 +201,8 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     ThreadObj()
     :
-    m_Thread(0)
+    m_Thread(0),
+    m_Core(NO_CORE)
     {
     }
 
@@ -167,7 +230,13 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     bool Run(THREAD_COORD userObj)
     {
-        assert( !m_Thread);
+        if(m_Thread)
+        {
+            // Clean up after the previous run
+            m_ThreadCoord.WaitForStop();
+            delete m_Thread;
+            m_Thread = 0;
+        }
 
         m_ThreadCoord = userObj;
         m_Thread = Thread::Create();
@@ -178,11 +247,49 @@ public:
             return false;
         }
 
+        // Ready the stop event before the thread exists, so the caller can
+        // stop or wait for the thread as soon as this returns
+        m_ThreadCoord.PrepareRun();
+        if(m_Core != NO_CORE)
+        {
+            m_Thread->SetAffinity(m_Core);
+        }
+        if( !m_Name.empty())
+        {
+            m_Thread->SetName(m_Name);
+        }
+
         bool success = m_Thread->StartThread(MyThreadFunction, this);
         assert(success);
+        if( !success)
+        {
+            m_ThreadCoord.CancelRun();
+        }
         return success;
     } // end Run
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Pins the thread to a single core
+    /// @details Takes effect on the next call to Run().
+    /// @param[in] core Zero based index of the core to run on
+    /// @see Thread::SetAffinity(size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    void SetAffinity(size_t core)
+    {
+        m_Core = core;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Names the thread for debuggers and system tools
+    /// @details Takes effect on the next call to Run().
+    /// @param[in] name The thread name
+    /// @see Thread::SetName(const std::string&)
+    ///////////////////////////////////////////////////////////////////////////
+    void SetName(const std::string& name)
+    {
+        m_Name = name;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Stops the execution of the thread
     ///////////////////////////////////////////////////////////////////////////
@@ -191,6 +298,14 @@ public:
         m_ThreadCoord.SignalStop();
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wakes a thread whose coordinator is in RUN_WAIT_FOR_WORK mode
+    ///////////////////////////////////////////////////////////////////////////
+    void NotifyWork()
+    {
+        m_ThreadCoord.NotifyWork();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Waits for the thread to stop
     ///////////////////////////////////////////////////////////////////////////
@@ -227,10 +342,10 @@ private:
     {
         ThreadObj* threadObj = static_cast<ThreadObj*>(lpParam);
 
+        // The ThreadObj may be destroyed as soon as Run() signals that it
+        // has stopped, so it is not touched after this.  The Thread is
+        // cleaned up by the ThreadObj.
         threadObj->m_ThreadCoord.Run();
-        // cleanup the thread
-        delete threadObj->m_Thread;
-        threadObj->m_Thread = 0;
         return 0; /// @todo What to return for windows thread function
     }
 
@@ -254,8 +369,28 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     Thread* m_Thread;
 
+    static const size_t NO_CORE = static_cast<size_t>(-1); ///< No affinity
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Core to pin the thread to, NO_CORE if not pinned
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_Core;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Name given to the thread, empty if not named
+    ///////////////////////////////////////////////////////////////////////////
+    std::string m_Name;
+
 }; // end class ThreadObj
 
+///////////////////////////////////////////////////////////////////////////////
+/// @class ThreadCoord ThreadObj.h <Util\ThreadObj.h>
+/// @brief Manages a client functor running in a thread
+/// @details Works like SimpleThreadCoord, but calls CLIENT_FUNC::Run(bool)
+///     on a copy of a client functor and tracks whether the thread is
+///     running.
+/// @see SimpleThreadCoord, ThreadObj
+///////////////////////////////////////////////////////////////////////////////
 template <typename CLIENT_FUNC>
 class ThreadCoord
 {
@@ -265,40 +400,53 @@ public:
     /// @brief Constructor
     /// @details Sets up the object with the user function to call in the
     ///     thread.
+    /// @param[in] userFunc The client functor
+    /// @param[in] mode How the client is called, see ThreadRunMode
     ///////////////////////////////////////////////////////////////////////////
-    ThreadCoord(CLIENT_FUNC userFunc)
+    ThreadCoord(CLIENT_FUNC userFunc, ThreadRunMode mode = RUN_POLL)
     :
-    m_StopEvent(0),
     m_ThreadStoppedEvent(0),
+    m_WorkEvent(0),
     m_UserFunc(userFunc),
-    m_IsRunning(false)
-    {}
+    m_StopRequested(false),
+    m_IsRunning(false),
+    m_Prepared(false)
+    {
+        SetRunMode(mode);
+    }
 
     ThreadCoord()
     :
-    m_StopEvent(0),
     m_ThreadStoppedEvent(0),
-    m_IsRunning(false)
+    m_WorkEvent(0),
+    m_StopRequested(false),
+    m_IsRunning(false),
+    m_Prepared(false)
     {}
 
 
     ThreadCoord(const ThreadCoord& orig)
     :
-    m_StopEvent(0),
     m_ThreadStoppedEvent(0),
+    m_WorkEvent(0),
     m_UserFunc(orig.m_UserFunc),
-    m_IsRunning(false)
-    {}
+    m_StopRequested(false),
+    m_IsRunning(false),
+    m_Prepared(false)
+    {
+        SetRunMode(orig.GetRunMode());
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Assignment operator
-    /// @details This function copies the user function from the original
-    ///     object.
+    /// @details This function copies the user function and run mode from the
+    ///     original object.
     /// @note The event objects are not copied from the rhs object.
     ///////////////////////////////////////////////////////////////////////////
     ThreadCoord& operator=(const ThreadCoord& rhs)
     {
         m_UserFunc = rhs.m_UserFunc;
+        SetRunMode(rhs.GetRunMode());
         return *this;
     }
 
@@ -309,13 +457,13 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     ~ThreadCoord()
     {
-        // Only cleanup if the events have been created from Run()
-        if(m_StopEvent || m_ThreadStoppedEvent)
+        // Only wait if the events have been created from Run()
+        if(m_ThreadStoppedEvent)
         {
             WaitForStop();
-            delete m_StopEvent;
             delete m_ThreadStoppedEvent;
         }
+        delete m_WorkEvent;
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -323,42 +471,44 @@ public:
     /// @details This function runs calls the client function continuously.  
     ///     If the client code or the stop event is signaled, then this 
     ///     function returns.
+    ///
+    ///     In RUN_WAIT_FOR_WORK mode the thread sleeps between calls until
+    ///     NotifyWork() or SignalStop() is called.
     ///////////////////////////////////////////////////////////////////////////
     void Run()
     {
-
-        if( m_IsRunning)
+        // A stop requested after PrepareRun() must not be reset here
+        if( !m_Prepared)
         {
-            nik::log << "Warning: Thread already running, attempted to call ThreadCoord::Run()\n"; 
-            return;
-        }
-        assert( !m_IsRunning);
-        m_IsRunning = true;
-
-        if(!m_StopEvent)
-        {
-            // Setup the events
-            m_StopEvent = Event::Create();
-            assert(m_StopEvent);
-            m_ThreadStoppedEvent = Event::Create();
-            assert(m_ThreadStoppedEvent);
+            if( m_IsRunning)
+            {
+                nik::GetLog() << "Warning: Thread already running, attempted to call ThreadCoord::Run()" << nik::endl; 
+                return;
+            }
+            PrepareRun();
         }
-
-        Reset();
+        m_Prepared = false;
 
         // Begin execution
-        nik::log << "Run-> Loop start...\n";
+        nik::GetLog() << "Run-> Loop start..." << nik::endl;
         // Call the users function, if it returns false then quit the 
         // execution of the thread.  If true, then check for the quit
-        // event being set.
+        // flag being set.
         bool continueThread = true; // Flags if the thread will continue\quit
         while(m_UserFunc.Run(continueThread) && continueThread) // Note order of evaluation
         {
-            // Check for the quit event
-            DWORD waitResult = m_StopEvent->WaitForEvent(0); // Don't wait
-            if( waitResult == Event::WAIT_SIGNALED)
+            if(m_WorkEvent && !m_StopRequested.load(std::memory_order_relaxed))
             {
-                nik::log << "Received stop event\n";
+                // Clear before calling the client so work posted while it
+                // runs wakes the next wait
+                m_WorkEvent->WaitForEvent(Event::FOREVER);
+                m_WorkEvent->ClearEvent();
+            }
+
+            // Check for the quit flag
+            if(m_StopRequested.load(std::memory_order_relaxed))
+            {
+                nik::GetLog() << "Received stop event" << nik::endl;
                 continueThread = false; // Flag the quit event, while loop will break
             }
         } // end while()
@@ -366,6 +516,37 @@ public:
         m_ThreadStoppedEvent->SetEvent(); // Flag shutdown complete
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Sets up the events and marks the thread running before it is
+    ///     started
+    /// @details Called by ThreadObj::Run() so SignalStop() and WaitForStop()
+    ///     work as soon as it returns.  Run() calls it if it has not been.
+    ///////////////////////////////////////////////////////////////////////////
+    void PrepareRun()
+    {
+        assert( !m_IsRunning);
+        if(!m_ThreadStoppedEvent)
+        {
+            // Setup the events
+            m_ThreadStoppedEvent = Event::Create();
+            assert(m_ThreadStoppedEvent);
+        }
+
+        Reset();
+        m_IsRunning = true;
+        m_Prepared = true;
+    } // end PrepareRun
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Undoes PrepareRun() when the thread could not be started
+    ///////////////////////////////////////////////////////////////////////////
+    void CancelRun()
+    {
+        m_Prepared = false;
+        m_IsRunning = false;
+        m_ThreadStoppedEvent->SetEvent();
+    } // end CancelRun
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Notifies the thread that it has been signaled to stop
     ///////////////////////////////////////////////////////////////////////////
@@ -373,12 +554,23 @@ public:
     {
         if( !m_IsRunning)
         {
-            nik::log << "[ThreadCoord::SignalStop] Thread is not running, cannot signal stop\n";
+            nik::GetLog() << "[ThreadCoord::SignalStop] Thread is not running, cannot signal stop" << nik::endl;
             return;
         }
-         // Set the stop event
-        assert(m_StopEvent);
-        m_StopEvent->SetEvent();
+        RequestStop();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wakes the thread in RUN_WAIT_FOR_WORK mode
+    /// @details The client is called at least once after this call.  Has no
+    ///     effect in RUN_POLL mode.
+    ///////////////////////////////////////////////////////////////////////////
+    void NotifyWork()
+    {
+        if(m_WorkEvent)
+        {
+            m_WorkEvent->SetEvent();
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -387,14 +579,15 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void WaitForStop()
     {
-        if( !m_IsRunning)
+        // Wait on the event even if the thread has just cleared m_IsRunning;
+        // setting the event is the last thing Run() does before this object
+        // can be destroyed
+        if( !m_ThreadStoppedEvent)
         {
-            nik::log << "[ThreadCoord::WaitForStop] Thread is not running, skipping wait.\n";
+            nik::GetLog() << "[ThreadCoord::WaitForStop] Thread is not running, skipping wait." << nik::endl;
             return;
         }
-        assert(m_StopEvent);
-        bool result = m_StopEvent->SetEvent(); // Set again just in case
-        assert(result);
+        RequestStop(); // Set again just in case
 
         assert(m_ThreadStoppedEvent);
         m_ThreadStoppedEvent->WaitForEvent(Event::FOREVER);
@@ -410,6 +603,14 @@ public:
         return m_IsRunning;
     } // end IsRunning
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets how the client is called
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadRunMode GetRunMode() const
+    {
+        return m_WorkEvent ? RUN_WAIT_FOR_WORK : RUN_POLL;
+    } // end GetRunMode
+
 private:
 
     ///////////////////////////////////////////////////////////////////////////
@@ -417,29 +618,67 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void Reset()
     {
-        m_StopEvent->ClearEvent();
+        m_StopRequested.store(false);
         m_ThreadStoppedEvent->ClearEvent();
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief Event that indicates the stop signal has been set
+    /// @brief Sets the stop flag and wakes a waiting thread
     ///////////////////////////////////////////////////////////////////////////
-    Event* m_StopEvent;
+    void RequestStop()
+    {
+        m_StopRequested.store(true, std::memory_order_relaxed);
+        NotifyWork();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Creates or frees the work event to match the run mode
+    /// @attention Only call while the thread is not running
+    ///////////////////////////////////////////////////////////////////////////
+    void SetRunMode(ThreadRunMode mode)
+    {
+        assert( !m_IsRunning);
+        if(mode == RUN_WAIT_FOR_WORK && !m_WorkEvent)
+        {
+            m_WorkEvent = Event::Create("thread.work");
+            assert(m_WorkEvent);
+        }
+        else if(mode == RUN_POLL)
+        {
+            delete m_WorkEvent;
+            m_WorkEvent = 0;
+        }
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Event that indicates the thread function has ended
     ///////////////////////////////////////////////////////////////////////////
     Event* m_ThreadStoppedEvent;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Signaled when there is work, only used in RUN_WAIT_FOR_WORK
+    ///////////////////////////////////////////////////////////////////////////
+    Event* m_WorkEvent;
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief The client code to call
     ///////////////////////////////////////////////////////////////////////////
     CLIENT_FUNC m_UserFunc;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set when the thread has been signaled to stop
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> m_StopRequested;
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Indicates if the thread is running
     ///////////////////////////////////////////////////////////////////////////
-    bool m_IsRunning;
+    std::atomic<bool> m_IsRunning;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set by PrepareRun() until Run() starts
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_Prepared;
 
 }; // end class ThreadCoord
 
@@ -0,0 +1,494 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\ThreadPool.cpp
+/// @brief Contains the implementation of the ThreadPool class
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: Added a latency probe around tasks
+/// 14October2026, nik: Worker queue locks are named with the worker index
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+#include "ThreadObj.h"
+#include "ScopeLock.h"
+#include "Utility.h"
+#include "LatencyHistogram.h"
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <sstream>
+#include <exception>
+#include <cassert>
+
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief The pool the calling thread is a worker of, 0 if none
+///////////////////////////////////////////////////////////////////////////////
+thread_local const void* s_CurrentPool = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Index of the calling worker in s_CurrentPool
+///////////////////////////////////////////////////////////////////////////////
+thread_local size_t s_CurrentIndex = 0;
+
+} // end namespace
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ThreadPool::PoolImpl ThreadPool.cpp <Util\ThreadPool.cpp>
+/// @brief Implementation class for ThreadPool
+///////////////////////////////////////////////////////////////////////////////
+class ThreadPool::PoolImpl
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @copydetails ThreadPool::ThreadPool(size_t, bool)
+    ///////////////////////////////////////////////////////////////////////////
+    PoolImpl(size_t threadCount, bool pinToCores);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @copydetails ThreadPool::~ThreadPool()
+    ///////////////////////////////////////////////////////////////////////////
+    ~PoolImpl();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc ThreadPool::Submit(GenericFunctor*)
+    ///////////////////////////////////////////////////////////////////////////
+    void Submit(GenericFunctor* task);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc ThreadPool::GetThreadCount()
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetThreadCount() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc ThreadPool::GetWorkerIndex()
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetWorkerIndex() const;
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Client functor run by each worker's ThreadCoord
+    ///////////////////////////////////////////////////////////////////////////
+    class Worker
+    {
+    public:
+        Worker() : m_Pool(0), m_Index(0) {}
+        Worker(PoolImpl* pool, size_t index) : m_Pool(pool), m_Index(index) {}
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Runs tasks until there are none left
+        /// @see PoolImpl::RunWorker(size_t, bool)
+        ///////////////////////////////////////////////////////////////////////
+        bool Run(bool continueThread)
+        {
+            return m_Pool->RunWorker(m_Index, continueThread);
+        }
+
+    private:
+        PoolImpl* m_Pool;   ///< The owning pool
+        size_t m_Index;     ///< Index of this worker
+    }; // end class Worker
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A worker's task deque
+    /// @details The owner pushes and pops at the back; other workers steal
+    ///     from the front.  The lock is only contended while stealing.
+    ///////////////////////////////////////////////////////////////////////////
+    class WorkQueue
+    {
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /// @details The lock is named after the worker so its contention is
+        ///     reported per queue rather than added together.
+        /// @param[in] index Index of the owning worker
+        ///////////////////////////////////////////////////////////////////////
+        explicit WorkQueue(size_t index) : m_Lock(0), m_Size(0), m_Idle(false)
+        {
+            std::ostringstream name;
+            name << "threadpool.queue." << index;
+            m_Lock = Mutex::Create(name.str().c_str());
+        }
+        ~WorkQueue() { delete m_Lock; }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Adds a task at the back
+        ///////////////////////////////////////////////////////////////////////
+        void PushBack(GenericFunctor* task)
+        {
+            ScopeLock al(m_Lock);
+            m_Tasks.push_back(task);
+            m_Size.store(m_Tasks.size(), std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Removes the newest task
+        /// @return The task, or 0 if the deque is empty
+        ///////////////////////////////////////////////////////////////////////
+        GenericFunctor* PopBack()
+        {
+            if(m_Size.load(std::memory_order_relaxed) == 0)
+            {
+                return 0;
+            }
+            ScopeLock al(m_Lock);
+            if(m_Tasks.empty())
+            {
+                return 0;
+            }
+            GenericFunctor* task = m_Tasks.back();
+            m_Tasks.pop_back();
+            m_Size.store(m_Tasks.size(), std::memory_order_relaxed);
+            return task;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// @brief Removes the oldest task
+        /// @return The task, or 0 if the deque is empty
+        ///////////////////////////////////////////////////////////////////////
+        GenericFunctor* PopFront()
+        {
+            if(m_Size.load(std::memory_order_relaxed) == 0)
+            {
+                return 0;
+            }
+            ScopeLock al(m_Lock);
+            if(m_Tasks.empty())
+            {
+                return 0;
+            }
+            GenericFunctor* task = m_Tasks.front();
+            m_Tasks.pop_front();
+            m_Size.store(m_Tasks.size(), std::memory_order_relaxed);
+            return task;
+        }
+
+        Mutex* m_Lock;                          ///< Guards m_Tasks
+        std::deque<GenericFunctor*> m_Tasks;    ///< Queued tasks
+        std::atomic<size_t> m_Size;             ///< Lock-free hint of m_Tasks.size()
+        std::atomic<bool> m_Idle;               ///< The worker is about to sleep
+        char m_Pad[64];                         ///< Keeps queues off each other's cache lines
+    }; // end class WorkQueue
+
+    typedef ThreadObj<ThreadCoord<Worker> > WorkerThread;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Body of a worker thread
+    /// @details Runs the worker's own tasks and steals from the others until
+    ///     no task can be found.
+    /// @param[in] index The worker
+    /// @param[in] continueThread false once the pool is stopping
+    /// @return @arg true - Out of work, sleep until woken
+    ///         @arg false - Stopping and all tasks have run
+    ///////////////////////////////////////////////////////////////////////////
+    bool RunWorker(size_t index, bool continueThread);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Takes a task for a worker, stealing if its own deque is empty
+    /// @return The task, or 0 if every deque is empty
+    ///////////////////////////////////////////////////////////////////////////
+    GenericFunctor* FindTask(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs and deletes a task
+    ///////////////////////////////////////////////////////////////////////////
+    void RunTask(GenericFunctor* task);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Wakes a worker if it is sleeping
+    /// @return @arg true - The worker was woken
+    ///         @arg false - The worker was already awake
+    ///////////////////////////////////////////////////////////////////////////
+    bool Wake(size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A deque per worker
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<WorkQueue*> m_Queues;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The worker threads, one per deque
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<WorkerThread*> m_Threads;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Worker to give the next task submitted from outside the pool
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> m_NextQueue;
+
+}; // end class ThreadPool::PoolImpl
+
+//----------------------ThreadPool-Implementation----------------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool
+    (
+    size_t threadCount,
+    bool pinToCores
+    )
+:
+m_Impl(new PoolImpl(threadCount, pinToCores))
+{
+} // end ThreadPool::ThreadPool
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    delete m_Impl;
+} // end ThreadPool::~ThreadPool
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::Submit
+    (
+    GenericFunctor* task
+    )
+{
+    m_Impl->Submit(task);
+} // end ThreadPool::Submit
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t ThreadPool::GetThreadCount() const
+{
+    return m_Impl->GetThreadCount();
+} // end ThreadPool::GetThreadCount
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t ThreadPool::GetWorkerIndex() const
+{
+    return m_Impl->GetWorkerIndex();
+} // end ThreadPool::GetWorkerIndex
+
+//----------------------ThreadPool::PoolImpl-Implementation------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::PoolImpl::PoolImpl
+    (
+    size_t threadCount,
+    bool pinToCores
+    )
+:
+m_NextQueue(0)
+{
+    size_t cores = Thread::GetCoreCount();
+    if(threadCount == 0)
+    {
+        threadCount = cores;
+    }
+
+    for(size_t i = 0; i < threadCount; ++i)
+    {
+        m_Queues.push_back(new WorkQueue(i));
+    }
+
+    for(size_t i = 0; i < threadCount; ++i)
+    {
+        WorkerThread* thread = new WorkerThread;
+        m_Threads.push_back(thread);
+        std::ostringstream name;
+        name << "nik-pool-" << i;
+        thread->SetName(name.str());
+        if(pinToCores)
+        {
+            thread->SetAffinity(i % cores);
+        }
+        if( !thread->Run(ThreadCoord<Worker>(Worker(this, i), RUN_WAIT_FOR_WORK)))
+        {
+            throw Error("ThreadPool::ThreadPool - Failed to start a worker");
+        }
+    }
+} // end ThreadPool::PoolImpl::PoolImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::PoolImpl::~PoolImpl()
+{
+    // Stop them all first so they drain the deques together
+    for(size_t i = 0; i < m_Threads.size(); ++i)
+    {
+        m_Threads[i]->Stop();
+    }
+    for(size_t i = 0; i < m_Threads.size(); ++i)
+    {
+        m_Threads[i]->WaitForStop();
+        delete m_Threads[i];
+    }
+
+    for(size_t i = 0; i < m_Queues.size(); ++i)
+    {
+        // Only tasks submitted during destruction can be left
+        while(GenericFunctor* task = m_Queues[i]->PopFront())
+        {
+            delete task;
+        }
+        delete m_Queues[i];
+    }
+} // end ThreadPool::PoolImpl::~PoolImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::PoolImpl::Submit
+    (
+    GenericFunctor* task
+    )
+{
+    assert(task);
+    size_t count = m_Queues.size();
+    size_t index = s_CurrentPool == this ? s_CurrentIndex :
+        m_NextQueue.fetch_add(1, std::memory_order_relaxed) % count;
+    m_Queues[index]->PushBack(task);
+
+    // Pairs with the fence in RunWorker; either the worker sees the task on
+    // its last check or we see it is idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(Wake(index))
+    {
+        return;
+    }
+    // The owner is busy, give an idle worker the chance to steal it
+    for(size_t i = 1; i < count; ++i)
+    {
+        if(Wake((index + i) % count))
+        {
+            return;
+        }
+    }
+} // end ThreadPool::PoolImpl::Submit
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t ThreadPool::PoolImpl::GetThreadCount() const
+{
+    return m_Queues.size();
+} // end ThreadPool::PoolImpl::GetThreadCount
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t ThreadPool::PoolImpl::GetWorkerIndex() const
+{
+    return s_CurrentPool == this ? s_CurrentIndex : m_Queues.size();
+} // end ThreadPool::PoolImpl::GetWorkerIndex
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool ThreadPool::PoolImpl::RunWorker
+    (
+    size_t index,
+    bool continueThread
+    )
+{
+    s_CurrentPool = this;
+    s_CurrentIndex = index;
+    WorkQueue& queue = *m_Queues[index];
+    queue.m_Idle.store(false, std::memory_order_relaxed);
+
+    for(;;)
+    {
+        GenericFunctor* task = FindTask(index);
+        if( !task)
+        {
+            if( !continueThread)
+            {
+                return false; // Stopping and drained
+            }
+
+            // Publish that we are going to sleep before the last look, see
+            // Submit()
+            queue.m_Idle.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            task = FindTask(index);
+            if( !task)
+            {
+                return true; // ThreadCoord sleeps until Wake()
+            }
+            queue.m_Idle.store(false, std::memory_order_relaxed);
+        }
+        RunTask(task);
+    }
+} // end ThreadPool::PoolImpl::RunWorker
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+GenericFunctor* ThreadPool::PoolImpl::FindTask
+    (
+    size_t index
+    )
+{
+    GenericFunctor* task = m_Queues[index]->PopBack();
+    size_t count = m_Queues.size();
+    for(size_t i = 1; !task && i < count; ++i)
+    {
+        task = m_Queues[(index + i) % count]->PopFront();
+    }
+    return task;
+} // end ThreadPool::PoolImpl::FindTask
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::PoolImpl::RunTask
+    (
+    GenericFunctor* task
+    )
+{
+    NIK_LATENCY_SCOPE("threadpool.task");
+    try
+    {
+        task->CallFunc();
+    }
+    catch(std::exception& e)
+    {
+        NIK_LOG_ERROR << "[ThreadPool] Task threw: " << e.what();
+    }
+    catch(...)
+    {
+        NIK_LOG_ERROR << "[ThreadPool] Task threw an unknown exception";
+    }
+    delete task;
+} // end ThreadPool::PoolImpl::RunTask
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool ThreadPool::PoolImpl::Wake
+    (
+    size_t index
+    )
+{
+    std::atomic<bool>& idle = m_Queues[index]->m_Idle;
+    if(idle.load(std::memory_order_relaxed) && idle.exchange(false))
+    {
+        m_Threads[index]->NotifyWork();
+        return true;
+    }
+    return false;
+} // end ThreadPool::PoolImpl::Wake
+
+} // end namespace nik
+
+////////////////////////End-of-File////////////////////////////////////////////
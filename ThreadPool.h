@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\ThreadPool.h
+/// @brief Contains the declaration of the ThreadPool class
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: Added Async()
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_THREAD_POOL_HEADER
+#define NIK_THREAD_POOL_HEADER
+
+#include <Util/CallBack.h>
+#include <Util/Future.h>
+#include <cstddef>
+#include <type_traits>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class FunctorTask ThreadPool.h <Util/ThreadPool.h>
+/// @brief Adapts any callable to a GenericFunctor
+/// @details Used by ThreadPool::Submit to run functors and lambdas.
+///////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+class FunctorTask : public GenericFunctor
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @param[in] func The callable to run, copied
+    ///////////////////////////////////////////////////////////////////////////
+    explicit FunctorTask(const FUNC& func)
+    :
+    m_Func(func)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Calls the callable
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void CallFunc()
+    {
+        m_Func();
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The callable to run
+    ///////////////////////////////////////////////////////////////////////////
+    FUNC m_Func;
+
+}; // end class FunctorTask
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ThreadPool ThreadPool.h <Util/ThreadPool.h>
+/// @brief Runs tasks on a fixed set of worker threads
+/// @details The pool owns one worker per core by default.  Each worker is a
+///     ThreadObj running a ThreadCoord in RUN_WAIT_FOR_WORK mode, so idle
+///     workers sleep and the pool shuts down through the usual
+///     SignalStop()/WaitForStop() protocol.
+///
+///     Every worker has its own task deque.  A task submitted from a worker
+///     goes on that worker's deque and is run newest first; tasks submitted
+///     from other threads are spread over the workers.  A worker that runs
+///     out of tasks steals the oldest task from another worker before
+///     going to sleep.
+///
+///     Tasks are GenericFunctor objects created with new, the same functors
+///     CallBack runs, or any copyable callable passed to the templated
+///     Submit().  A task that throws is logged and dropped.
+///
+///     Async() runs a callable and returns a Future for its result, so that
+///     dependent stages can be chained with Future::Then() instead of
+///     blocking a thread per stage.
+/// @attention Destroying the pool runs the tasks already submitted, then
+///     stops the workers.  Do not submit while the pool is being destroyed.
+///////////////////////////////////////////////////////////////////////////////
+class ThreadPool
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Starts the worker threads.
+    /// @param[in] threadCount Number of workers.  0 starts one per core.
+    /// @param[in] pinToCores Pin worker N to core N modulo the core count
+    /// @attention Throws nik::Error if a worker could not be started
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ThreadPool(size_t threadCount = 0, bool pinToCores = false);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Runs the remaining tasks and stops the workers.
+    ///////////////////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Queues a task to run on a worker
+    /// @param[in] task The task to run, created with new.  The pool deletes
+    ///     it after it has run.
+    ///////////////////////////////////////////////////////////////////////////
+    void Submit(GenericFunctor* task);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Queues a callable to run on a worker
+    /// @param[in] func Callable taking no arguments, copied into the task
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    typename std::enable_if< !std::is_convertible<FUNC, GenericFunctor*>::value>::type
+    Submit(const FUNC& func)
+    {
+        Submit(new FunctorTask<FUNC>(func));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs a callable on a worker and gets a Future for its result
+    /// @details An exception thrown by the callable is stored in the Future.
+    /// @param[in] func Callable taking no arguments, copied into the task
+    /// @return The Future for the value returned by func
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    Future<typename std::result_of<FUNC()>::type> Async(const FUNC& func)
+    {
+        typedef typename std::result_of<FUNC()>::type R;
+        Promise<R> promise;
+        Future<R> result = promise.GetFuture();
+        Submit(new FutureDetail::PromiseTask<FUNC, R>(func, promise));
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the number of workers
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetThreadCount() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the index of the calling worker
+    /// @return The worker index, or GetThreadCount() if the calling thread
+    ///     is not a worker of this pool
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetWorkerIndex() const;
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy construction has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadPool(const ThreadPool&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadPool& operator=(const ThreadPool&);
+
+    class PoolImpl; // Implementation class for ThreadPool
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The implementation object for this ThreadPool.
+    ///////////////////////////////////////////////////////////////////////////
+    PoolImpl* m_Impl;
+
+}; // end class ThreadPool
+
+} // end namespace nik
+
+#endif
+
+////////////////////////End-of-File////////////////////////////////////////////
@@ -4,11 +4,36 @@
 /// @internal
 ///
 /// 15July2010, nik: initial
+/// 14October2026, nik: Monotonic wall clock with ns resolution, cycle mode
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "Timer.h"
+#include "Utility.h"
 
+#include <chrono>
+#include <thread>
 
+#ifdef NIK_USE_WINDOWS
+#include <Windows.h>
+#endif
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#define NIK_HAS_TSC
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define NIK_HAS_TSC
+#endif
+
+//----------------------Free-Function-Prototypes-----------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Measure the time stamp counter against the steady clock
+///////////////////////////////////////////////////////////////////////////////
+double CalibrateCycles();
+
+} // end namespace
 
 namespace nik
 {
@@ -17,16 +42,22 @@ namespace nik
 //----------------------Public-Implementation--------------------------------//
 ///////////////////////////////////////////////////////////////////////////////
 // 15July2010, nik: initial
+// 14October2026, nik: Added the clock
 ///////////////////////////////////////////////////////////////////////////////
 Timer::Timer
     (
-    bool start
+    bool start,
+    Clock_t clock
     )
 :
 m_IsRunning(false), // Start() requires this to be false
+m_Clock(clock),
 m_TicksStart(0),
 m_StoredTicks(0)
 {
+#ifndef NIK_HAS_TSC
+    m_Clock = CLOCK_STEADY;
+#endif
     // Start the timer if flagged to start.
     if(start)
     {
@@ -36,21 +67,63 @@ m_StoredTicks(0)
 
 ///////////////////////////////////////////////////////////////////////////////
 // 15July2010, nik: initial
-///////////////////////////////////////////////////////////////////////////////  
-unsigned Timer::GetTimeMs()
+// 14October2026, nik: Converted from the clock ticks
+///////////////////////////////////////////////////////////////////////////////
+unsigned Timer::GetTimeMs() const
+{
+    return static_cast<unsigned>(GetTimeNs() / 1000000);
+} // end Timer::GetTimeMs
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Timer::GetTimeUs() const
+{
+    return GetTimeNs() / 1000;
+} // end Timer::GetTimeUs
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Timer::GetTimeNs() const
+{
+    uint64_t ticks = GetTicks();
+    if(m_Clock == CLOCK_CYCLES)
+    {
+        return static_cast<uint64_t>(ticks * (1e9 / CyclesPerSecond()));
+    }
+    return ticks;
+} // end Timer::GetTimeNs
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+double Timer::GetTimeSec() const
+{
+    uint64_t ticks = GetTicks();
+    if(m_Clock == CLOCK_CYCLES)
+    {
+        return ticks / CyclesPerSecond();
+    }
+    return ticks * 1e-9;
+} // end Timer::GetTimeSec
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Timer::GetTicks() const
 {
     // Add the number of stored clock ticks to the current running number of
     // clock ticks.
-    clock_t runningTicks = m_StoredTicks;
+    uint64_t runningTicks = m_StoredTicks;
 
     // Only add the running clock ticks if the timer is actually running
     if(m_IsRunning)
     {
-        runningTicks += clock()-m_TicksStart;
+        runningTicks += Now() - m_TicksStart;
     }
-    // convert to milliseconds
-    return (1000*runningTicks) / CLOCKS_PER_SEC;
-} // end Timer::GetTimeMs
+    return runningTicks;
+} // end Timer::GetTicks
 
 ///////////////////////////////////////////////////////////////////////////////
 // 15July2010, nik: initial
@@ -60,7 +133,7 @@ void Timer::Start()
     // If the timer is not currently running, save the start point
     if( !m_IsRunning)
     {
-        m_TicksStart = clock();
+        m_TicksStart = Now();
         m_IsRunning = true;
     }
 } // end Timer::Start
@@ -73,14 +146,14 @@ void Timer::Stop()
     if(m_IsRunning)
     {
         // Save the number of clock ticks since last start
-        m_StoredTicks += clock() - m_TicksStart;
+        m_StoredTicks += Now() - m_TicksStart;
         m_IsRunning = false;
     }
 } // end Timer::Stop
 
 ///////////////////////////////////////////////////////////////////////////////
 // 15July2010, nik: initial
-///////////////////////////////////////////////////////////////////////////////  
+///////////////////////////////////////////////////////////////////////////////
 void Timer::Reset()
 {
     // Clear the running flag and dump the stored clock ticks
@@ -88,6 +161,90 @@ void Timer::Reset()
     m_StoredTicks = 0;
 } // end Timer::Reset
 
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Timer::NowNs()
+{
+#ifdef NIK_USE_WINDOWS
+    static const LONGLONG frequency = []()
+    {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return f.QuadPart;
+    }();
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    // Split the conversion so large counts do not overflow
+    uint64_t seconds = counter.QuadPart / frequency;
+    uint64_t rest = counter.QuadPart % frequency;
+    return seconds * 1000000000 + rest * 1000000000 / frequency;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+} // end Timer::NowNs
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Timer::NowCycles()
+{
+#ifdef NIK_HAS_TSC
+    // Keep earlier instructions from running past the read
+    _mm_lfence();
+    return __rdtsc();
+#else
+    return NowNs();
+#endif
+} // end Timer::NowCycles
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+double Timer::CyclesPerSecond()
+{
+    static const double rate = CalibrateCycles();
+    return rate;
+} // end Timer::CyclesPerSecond
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t Timer::Now() const
+{
+    return m_Clock == CLOCK_CYCLES ? NowCycles() : NowNs();
+} // end Timer::Now
+
 } // end namespace nik
 
+//----------------------Free-Function-Implementation-------------------------//
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+double CalibrateCycles()
+{
+#ifdef NIK_HAS_TSC
+    // One long sample, so being preempted between the paired reads costs
+    // little accuracy
+    uint64_t ns0 = nik::Timer::NowNs();
+    uint64_t cycles0 = nik::Timer::NowCycles();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    uint64_t ns1 = nik::Timer::NowNs();
+    uint64_t cycles1 = nik::Timer::NowCycles();
+    if(ns1 > ns0 && cycles1 > cycles0)
+    {
+        return (cycles1 - cycles0) * 1e9 / (ns1 - ns0);
+    }
+    return 1e9;
+#else
+    return 1e9;
+#endif
+} // end CalibrateCycles
+
+} // end namespace
+
 ////////////////////////End-of-File////////////////////////////////////////////
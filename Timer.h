@@ -4,71 +4,102 @@
 /// @internal
 ///
 /// 15July2010, nik: initial
+/// 14October2026, nik: Monotonic wall clock with ns resolution, cycle mode
 ///////////////////////////////////////////////////////////////////////////////
 
 #ifndef NIK_TIMER_HEADER
 #define NIK_TIMER_HEADER
 
-#include <ctime>
+#include <cstdint>
 
-namespace nik 
+namespace nik
 {
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Timer Timer.h <Util\Timer.h>
 /// @brief Timing object
-/// @details This class has similiar behavior to that of a stopwatch.  The 
+/// @details This class has similiar behavior to that of a stopwatch.  The
 ///     timer can be started, stopped, and reset.  Also, the current running
 ///     time can be aquired at any point.
+///
+///     Time is wall time from a monotonic clock: QueryPerformanceCounter on
+///     Windows and std::chrono::steady_clock elsewhere.  In CLOCK_CYCLES
+///     mode the timer reads the CPU time stamp counter instead, which costs
+///     a few nanoseconds and is meant for instrumenting tight loops.
+/// @note Cycle mode assumes an invariant time stamp counter, as on any
+///     x86 CPU of the last decade, and falls back to the steady clock on
+///     other CPUs.  Cycles are converted to time with a rate measured once
+///     per process, see CyclesPerSecond().
 ///////////////////////////////////////////////////////////////////////////////
 class Timer
 {
 public:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The clocks a timer can read
+    ///////////////////////////////////////////////////////////////////////////
+    enum Clock_t
+    {
+        CLOCK_STEADY,   ///< Monotonic OS clock (default)
+        CLOCK_CYCLES    ///< CPU time stamp counter
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Constructor
     /// @details Constructs a timer object that can be started on construction.
-    ///     Pass true as the start parameter to start the timer on 
+    ///     Pass true as the start parameter to start the timer on
     ///     construction.
     /// @param[in] start @li true - Start the timer on construction
     ///                  @li false - Do not start the timer (default)
+    /// @param[in] clock The clock to read
     ///////////////////////////////////////////////////////////////////////////
-    Timer(bool start=false);
-
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief Copy constructor
-    /// @note Deep copy the implementation object
-    /// @param[in] org The original Timer object to copy from
-    ///////////////////////////////////////////////////////////////////////////
-    Timer(const Timer& org);
-
-    ///////////////////////////////////////////////////////////////////////////
-    /// @brief Copy constructor
-    /// @note Deep copy the implementation object
-    /// @param[in] rhs The right-hand-side object of the assignment operator
-    ///////////////////////////////////////////////////////////////////////////
-    Timer& operator=(const Timer& rhs);
+    Timer(bool start=false, Clock_t clock=CLOCK_STEADY);
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Get the time elapsed (ms)
     /// @details This function gets the time that has elapsed from the time
-    ///     this object was started.  
+    ///     this object was started.
     /// @attention
     ///     @li If the timer has not been started, this function returns 0.
     ///     @li If the timer is currently running, this function returns the
     ///         current running time.
     ///     @li If the timer has been stopped, this function returns the time
     ///         between the start and stop calls.
-    /// @return The elapsed time in milliseconds.
+    /// @return The elapsed time in whole milliseconds.
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned GetTimeMs() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the time elapsed (us)
+    /// @see GetTimeMs()
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t GetTimeUs() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the time elapsed (ns)
+    /// @see GetTimeMs()
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t GetTimeNs() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the time elapsed (s)
+    /// @see GetTimeMs()
     ///////////////////////////////////////////////////////////////////////////
-    unsigned GetTimeMs();
+    double GetTimeSec() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the time elapsed in the units of the clock
+    /// @details Nanoseconds for CLOCK_STEADY, cycles for CLOCK_CYCLES.
+    ///     Cheaper than the other accessors since nothing is converted.
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t GetTicks() const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Starts the timer
     /// @details This function should be called to start the timer when it
     ///     is currently stopped.  This will not reset the time, time will begin
     ///     to be added onto the current running time.
-    /// @warning 
+    /// @warning
     ///     @li Calling this function does not reset the timer, call Reset().
     ///////////////////////////////////////////////////////////////////////////
     void Start();
@@ -77,7 +108,7 @@ public:
     /// @brief Stop the timer
     /// @details Calling stop will halt timer and the current running time will
     ///     be retained.
-    /// @warning This function will not reset the timer, call Reset().  If 
+    /// @warning This function will not reset the timer, call Reset().  If
     ///     Reset() is not called, the next call to Start() will cause the
     ///     additional time to be added to the current running time.
     ///////////////////////////////////////////////////////////////////////////
@@ -85,36 +116,70 @@ public:
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Reset the timer
-    /// @details Calling this function wipes out the current running time of 
+    /// @details Calling this function wipes out the current running time of
     ///     the timer.  If the timer is currently running, the timer will be
-    ///     stopped and no further time will be recorded until Start() is 
+    ///     stopped and no further time will be recorded until Start() is
     ///     called.
     ///////////////////////////////////////////////////////////////////////////
     void Reset();
 
+    bool IsRunning() const { return m_IsRunning; }
+    Clock_t GetClock() const { return m_Clock; }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Read the steady clock
+    /// @return Nanoseconds from an arbitrary, fixed point
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t NowNs();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Read the CPU time stamp counter
+    /// @return Cycles from an arbitrary point, or NowNs() on CPUs without
+    ///     a time stamp counter
+    ///////////////////////////////////////////////////////////////////////////
+    static uint64_t NowCycles();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Get the rate of the time stamp counter
+    /// @details Measured against the steady clock the first time it is
+    ///     needed, which blocks the caller for about 20ms.  Call it once at
+    ///     start up to keep that out of the measurements.
+    /// @return Cycles per second, 1e9 on CPUs without a time stamp counter
+    ///////////////////////////////////////////////////////////////////////////
+    static double CyclesPerSecond();
+
 private:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Read the clock of this timer
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t Now() const;
+
     ///////////////////////////////////////////////////////////////////////////
     // @brief Flags if the timer is currently running
     ///////////////////////////////////////////////////////////////////////////
     bool m_IsRunning;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// @brief The starting number of clock ticks
-    /// @details Records the clock ticks when the timer was started.  When the
-    ///     timer is stopped and started again, this value is updated to the
-    ///     most recent start.
+    /// @brief The clock read by this timer
+    ///////////////////////////////////////////////////////////////////////////
+    Clock_t m_Clock;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The clock reading when the timer was started
+    /// @details When the timer is stopped and started again, this value is
+    ///     updated to the most recent start.
     ///////////////////////////////////////////////////////////////////////////
-    clock_t m_TicksStart;
+    uint64_t m_TicksStart;
 
     ///////////////////////////////////////////////////////////////////////////
     /// @brief Stored clock ticks
     /// @details This variable stores the number of clock ticks between the
     ///     start and stop actions.  In this way, the number of clock ticks
-    ///     is saved so that if the timer is started up again, the current 
+    ///     is saved so that if the timer is started up again, the current
     ///     running time is saved.
     ///////////////////////////////////////////////////////////////////////////
-    clock_t m_StoredTicks;
+    uint64_t m_StoredTicks;
 };
 
 } // end namespace nik
@@ -0,0 +1,915 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\TimerWheel.cpp
+/// @brief Contains the implementation of the TimerWheel class
+/// @internal
+///
+/// 14October2026, nik: initial
+/// 14October2026, nik: The destructor waits for every callback on the pool
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TimerWheel.h"
+#include "ThreadPool.h"
+#include "ThreadObj.h"
+#include "ScopeLock.h"
+#include "Mutex.h"
+#include "Timer.h"
+#include "Utility.h"
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <exception>
+#include <cassert>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class TimerWheel::WheelImpl TimerWheel.cpp <Util\TimerWheel.cpp>
+/// @brief Implementation class for TimerWheel
+/// @details The wheel has four levels.  Level 0 has a slot per millisecond
+///     for the next 256ms; each higher level has 64 slots, each as wide as
+///     the whole level below.  A timer goes in the lowest level that can
+///     tell its deadline apart from now, and is moved down a level when the
+///     level below has turned past its slot.  Deadlines further out than
+///     the top level covers wait in its last slot and are placed again.
+///
+///     Timers live in a pool of nodes, reused through a free list.  A timer
+///     ID is the node index and a generation that changes each time the
+///     node is reused, so looking up an ID is an index and a compare.
+///////////////////////////////////////////////////////////////////////////////
+class TimerWheel::WheelImpl
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @copydetails TimerWheel::TimerWheel(ThreadPool*)
+    ///////////////////////////////////////////////////////////////////////////
+    explicit WheelImpl(ThreadPool* pool);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @copydetails TimerWheel::~TimerWheel()
+    ///////////////////////////////////////////////////////////////////////////
+    ~WheelImpl();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Adds a timer
+    /// @param[in] delayMs Milliseconds from now to the first run
+    /// @param[in] periodMs Milliseconds between runs, 0 to run once
+    /// @param[in] func The callback
+    ///////////////////////////////////////////////////////////////////////////
+    TimerId_t Add(size_t delayMs, size_t periodMs, CallBack&& func);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc TimerWheel::Cancel(TimerId_t)
+    ///////////////////////////////////////////////////////////////////////////
+    bool Cancel(TimerId_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @copydoc TimerWheel::GetPendingCount()
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetPendingCount() const;
+
+private:
+
+    enum
+    {
+        LEVEL_COUNT = 4,
+        LEVEL0_BITS = 8,                            ///< 256 slots of 1ms
+        LEVEL_BITS = 6,                             ///< 64 slots per higher level
+        LEVEL0_SLOTS = 1 << LEVEL0_BITS,
+        LEVEL_SLOTS = 1 << LEVEL_BITS,
+        SPAN_BITS = LEVEL0_BITS + LEVEL_BITS * (LEVEL_COUNT - 1) ///< ~18.6 hours
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Where a node is
+    ///////////////////////////////////////////////////////////////////////////
+    enum NodeState_t
+    {
+        NODE_FREE,      ///< On the free list
+        NODE_WAITING,   ///< In a slot of the wheel
+        NODE_RUNNING,   ///< A periodic timer whose callback is running
+        NODE_CANCELLED  ///< A periodic timer cancelled while running
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A timer, linked into a slot
+    ///////////////////////////////////////////////////////////////////////////
+    struct Node
+    {
+        Node() : m_Func([]() {}), m_Deadline(0), m_PeriodMs(0), m_Generation(0),
+            m_State(NODE_FREE), m_Index(0), m_Slot(0), m_Prev(0), m_Next(0) {}
+
+        CallBack m_Func;        ///< The callback
+        uint64_t m_Deadline;    ///< Tick to run at
+        size_t m_PeriodMs;      ///< Ticks between runs, 0 runs once
+        uint32_t m_Generation;  ///< Changed each time the node is freed
+        NodeState_t m_State;
+        size_t m_Index;         ///< Position in m_Nodes
+        Node** m_Slot;          ///< The list the node is in while waiting
+        Node* m_Prev;
+        Node* m_Next;           ///< Next in the slot or the free list
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief A callback that is due, taken from the wheel under the lock
+    ///////////////////////////////////////////////////////////////////////////
+    struct Fired
+    {
+        TimerId_t m_ID;
+        Node* m_Node;       ///< Set for periodic timers, which keep the callback
+        CallBack m_Func;    ///< The callback of a timer that runs once
+
+        Fired(TimerId_t id, Node* node, CallBack&& func)
+        : m_ID(id), m_Node(node), m_Func(std::move(func)) {}
+        Fired(Fired&& orig)
+        : m_ID(orig.m_ID), m_Node(orig.m_Node), m_Func(std::move(orig.m_Func)) {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs a due callback on a pool worker
+    ///////////////////////////////////////////////////////////////////////////
+    class FireTask : public GenericFunctor
+    {
+    public:
+        FireTask(WheelImpl* wheel, Fired&& fired)
+        : m_Wheel(wheel), m_Fired(std::move(fired)) {}
+
+        virtual void CallFunc()
+        {
+            m_Wheel->Run(m_Fired);
+        }
+
+    private:
+        WheelImpl* m_Wheel;
+        Fired m_Fired;
+    }; // end class FireTask
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Client functor run by the wheel's ThreadCoord
+    ///////////////////////////////////////////////////////////////////////////
+    class Ticker
+    {
+    public:
+        Ticker() : m_Wheel(0) {}
+        explicit Ticker(WheelImpl* wheel) : m_Wheel(wheel) {}
+
+        bool Run(bool continueThread)
+        {
+            return m_Wheel->Tick(continueThread);
+        }
+
+    private:
+        WheelImpl* m_Wheel;
+    }; // end class Ticker
+
+    typedef ThreadObj<ThreadCoord<Ticker> > TickerThread;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs the due timers, then sleeps until the next one
+    /// @param[in] continueThread false once the wheel is stopping
+    /// @return false to end the thread
+    ///////////////////////////////////////////////////////////////////////////
+    bool Tick(bool continueThread);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs a due callback and puts a periodic timer back
+    /// @details The callback is skipped once the wheel is stopping.
+    ///////////////////////////////////////////////////////////////////////////
+    void Run(Fired& fired);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Milliseconds since the wheel was created
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t Now() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Turns the wheel up to and including the given tick
+    /// @param[in] now The current tick
+    /// @param[out] fired The callbacks that are due
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    void Advance(uint64_t now, std::vector<Fired>& fired);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Places every node of a higher level slot again
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    void Cascade(size_t level, size_t index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the next tick the thread must wake for
+    /// @return The tick, or UINT64_MAX if no timer is waiting
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t NextTick() const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Links a node into the slot for its deadline
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    void Insert(Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Unlinks a node from its slot
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    void Unlink(Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets a node from the free list, or a new one
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    size_t AllocNode();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Puts a node on the free list, ending its ID
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    void FreeNode(Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the node of an ID, or 0 if the ID has ended
+    /// @note Called with the lock held
+    ///////////////////////////////////////////////////////////////////////////
+    Node* Find(TimerId_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Makes the ID of a node
+    ///////////////////////////////////////////////////////////////////////////
+    TimerId_t MakeID(size_t index) const
+    {
+        return (static_cast<TimerId_t>(m_Nodes[index].m_Generation) << 32) |
+            static_cast<TimerId_t>(index + 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs the callbacks, or 0 to run them on the wheel's thread
+    ///////////////////////////////////////////////////////////////////////////
+    ThreadPool* m_Pool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Guards the wheel and the nodes
+    ///////////////////////////////////////////////////////////////////////////
+    Mutex* m_Lock;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The slots of every level, level 0 first
+    ///////////////////////////////////////////////////////////////////////////
+    Node* m_Level0[LEVEL0_SLOTS];
+    Node* m_Levels[LEVEL_COUNT - 1][LEVEL_SLOTS];
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Every node, indexed by the low half of the ID
+    /// @note A deque so the nodes never move
+    ///////////////////////////////////////////////////////////////////////////
+    std::deque<Node> m_Nodes;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The first free node
+    ///////////////////////////////////////////////////////////////////////////
+    Node* m_FreeList;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The next tick to turn the wheel to
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t m_Tick;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The tick the thread is sleeping until
+    /// @details An Add() with an earlier deadline wakes the thread.
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t m_WakeTick;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Timers waiting in the wheel
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_Pending;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Callbacks handed to the pool that have not finished
+    /// @note Guarded by the lock
+    ///////////////////////////////////////////////////////////////////////////
+    size_t m_InFlight;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The time tick 0 started at
+    ///////////////////////////////////////////////////////////////////////////
+    uint64_t m_StartNs;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Set when the wheel is being destroyed
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<bool> m_Stopping;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The thread sleeps on this until the next deadline
+    ///////////////////////////////////////////////////////////////////////////
+    WaitWord m_Wake;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The destructor sleeps on this until m_InFlight is 0
+    ///////////////////////////////////////////////////////////////////////////
+    WaitWord m_Idle;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The wheel's thread
+    ///////////////////////////////////////////////////////////////////////////
+    TickerThread m_Thread;
+
+}; // end class TimerWheel::WheelImpl
+
+//----------------------TimerWheel-Implementation----------------------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::TimerWheel
+    (
+    ThreadPool* pool
+    )
+:
+m_Impl(new WheelImpl(pool))
+{
+} // end TimerWheel::TimerWheel
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::~TimerWheel()
+{
+    delete m_Impl;
+} // end TimerWheel::~TimerWheel
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::TimerId_t TimerWheel::Schedule
+    (
+    size_t delayMs,
+    CallBack&& func
+    )
+{
+    return m_Impl->Add(delayMs, 0, std::move(func));
+} // end TimerWheel::Schedule
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::TimerId_t TimerWheel::SchedulePeriodic
+    (
+    size_t periodMs,
+    CallBack&& func,
+    size_t firstDelayMs
+    )
+{
+    return m_Impl->Add(firstDelayMs, periodMs ? periodMs : 1, std::move(func));
+} // end TimerWheel::SchedulePeriodic
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool TimerWheel::Cancel
+    (
+    TimerId_t id
+    )
+{
+    return m_Impl->Cancel(id);
+} // end TimerWheel::Cancel
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t TimerWheel::GetPendingCount() const
+{
+    return m_Impl->GetPendingCount();
+} // end TimerWheel::GetPendingCount
+
+//----------------------TimerWheel::WheelImpl-Implementation-----------------//
+//----------------------Public-Implementation--------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::WheelImpl::WheelImpl
+    (
+    ThreadPool* pool
+    )
+:
+m_Pool(pool),
+m_Lock(Mutex::Create("timerwheel.lock")),
+m_FreeList(0),
+m_Tick(0),
+m_WakeTick(0),
+m_Pending(0),
+m_InFlight(0),
+m_StartNs(Timer::NowNs()),
+m_Stopping(false)
+{
+    if( !m_Lock)
+    {
+        throw Error("Error: TimerWheel->Mutex::Create failed");
+    }
+    for(size_t i = 0; i < LEVEL0_SLOTS; ++i)
+    {
+        m_Level0[i] = 0;
+    }
+    for(size_t level = 0; level < LEVEL_COUNT - 1; ++level)
+    {
+        for(size_t i = 0; i < LEVEL_SLOTS; ++i)
+        {
+            m_Levels[level][i] = 0;
+        }
+    }
+
+    m_Thread.SetName("nik-timer");
+    if( !m_Thread.Run(ThreadCoord<Ticker>(Ticker(this))))
+    {
+        delete m_Lock;
+        throw Error("TimerWheel::TimerWheel - Failed to start the thread");
+    }
+} // end TimerWheel::WheelImpl::WheelImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::WheelImpl::~WheelImpl()
+{
+    m_Stopping.store(true);
+    m_Thread.Stop();
+    m_Wake.NotifyAll();
+    m_Thread.WaitForStop();
+
+    // Callbacks queued or running on the pool still use the wheel
+    for(;;)
+    {
+        unsigned int epoch = m_Idle.PrepareWait();
+        {
+            ScopeLock lock(m_Lock);
+            if(m_InFlight == 0)
+            {
+                m_Idle.CancelWait();
+                break;
+            }
+        }
+        m_Idle.Wait(epoch, WaitWord::FOREVER);
+    }
+    delete m_Lock;
+} // end TimerWheel::WheelImpl::~WheelImpl
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::TimerId_t TimerWheel::WheelImpl::Add
+    (
+    size_t delayMs,
+    size_t periodMs,
+    CallBack&& func
+    )
+{
+    // Round up to the next tick, so the callback never runs early
+    uint64_t deadline = (Timer::NowNs() - m_StartNs +
+        static_cast<uint64_t>(delayMs) * 1000000 + 999999) / 1000000;
+    TimerId_t id;
+    bool wake;
+    {
+        ScopeLock lock(m_Lock);
+        size_t index = AllocNode();
+        Node& node = m_Nodes[index];
+        node.m_Func = std::move(func);
+        node.m_Deadline = deadline;
+        node.m_PeriodMs = periodMs;
+        Insert(&node);
+        id = MakeID(index);
+        wake = deadline < m_WakeTick;
+        if(wake)
+        {
+            m_WakeTick = deadline;
+        }
+    }
+    if(wake)
+    {
+        m_Wake.NotifyOne();
+    }
+    return id;
+} // end TimerWheel::WheelImpl::Add
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool TimerWheel::WheelImpl::Cancel
+    (
+    TimerId_t id
+    )
+{
+    CallBack func([]() {});
+    {
+        ScopeLock lock(m_Lock);
+        Node* node = Find(id);
+        if( !node)
+        {
+            return false;
+        }
+        if(node->m_State == NODE_RUNNING)
+        {
+            // Freed when the running callback comes back
+            node->m_State = NODE_CANCELLED;
+            return true;
+        }
+        if(node->m_State != NODE_WAITING)
+        {
+            return false;
+        }
+        Unlink(node);
+        func.Swap(node->m_Func);
+        FreeNode(node);
+    }
+    // The callback is destroyed outside the lock
+    return true;
+} // end TimerWheel::WheelImpl::Cancel
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t TimerWheel::WheelImpl::GetPendingCount() const
+{
+    ScopeLock lock(m_Lock);
+    return m_Pending;
+} // end TimerWheel::WheelImpl::GetPendingCount
+
+//----------------------Private-Implementation-------------------------------//
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+bool TimerWheel::WheelImpl::Tick
+    (
+    bool continueThread
+    )
+{
+    if( !continueThread || m_Stopping.load())
+    {
+        return false;
+    }
+
+    // Announce the wait before looking at the wheel, so an Add() after the
+    // look always wakes us
+    unsigned int epoch = m_Wake.PrepareWait();
+    std::vector<Fired> fired;
+    uint64_t next;
+    {
+        ScopeLock lock(m_Lock);
+        Advance(Now(), fired);
+        next = NextTick();
+        m_WakeTick = fired.empty() ? next : 0;
+    }
+
+    if( !fired.empty())
+    {
+        m_Wake.CancelWait();
+        for(size_t i = 0; i < fired.size(); ++i)
+        {
+            if(m_Pool)
+            {
+                m_Pool->Submit(new FireTask(this, std::move(fired[i])));
+            }
+            else
+            {
+                Run(fired[i]);
+            }
+        }
+        return true; // Look again, the callbacks took time
+    }
+
+    size_t waitMs = WaitWord::FOREVER;
+    if(next != UINT64_MAX)
+    {
+        // Round up so the wait never ends before the tick starts
+        uint64_t elapsedNs = Timer::NowNs() - m_StartNs;
+        uint64_t nextNs = next * 1000000;
+        waitMs = nextNs > elapsedNs ?
+            static_cast<size_t>((nextNs - elapsedNs + 999999) / 1000000) : 0;
+    }
+    if(waitMs == 0)
+    {
+        m_Wake.CancelWait();
+    }
+    else
+    {
+        m_Wake.Wait(epoch, waitMs);
+    }
+    return true;
+} // end TimerWheel::WheelImpl::Tick
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void TimerWheel::WheelImpl::Run
+    (
+    Fired& fired
+    )
+{
+    // A task still queued on the pool when the wheel stops is dropped
+    if( !m_Stopping.load())
+    {
+        CallBack& func = fired.m_Node ? fired.m_Node->m_Func : fired.m_Func;
+        try
+        {
+            func.Call();
+        }
+        catch(std::exception& e)
+        {
+            NIK_LOG_ERROR << "[TimerWheel] Callback threw: " << e.what();
+        }
+        catch(...)
+        {
+            NIK_LOG_ERROR << "[TimerWheel] Callback threw an unknown exception";
+        }
+    }
+
+    Node* node = fired.m_Node;
+    if( !node && !m_Pool)
+    {
+        return;
+    }
+
+    // A periodic timer goes back in the wheel, unless it was cancelled while
+    // it ran
+    CallBack drop([]() {});
+    {
+        ScopeLock lock(m_Lock);
+        if(node && (node->m_State == NODE_CANCELLED || m_Stopping.load()))
+        {
+            drop.Swap(node->m_Func);
+            FreeNode(node);
+        }
+        else if(node)
+        {
+            uint64_t now = m_Tick;
+            uint64_t deadline = node->m_Deadline + node->m_PeriodMs;
+            if(deadline < now)
+            {
+                // Skip the runs that are already late, keeping the phase
+                deadline += (now - deadline + node->m_PeriodMs - 1) /
+                    node->m_PeriodMs * node->m_PeriodMs;
+            }
+            node->m_Deadline = deadline;
+            Insert(node);
+            if(deadline < m_WakeTick)
+            {
+                // Woken under the lock, the wheel may go once it is released
+                m_WakeTick = deadline;
+                m_Wake.NotifyOne();
+            }
+        }
+        if(m_Pool)
+        {
+            --m_InFlight;
+            if(m_InFlight == 0 && m_Stopping.load())
+            {
+                m_Idle.NotifyAll();
+            }
+        }
+    }
+} // end TimerWheel::WheelImpl::Run
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t TimerWheel::WheelImpl::Now() const
+{
+    return (Timer::NowNs() - m_StartNs) / 1000000;
+} // end TimerWheel::WheelImpl::Now
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void TimerWheel::WheelImpl::Advance
+    (
+    uint64_t now,
+    std::vector<Fired>& fired
+    )
+{
+    for( ; m_Tick <= now && m_Pending; ++m_Tick)
+    {
+        if((m_Tick & (LEVEL0_SLOTS - 1)) == 0)
+        {
+            // Level 0 has turned; move the next slot of level 1 down, and
+            // of each level above that has turned too, highest first
+            size_t level = 1;
+            while(level < LEVEL_COUNT - 1 &&
+                ((m_Tick >> (LEVEL0_BITS + LEVEL_BITS * (level - 1))) & (LEVEL_SLOTS - 1)) == 0)
+            {
+                ++level;
+            }
+            for( ; level >= 1; --level)
+            {
+                Cascade(level, (m_Tick >> (LEVEL0_BITS + LEVEL_BITS * (level - 1))) &
+                    (LEVEL_SLOTS - 1));
+            }
+        }
+
+        Node* node = m_Level0[m_Tick & (LEVEL0_SLOTS - 1)];
+        m_Level0[m_Tick & (LEVEL0_SLOTS - 1)] = 0;
+        while(node)
+        {
+            Node* next = node->m_Next;
+            --m_Pending;
+            node->m_Slot = 0;
+            TimerId_t id = MakeID(node->m_Index);
+            if(node->m_PeriodMs)
+            {
+                // Keeps its node and callback until the run comes back
+                node->m_State = NODE_RUNNING;
+                fired.push_back(Fired(id, node, CallBack([]() {})));
+            }
+            else
+            {
+                fired.push_back(Fired(id, 0, std::move(node->m_Func)));
+                FreeNode(node);
+            }
+            if(m_Pool)
+            {
+                ++m_InFlight;
+            }
+            node = next;
+        }
+    }
+    if( !m_Pending && m_Tick <= now)
+    {
+        // Nothing is waiting, skip the empty ticks
+        m_Tick = now + 1;
+    }
+} // end TimerWheel::WheelImpl::Advance
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void TimerWheel::WheelImpl::Cascade
+    (
+    size_t level,
+    size_t index
+    )
+{
+    Node* node = m_Levels[level - 1][index];
+    m_Levels[level - 1][index] = 0;
+    while(node)
+    {
+        Node* next = node->m_Next;
+        --m_Pending;
+        Insert(node);
+        node = next;
+    }
+} // end TimerWheel::WheelImpl::Cascade
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+uint64_t TimerWheel::WheelImpl::NextTick() const
+{
+    if( !m_Pending)
+    {
+        return UINT64_MAX;
+    }
+    // The first busy slot of level 0, or the next turn of level 0, which
+    // may bring timers down from the levels above
+    uint64_t tick = m_Tick;
+    for( ; tick < m_Tick + LEVEL0_SLOTS; ++tick)
+    {
+        if(tick != m_Tick && (tick & (LEVEL0_SLOTS - 1)) == 0)
+        {
+            break;
+        }
+        if(m_Level0[tick & (LEVEL0_SLOTS - 1)])
+        {
+            break;
+        }
+    }
+    return tick;
+} // end TimerWheel::WheelImpl::NextTick
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void TimerWheel::WheelImpl::Insert
+    (
+    Node* node
+    )
+{
+    uint64_t deadline = node->m_Deadline > m_Tick ? node->m_Deadline : m_Tick;
+    uint64_t delta = deadline - m_Tick;
+    Node** slot;
+    if(delta < LEVEL0_SLOTS)
+    {
+        slot = &m_Level0[deadline & (LEVEL0_SLOTS - 1)];
+    }
+    else
+    {
+        if(delta >= (uint64_t(1) << SPAN_BITS))
+        {
+            // Too far out; wait in the top level and be placed again
+            deadline = m_Tick + (uint64_t(1) << SPAN_BITS) - 1;
+        }
+        size_t level = 1;
+        while(level < LEVEL_COUNT - 1 &&
+            delta >= (uint64_t(1) << (LEVEL0_BITS + LEVEL_BITS * level)))
+        {
+            ++level;
+        }
+        slot = &m_Levels[level - 1][(deadline >> (LEVEL0_BITS + LEVEL_BITS * (level - 1))) &
+            (LEVEL_SLOTS - 1)];
+    }
+
+    node->m_Prev = 0;
+    node->m_Next = *slot;
+    if(node->m_Next)
+    {
+        node->m_Next->m_Prev = node;
+    }
+    *slot = node;
+    node->m_Slot = slot;
+    node->m_State = NODE_WAITING;
+    ++m_Pending;
+} // end TimerWheel::WheelImpl::Insert
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void TimerWheel::WheelImpl::Unlink
+    (
+    Node* node
+    )
+{
+    if(node->m_Prev)
+    {
+        node->m_Prev->m_Next = node->m_Next;
+    }
+    else
+    {
+        *node->m_Slot = node->m_Next;
+    }
+    if(node->m_Next)
+    {
+        node->m_Next->m_Prev = node->m_Prev;
+    }
+    node->m_Prev = 0;
+    node->m_Next = 0;
+    node->m_Slot = 0;
+    --m_Pending;
+} // end TimerWheel::WheelImpl::Unlink
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+size_t TimerWheel::WheelImpl::AllocNode()
+{
+    if(m_FreeList)
+    {
+        Node* node = m_FreeList;
+        m_FreeList = node->m_Next;
+        node->m_Next = 0;
+        return node->m_Index;
+    }
+    m_Nodes.emplace_back();
+    m_Nodes.back().m_Index = m_Nodes.size() - 1;
+    return m_Nodes.back().m_Index;
+} // end TimerWheel::WheelImpl::AllocNode
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+void TimerWheel::WheelImpl::FreeNode
+    (
+    Node* node
+    )
+{
+    node->m_State = NODE_FREE;
+    ++node->m_Generation;
+    node->m_Prev = 0;
+    node->m_Next = m_FreeList;
+    m_FreeList = node;
+} // end TimerWheel::WheelImpl::FreeNode
+
+///////////////////////////////////////////////////////////////////////////////
+// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+TimerWheel::WheelImpl::Node* TimerWheel::WheelImpl::Find
+    (
+    TimerId_t id
+    )
+{
+    size_t index = static_cast<size_t>(id & 0xFFFFFFFFu);
+    if(index == 0 || index > m_Nodes.size())
+    {
+        return 0;
+    }
+    Node& node = m_Nodes[index - 1];
+    if(node.m_Generation != static_cast<uint32_t>(id >> 32) || node.m_State == NODE_FREE)
+    {
+        return 0;
+    }
+    return &node;
+} // end TimerWheel::WheelImpl::Find
+
+} // end namespace nik
+
+//----------------------End-File---------------------------------------------//
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @file Util\TimerWheel.h
+/// @brief Contains the declaration of the TimerWheel class
+/// @internal
+///
+/// 14October2026, nik: initial
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NIK_TIMER_WHEEL_HEADER
+#define NIK_TIMER_WHEEL_HEADER
+
+#include <Util/CallBack.h>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace nik {
+
+// Forward declarations
+class ThreadPool;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class TimerWheel TimerWheel.h <Util/TimerWheel.h>
+/// @brief Runs callbacks after a delay or periodically, from one thread
+/// @details One thread serves every timer of the wheel, so a timeout costs a
+///     list entry rather than a sleeping thread.  Timers are kept in a
+///     hierarchical wheel of millisecond slots: adding and cancelling a timer
+///     is a list insert or unlink, and the thread only wakes for the next
+///     slot that holds a timer.
+///
+///     A callback that is due is handed to the ThreadPool given on
+///     construction, or run on the wheel's thread if there is none; a slow
+///     callback on the wheel's thread delays every other timer.  Callbacks
+///     run at or after their deadline, in millisecond steps.
+///
+///     A periodic timer keeps its rate: the next run is due one period after
+///     the previous deadline, skipping runs that are already late.  It is
+///     not run again until the previous run has returned.
+/// @code
+///     nik::TimerWheel wheel(&pool);
+///     TimerWheel::TimerId_t id = wheel.Schedule(500, [&]() { OnTimeout(); });
+///     ...
+///     wheel.Cancel(id);
+/// @endcode
+/// @attention The pool must outlive the wheel.
+///////////////////////////////////////////////////////////////////////////////
+class TimerWheel
+{
+public:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Identifies a scheduled timer
+    /// @details Stays unique after the timer has fired, so a late Cancel()
+    ///     does not affect a newer timer.
+    ///////////////////////////////////////////////////////////////////////////
+    typedef uint64_t TimerId_t;
+
+    static const TimerId_t NO_TIMER = 0; ///< Never the ID of a timer
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Constructor
+    /// @details Starts the wheel's thread.
+    /// @param[in] pool Runs the callbacks, or 0 to run them on the wheel's
+    ///     thread
+    /// @attention Throws nik::Error if the thread could not be started
+    ///////////////////////////////////////////////////////////////////////////
+    explicit TimerWheel(ThreadPool* pool = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Destructor
+    /// @details Stops the thread and waits for periodic callbacks that are
+    ///     running.  Timers that have not fired are dropped without being
+    ///     called.
+    ///////////////////////////////////////////////////////////////////////////
+    ~TimerWheel();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs a callback once after a delay
+    /// @param[in] delayMs Milliseconds from now
+    /// @param[in] func The callback, moved into the wheel
+    /// @return The ID to cancel the timer with
+    ///////////////////////////////////////////////////////////////////////////
+    TimerId_t Schedule(size_t delayMs, CallBack&& func);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs a callback every period until cancelled
+    /// @param[in] periodMs Milliseconds between runs, at least 1
+    /// @param[in] func The callback, moved into the wheel
+    /// @param[in] firstDelayMs Milliseconds from now to the first run
+    /// @return The ID to cancel the timer with
+    ///////////////////////////////////////////////////////////////////////////
+    TimerId_t SchedulePeriodic(size_t periodMs, CallBack&& func, size_t firstDelayMs);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Runs a callback every period until cancelled, starting one
+    ///     period from now
+    /// @see SchedulePeriodic(size_t, CallBack&&, size_t)
+    ///////////////////////////////////////////////////////////////////////////
+    TimerId_t SchedulePeriodic(size_t periodMs, CallBack&& func)
+    {
+        return SchedulePeriodic(periodMs, std::move(func), periodMs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Stops a timer
+    /// @details A callback that is already running is not waited for, but a
+    ///     periodic timer is not run again.
+    /// @param[in] id The ID returned when the timer was scheduled
+    /// @return @arg true - The timer was stopped
+    ///         @arg false - The timer had already fired or been cancelled
+    ///////////////////////////////////////////////////////////////////////////
+    bool Cancel(TimerId_t id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Gets the number of timers waiting for their deadline
+    ///////////////////////////////////////////////////////////////////////////
+    size_t GetPendingCount() const;
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Copy construction has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    TimerWheel(const TimerWheel&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Assignment has been disallowed.
+    ///////////////////////////////////////////////////////////////////////////
+    TimerWheel& operator=(const TimerWheel&);
+
+    class WheelImpl; // Implementation class for TimerWheel
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief The implementation object for this TimerWheel.
+    ///////////////////////////////////////////////////////////////////////////
+    WheelImpl* m_Impl;
+
+}; // end class TimerWheel
+
+} // end namespace nik
+
+#endif
+
+//----------------------End-File---------------------------------------------//
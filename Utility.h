@@ -4,11 +4,20 @@
 /// @internal
 ///
 /// 13March2010, nik: initial
+/// 14October2026, nik: Added the platform selection and missing includes
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef NIK_UTILITY_HEADER
 #define NIK_UTILITY_HEADER
 
 #include <string>
+#include <cstring>
+#include <stdexcept>
+
+// Windows builds define NIK_USE_WINDOWS, otherwise the POSIX implementations
+// are used
+#if defined(_WIN32) && !defined(NIK_USE_WINDOWS)
+#define NIK_USE_WINDOWS
+#endif
 
 namespace nik
 {
@@ -0,0 +1,617 @@
+////////////////////////////////////////////////////////////////////////////////
+/// @brief Declaration of ConcurrentPostBoard
+/// @internal
+///
+/// Oct 14, 2026, nik: initial
+/// Oct 14, 2026, nik: Shards keep 24 bits of slot index in the 64 bit IDs
+/// Oct 14, 2026, nik: Unregistering in notify is deferred, and the dispatch
+///		thread notifies with the shard unlocked
+/// Oct 14, 2026, nik: Added the allocator parameter
+/// Oct 14, 2026, nik: Added a latency probe to emplace
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CONCURRENTPOSTBOARD_H_
+#define CONCURRENTPOSTBOARD_H_
+
+#include "post.h"
+#include "observer.h"
+#include "posttable.h"
+#include "Mutex.h"
+#include "ThreadObj.h"
+#include "Utility.h"
+#include "LatencyHistogram.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Shard a thread should try first
+/// @details Threads are handed out shards round robin the first time they
+///		ask, so producers tend to stay off each other's shards.
+///////////////////////////////////////////////////////////////////////////////
+inline unsigned int threadShardHint()
+{
+	static std::atomic<unsigned int> next(0);
+	static thread_local unsigned int hint = next.fetch_add(1, std::memory_order_relaxed);
+	return hint;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ConcurrentPostBoard concurrentpostboard.h <posterboard/concurrentpostboard.h>
+/// @brief A post board that many threads can post to at once
+/// @details The posts are split over 2^SHARD_BITS shards, each a
+///		SlotPostTable with its own lock.  The shard number is kept in the low
+///		bits of the PostID, so an ID leads straight to its shard.  A thread
+///		posts to the shard it was handed first, and moves on to the next
+///		shard whose lock is free, so producers do not share a lock.
+///
+///		Observers are notified in one of two ways:
+///		@li NOTIFY_IN_CALLER - On the posting thread, while the post's shard
+///			is locked.  Observers may be called from several threads at once.
+///		@li NOTIFY_ON_DISPATCH_THREAD - On a dispatch thread owned by the
+///			board.  Each shard queues the IDs posted to it; the dispatch
+///			thread takes each shard's queue and notifies every observer once
+///			per shard through Observer::notifyBatch.  Observers are only
+///			called from the dispatch thread and a slow one does not hold up
+///			posting.  Posts removed before they are dispatched are skipped.
+///			Copyable posts are copied out of the shard and the observers are
+///			called with it unlocked; posts that cannot be copied, ex. those
+///			owning a pointer, are notified with the shard locked.
+///
+///		Observers must be registered through this class, which guards the
+///		observer list.  An observer unregistered from inside a notification
+///		of this board, by itself or another, is queued and unregistered
+///		once the notifying call lets go of the observer list.  Until then it
+///		may still be notified, here or on other threads.
+/// @tparam T Data type for the posts
+/// @tparam SHARD_BITS log2 of the number of shards
+/// @tparam A Allocator for the stored posts, see PostBoard
+/// @warning Observers must not post to or remove from this board while
+///		being notified with the shard locked, nor register observers.  An
+///		observer must not be destroyed inside its own notification, since
+///		its unregistration is deferred past the callback.
+/// @see nik::PostBoard
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, bool PassData = true, typename P = Post<T>,
+		unsigned int SHARD_BITS = 4, typename A = std::allocator<P> >
+class ConcurrentPostBoard : public Observable<P> {
+public:
+
+	typedef T PostDataType;
+
+	typedef P PostType;
+
+	typedef typename PostType::PostID PostID;
+
+	typedef typename PostType::PostTraits PostTraits;
+
+	typedef typename Observable<P>::ObserverType ObserverType;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Where observers are notified
+	///////////////////////////////////////////////////////////////////////////
+	enum NotifyMode {
+		NOTIFY_IN_CALLER,			///< On the posting thread
+		NOTIFY_ON_DISPATCH_THREAD	///< On the board's dispatch thread
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Constructor
+	/// @param[in] mode Where observers are notified
+	/// @warning Throws nik::Error if the dispatch thread could not be started
+	///////////////////////////////////////////////////////////////////////////
+	explicit ConcurrentPostBoard(NotifyMode mode = NOTIFY_IN_CALLER)
+	: m_Mode(mode),
+	  m_ObserverLock(RWMutex::Create()),
+	  m_DeferredLock(Mutex::Create("concurrentpostboard.deferred")),
+	  m_HasDeferred(false),
+	  m_DispatchPending(false)
+	{
+		for(unsigned int i = 0; i < ShardCount; ++i)
+		{
+			m_Shards.push_back(new Shard(i));
+		}
+		if(m_Mode == NOTIFY_ON_DISPATCH_THREAD)
+		{
+			m_Dispatcher.SetName("nik-board");
+			if( !m_Dispatcher.Run(ThreadCoord<Dispatcher>(Dispatcher(this), RUN_WAIT_FOR_WORK)))
+			{
+				cleanUp();
+				throw Error("ConcurrentPostBoard - Failed to start the dispatch thread");
+			}
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Destructor
+	/// @details Dispatches the posts still queued, then stops the dispatch
+	///		thread.
+	///////////////////////////////////////////////////////////////////////////
+	virtual ~ConcurrentPostBoard()
+	{
+		if(m_Mode == NOTIFY_ON_DISPATCH_THREAD)
+		{
+			m_Dispatcher.Stop();
+			m_Dispatcher.WaitForStop();
+		}
+		cleanUp();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Register an observer
+	/// @details Safe to call while other threads are posting.
+	///////////////////////////////////////////////////////////////////////////
+	void registerObs(ObserverType* obs)
+	{
+		std::lock_guard<RWMutex> al(*m_ObserverLock);
+		Observable<P>::registerObs(obs);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Unregister an observer
+	/// @details Safe to call while other threads are posting.  Once this
+	///		returns the observer is not being notified and will not be again.
+	///		Also called by ~Observer.
+	///
+	///		Called from inside a notification of this board, the observer is
+	///		queued instead, and is unregistered once the notifying call lets
+	///		go of the observer list.
+	///////////////////////////////////////////////////////////////////////////
+	virtual void unregisterObs(ObserverType* obs)
+	{
+		if(NotifyMark::isNotifying(this))
+		{
+			std::lock_guard<Mutex> al(*m_DeferredLock);
+			m_Deferred.push_back(obs);
+			m_HasDeferred.store(true, std::memory_order_release);
+			return;
+		}
+		std::lock_guard<RWMutex> al(*m_ObserverLock);
+		Observable<P>::unregisterObs(obs);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Post a message to the board
+	/// @param[in] data The data to post, copied
+	/// @warning This function throws an exception if it fails to save to the
+	///		post.
+	/// @return The unique identifier for the post
+	///////////////////////////////////////////////////////////////////////////
+	PostID post(const PostDataType& data)
+	{
+		return emplace(data);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Post a message to the board
+	/// @param[in] data The data to post, moved into the post
+	/// @copydetails post(const PostDataType&)
+	///////////////////////////////////////////////////////////////////////////
+	PostID post(PostDataType&& data)
+	{
+		return emplace(std::move(data));
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Post a message constructed in place
+	/// @param[in] args Arguments for the PostDataType constructor
+	/// @warning This function throws an exception if it fails to save to the
+	///		post.
+	/// @return The unique identifier for the post
+	///////////////////////////////////////////////////////////////////////////
+	template <typename... ARGS>
+	PostID emplace(ARGS&&... args)
+	{
+		NIK_LATENCY_SCOPE("concurrentpostboard.post");
+		Shard& shard = lockShard();
+		std::unique_lock<Mutex> al(*shard.m_Lock, std::adopt_lock);
+		const PostType& stored = shard.m_Table.emplace(std::forward<ARGS>(args)...);
+		PostID id = stored.getID();
+		if(m_Mode == NOTIFY_IN_CALLER)
+		{
+			notifyStored(&stored);
+			al.unlock();
+			unregisterDeferred();
+			return id;
+		}
+
+		try {
+			shard.m_Pending.push_back(id);
+		}
+		catch(std::exception&)
+		{
+			shard.m_Table.erase(id);
+			throw;
+		}
+		al.unlock();
+
+		// The dispatcher clears the flag before it takes the queues, so
+		// either it sees this post or this thread wakes it
+		if( !m_DispatchPending.exchange(true))
+		{
+			m_Dispatcher.NotifyWork();
+		}
+		return id;
+	} // end emplace
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Remove a post from the board
+	/// @param[in] id The identifier of the post
+	/// @return true - The post was removed
+	///			false - There is no post with the identifier
+	///////////////////////////////////////////////////////////////////////////
+	bool remove(PostID id)
+	{
+		Shard& shard = *m_Shards[id & ShardMask];
+		std::lock_guard<Mutex> al(*shard.m_Lock);
+		return shard.m_Table.erase(id);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Call a function with a post on the board
+	/// @details The post's shard is locked during the call, so the post cannot
+	///		be removed or moved while the function reads it.
+	/// @param[in] id The identifier of the post
+	/// @param[in] func Called with a const PostType&
+	/// @return true - The function was called
+	///			false - There is no post with the identifier
+	///////////////////////////////////////////////////////////////////////////
+	template <typename FUNC>
+	bool visit(PostID id, FUNC func) const
+	{
+		Shard& shard = *m_Shards[id & ShardMask];
+		std::lock_guard<Mutex> al(*shard.m_Lock);
+		const PostType* post = shard.m_Table.find(id);
+		if( !post)
+		{
+			return false;
+		}
+		func(*post);
+		return true;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Number of posts on the board
+	/// @note Other threads may change the count while it is being added up
+	///////////////////////////////////////////////////////////////////////////
+	size_t size() const
+	{
+		size_t count = 0;
+		for(unsigned int i = 0; i < ShardCount; ++i)
+		{
+			std::lock_guard<Mutex> al(*m_Shards[i]->m_Lock);
+			count += m_Shards[i]->m_Table.size();
+		}
+		return count;
+	}
+
+private:
+	// Disable copy, and assignment
+	ConcurrentPostBoard(const ConcurrentPostBoard&);
+	ConcurrentPostBoard& operator=(const ConcurrentPostBoard&);
+
+	static const unsigned int ShardCount = 1u << SHARD_BITS;
+	static const unsigned int ShardMask = ShardCount - 1;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Storage for one shard, 24 bits of slot index
+	/// @details The rest of the 64 bit ID holds the shard and a 32 bit
+	///		generation.
+	///////////////////////////////////////////////////////////////////////////
+	typedef SlotPostTable<P, 24, SHARD_BITS, A> Table;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief A lock, its posts and the IDs waiting to be dispatched
+	///////////////////////////////////////////////////////////////////////////
+	struct Shard {
+		explicit Shard(unsigned int number)
+		: m_Lock(Mutex::Create("concurrentpostboard.shard")),
+		  m_Table(number)
+		{}
+
+		~Shard()
+		{
+			delete m_Lock;
+		}
+
+		Mutex* m_Lock;					///< Guards the rest of the shard
+		Table m_Table;					///< The shard's posts
+		std::vector<PostID> m_Pending;	///< Posted, not yet dispatched
+		char m_Pad[64];					///< Keeps shards off each other's cache lines
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Client functor of the dispatch thread
+	///////////////////////////////////////////////////////////////////////////
+	class Dispatcher {
+	public:
+		Dispatcher() : m_Board(0) {}
+		explicit Dispatcher(ConcurrentPostBoard* board) : m_Board(board) {}
+
+		bool Run(bool continueThread)
+		{
+			m_Board->dispatch();
+			return continueThread;
+		}
+
+	private:
+		ConcurrentPostBoard* m_Board;	///< The board to dispatch for
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Lock a shard for posting
+	/// @return The shard, locked
+	///////////////////////////////////////////////////////////////////////////
+	Shard& lockShard()
+	{
+		unsigned int first = threadShardHint();
+		for(unsigned int i = 0; i < ShardCount; ++i)
+		{
+			Shard& shard = *m_Shards[(first + i) & ShardMask];
+			if(shard.m_Lock->try_lock())
+			{
+				return shard;
+			}
+		}
+		Shard& shard = *m_Shards[first & ShardMask];
+		shard.m_Lock->lock();
+		return shard;
+	} // end lockShard
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify the observers of stored posts
+	/// @param[in] posts The posts, their shards locked
+	/// @param[in] count Number of posts
+	///////////////////////////////////////////////////////////////////////////
+	void notifyStored(const PostType* const* posts, size_t count)
+	{
+		NotifyMark mark(this);
+		m_ObserverLock->lock_shared();
+		if(PassData)
+		{
+			this->notifyAll(posts, count);
+		}
+		else
+		{
+			for(size_t i = 0; i < count; ++i)
+			{
+				this->notifyAll();
+			}
+		}
+		m_ObserverLock->unlock_shared();
+	}
+
+	void notifyStored(const PostType* post)
+	{
+		NotifyMark mark(this);
+		m_ObserverLock->lock_shared();
+		if(PassData)
+		{
+			this->notifyAll(*post);
+		}
+		else
+		{
+			this->notifyAll();
+		}
+		m_ObserverLock->unlock_shared();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Unregister the observers queued during notifications
+	/// @details Does nothing while this thread is notifying, since it still
+	///		holds the observer list shared.
+	///////////////////////////////////////////////////////////////////////////
+	void unregisterDeferred()
+	{
+		if( !m_HasDeferred.load(std::memory_order_acquire) || NotifyMark::isNotifying(this))
+		{
+			return;
+		}
+		std::vector<ObserverType*> deferred;
+		{
+			std::lock_guard<Mutex> al(*m_DeferredLock);
+			deferred.swap(m_Deferred);
+			m_HasDeferred.store(false, std::memory_order_relaxed);
+		}
+		std::lock_guard<RWMutex> al(*m_ObserverLock);
+		for(size_t i = 0; i < deferred.size(); ++i)
+		{
+			this->removeListed(deferred[i]);
+		}
+	} // end unregisterDeferred
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify the observers of every queued post
+	/// @details Called on the dispatch thread.
+	///////////////////////////////////////////////////////////////////////////
+	void dispatch()
+	{
+		m_DispatchPending.exchange(false);
+		for(unsigned int i = 0; i < ShardCount; ++i)
+		{
+			dispatchShard(*m_Shards[i], std::integral_constant<bool,
+				PostType::OnDestructPolicy::isCopyable>());
+			unregisterDeferred();
+		}
+	} // end dispatch
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify the observers of a shard's queued posts
+	/// @details The queue is swapped out and the posts copied with the shard
+	///		locked; the observers are called after it is unlocked.
+	///////////////////////////////////////////////////////////////////////////
+	void dispatchShard(Shard& shard, std::true_type)
+	{
+		{
+			std::lock_guard<Mutex> al(*shard.m_Lock);
+			if(shard.m_Pending.empty())
+			{
+				return;
+			}
+			m_Ids.swap(shard.m_Pending);
+			for(size_t j = 0; j < m_Ids.size(); ++j)
+			{
+				if(const PostType* post = shard.m_Table.find(m_Ids[j]))
+				{
+					m_Copies.push_back(*post);
+				}
+			}
+		}
+		m_Ids.clear();
+		for(size_t j = 0; j < m_Copies.size(); ++j)
+		{
+			m_Batch.push_back(&m_Copies[j]);
+		}
+		if( !m_Batch.empty())
+		{
+			notifyStored(&m_Batch[0], m_Batch.size());
+		}
+		m_Batch.clear();
+		m_Copies.clear();
+	} // end dispatchShard
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify the observers of a shard's queued posts
+	/// @details Posts that cannot be copied are notified in place, so the
+	///		shard stays locked.
+	///////////////////////////////////////////////////////////////////////////
+	void dispatchShard(Shard& shard, std::false_type)
+	{
+		std::lock_guard<Mutex> al(*shard.m_Lock);
+		if(shard.m_Pending.empty())
+		{
+			return;
+		}
+		m_Ids.swap(shard.m_Pending);
+		for(size_t j = 0; j < m_Ids.size(); ++j)
+		{
+			if(const PostType* post = shard.m_Table.find(m_Ids[j]))
+			{
+				m_Batch.push_back(post);
+			}
+		}
+		m_Ids.clear();
+		if( !m_Batch.empty())
+		{
+			notifyStored(&m_Batch[0], m_Batch.size());
+		}
+		m_Batch.clear();
+	} // end dispatchShard
+
+	void cleanUp()
+	{
+		for(size_t i = 0; i < m_Shards.size(); ++i)
+		{
+			delete m_Shards[i];
+		}
+		m_Shards.clear();
+		delete m_ObserverLock;
+		m_ObserverLock = 0;
+		delete m_DeferredLock;
+		m_DeferredLock = 0;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Marks this thread as notifying a board, while in scope
+	/// @details The marks of a thread are chained, so a board can tell it is
+	///		being notified further up the stack.
+	///////////////////////////////////////////////////////////////////////////
+	class NotifyMark {
+	public:
+		explicit NotifyMark(const ConcurrentPostBoard* board)
+		: m_Board(board),
+		  m_Prev(top())
+		{
+			top() = this;
+		}
+		~NotifyMark()
+		{
+			top() = m_Prev;
+		}
+		static bool isNotifying(const ConcurrentPostBoard* board)
+		{
+			for(const NotifyMark* mark = top(); mark; mark = mark->m_Prev)
+			{
+				if(mark->m_Board == board)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	private:
+		static NotifyMark*& top()
+		{
+			static thread_local NotifyMark* s_Top = 0;
+			return s_Top;
+		}
+		const ConcurrentPostBoard* m_Board;
+		NotifyMark* m_Prev;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Where observers are notified
+	///////////////////////////////////////////////////////////////////////////
+	const NotifyMode m_Mode;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief The shards, indexed by the low bits of a PostID
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<Shard*> m_Shards;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Guards the observer list, taken shared while notifying
+	///////////////////////////////////////////////////////////////////////////
+	RWMutex* m_ObserverLock;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Guards m_Deferred
+	///////////////////////////////////////////////////////////////////////////
+	Mutex* m_DeferredLock;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Observers unregistered during a notification, not yet removed
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<ObserverType*> m_Deferred;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Set when m_Deferred is not empty
+	///////////////////////////////////////////////////////////////////////////
+	std::atomic<bool> m_HasDeferred;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Set when a post has been queued since the last dispatch
+	///////////////////////////////////////////////////////////////////////////
+	std::atomic<bool> m_DispatchPending;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief The posts being dispatched, used by the dispatch thread only
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<const PostType*> m_Batch;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief The IDs swapped out of a shard's queue, dispatch thread only
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<PostID> m_Ids;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Copies of the posts being dispatched, dispatch thread only
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<PostType> m_Copies;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief The dispatch thread, used in NOTIFY_ON_DISPATCH_THREAD mode
+	///////////////////////////////////////////////////////////////////////////
+	ThreadObj<ThreadCoord<Dispatcher> > m_Dispatcher;
+
+}; // end class ConcurrentPostBoard
+
+} // end namespace nik
+
+#endif /* CONCURRENTPOSTBOARD_H_ */
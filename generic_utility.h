@@ -2,6 +2,7 @@
 /// @brief Definition for class todo
 /// @internal 
 /// Jun 22, 2013, nik: initial
+/// Oct 14, 2026, nik: Added release and isCopyable to DestructPolicy
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifndef GENERIC_UTILITY_H_
@@ -24,23 +25,42 @@ public:
 	typedef T2 Result;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Ownership policy for data held by a Post
+/// @details destroy() is called when the holder is destroyed, release()
+///		when the data has been moved to another holder.  isCopyable is false
+///		when two copies of the data cannot both be destroyed.
+///////////////////////////////////////////////////////////////////////////////
 template <typename D>
 class DestructPolicy {
 public:
+	enum { isCopyable = true };
+
 	static void destroy(D& obj)
 	{
 		// do nothing
 	}
+
+	static void release(D& obj)
+	{
+		// do nothing, the moved from object cleans up after itself
+	}
 };
 
 template <typename D>
 class DestructPolicy<D*> {
 public:
+	enum { isCopyable = false };
+
 	static void destroy(D*& obj)
 	{
 		delete obj;
 		obj = 0;
-		delete obj;
+	}
+
+	static void release(D*& obj)
+	{
+		obj = 0;
 	}
 };
 
@@ -3,6 +3,11 @@
 /// @internal
 /// 
 /// Jun 22, 2013, nik: initial
+/// Oct 14, 2026, nik: Added batched notification
+/// Oct 14, 2026, nik: Added the dispatch policy to Observable
+/// Oct 14, 2026, nik: Observers are kept in a dense list with O(1) removal
+/// Oct 14, 2026, nik: Added Observer::unregisterSelf
+/// Oct 14, 2026, nik: Added Observable::removeListed
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifndef OBSERVER_H_
@@ -10,16 +15,26 @@
 
 #include "exception.h"
 
-#include <vector>
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <vector>
 #include <assert.h>
 
 namespace nik {
 
 template <typename T>
+class ObservableBase;
+
+template <typename T>
+class SyncDispatch;
+
+template <typename T, typename D = SyncDispatch<T> >
 class Observable;
 
+template <typename T>
+class ObserverAccess;
+
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Observer Observer.h <Observer.h>
@@ -31,7 +46,12 @@ class Observer {
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Observable needs internal access
 	///////////////////////////////////////////////////////////////////////////
-	friend class Observable<T>;
+	template <typename, typename> friend class Observable;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Dispatch policies call the notify functions through this
+	///////////////////////////////////////////////////////////////////////////
+	friend class ObserverAccess<T>;
 
 public:
 
@@ -44,20 +64,33 @@ public:
 	/// @brief Default constructor
 	///////////////////////////////////////////////////////////////////////////
 	Observer()
-	: m_ID(InvalidID), m_Observable(0)
+	: m_ID(InvalidID), m_Observable(0), m_Index(0)
 	{}
 
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Destructor
 	///////////////////////////////////////////////////////////////////////////
 	virtual ~Observer();
-//	{
-//		if(m_Observable)
-//		{
-//			m_Observable->unregisterObs(this);
-//			m_Observable = 0;
-//		}
-//	} // end ~Observer
+
+protected:
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Unregister from the Observable, if registered
+	/// @details Returns once the Observer is not being notified and will not
+	///		be again, waiting for a call in progress on another thread.
+	/// @attention An Observer notified on other threads, ex. through
+	///		QueuedDispatch, must call this first thing in its own destructor.
+	///		~Observer also unregisters, but only after the derived members
+	///		are destroyed, while a notify may still be using them.
+	///////////////////////////////////////////////////////////////////////////
+	void unregisterSelf()
+	{
+		if(m_Observable)
+		{
+			m_Observable->unregisterObs(this);
+			m_Observable = 0;
+		}
+	}
 
 private:
 
@@ -80,6 +113,23 @@ private:
 	///////////////////////////////////////////////////////////////////////////
 	virtual void notify(const NotifyDataType& data) {}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify function for a batch of data
+	/// @details This function is called by Observable to notify the Observer
+	///		of several updates at once.
+	/// @param[in] data Pointers to the data for each update
+	/// @param[in] count Number of pointers in data
+	/// @note Calls notify(const NotifyDataType&) for each update by default.
+	///		Clients can override this method to handle the batch in one go.
+	///////////////////////////////////////////////////////////////////////////
+	virtual void notifyBatch(const NotifyDataType* const* data, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+		{
+			notify(*data[i]);
+		}
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Observer ID type
 	///////////////////////////////////////////////////////////////////////////
@@ -98,7 +148,7 @@ private:
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Observable type
 	///////////////////////////////////////////////////////////////////////////
-	typedef Observable<NotifyDataType> ObservableType;
+	typedef ObservableBase<NotifyDataType> ObservableType;
 
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief The Observable that this Observer observes
@@ -109,70 +159,88 @@ private:
 	///////////////////////////////////////////////////////////////////////////
 	ObservableType* m_Observable;
 
-
 	///////////////////////////////////////////////////////////////////////////
-	/// @class EqualPred EqualPred.h
-	/// @brief Equality predicate for Observer
-	/// @details  Useful for STL algorithms, this predicate determines if an
-	///		Observer is equal to some target observer.
-	/// @note Private declaration for class Observable to use.
+	/// @brief Position of this Observer in the Observable's list
 	///////////////////////////////////////////////////////////////////////////
-	class EqualPred {
-		///////////////////////////////////////////////////////////////////////
-		/// @brief ID of the Observer to determine equality.
-		///////////////////////////////////////////////////////////////////////
-		ObserverID m_TargetID;
-	public:
-		///////////////////////////////////////////////////////////////////////
-		/// @brief Constructor
-		/// @param[in] obs The target Observer to check for equality.
-		///////////////////////////////////////////////////////////////////////
-		EqualPred(Observer* obs)
-		: m_TargetID(obs->m_ID)
-		{}
-
-		///////////////////////////////////////////////////////////////////////
-		/// @brief Check for equality
-		/// @param[in] Check if the given Observer is equal to the target
-		///		Observer.
-		///	@return true - The given Observer matches the target
-		//			false - Not a match
-		///////////////////////////////////////////////////////////////////////
-		bool operator()(Observer* obs)
-		{
-			return m_TargetID == obs->m_ID;
-		}
-	}; // end class EqualPred
+	size_t m_Index;
 
+}; // end class Observer
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class ObservableBase observer.h
+/// @brief What an Observer knows of its Observable, whatever the dispatch
+///		policy
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class ObservableBase {
+public:
 	///////////////////////////////////////////////////////////////////////////
-	/// @class Notifier observer.h
-	/// @brief Functor to execute Observer<T>::notify method
-	///	@details Useful for STL algorithms
-	/// @note Private declaration Observable to use
+	/// @brief Unregister an Observer
+	/// @details Called by ~Observer for an Observer that is still
+	///		registered.
 	///////////////////////////////////////////////////////////////////////////
-	class Notifier {
-		const NotifyDataType& m_Data;
-	public:
-		///////////////////////////////////////////////////////////////////////
-		/// @brief Constructor
-		/// @param[in] data The notification data to pass to Observers
-		///////////////////////////////////////////////////////////////////////
-		Notifier(const NotifyDataType& data)
-		: m_Data(data)
-		{}
-
-		///////////////////////////////////////////////////////////////////////
-		/// @brief Notify the Observer, passing the notify data
-		/// @param[in] obs Notify this observer
-		///////////////////////////////////////////////////////////////////////
-		void operator()(Observer* obs)
-		{
-			obs->notify(m_Data);
-		}
-	}; // end class Notifier
+	virtual void unregisterObs(Observer<T>* obs) = 0;
 
+protected:
+	virtual ~ObservableBase() {}
+}; // end class ObservableBase
 
-}; // end class Observer
+///////////////////////////////////////////////////////////////////////////////
+/// @class ObserverAccess observer.h
+/// @brief Gives dispatch policies access to the Observer notify functions
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class ObserverAccess {
+public:
+	static void signal(Observer<T>* obs)
+	{
+		obs->signal();
+	}
+	static void notify(Observer<T>* obs, const T& data)
+	{
+		obs->notify(data);
+	}
+	static void notifyBatch(Observer<T>* obs, const T* const* data, size_t count)
+	{
+		obs->notifyBatch(data, count);
+	}
+}; // end class ObserverAccess
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class SyncDispatch observer.h
+/// @brief Dispatch policy that notifies observers in the caller
+/// @details The default policy of Observable.  A dispatch policy provides:
+///		@li Slot - Per observer state, kept by Observable
+///		@li attach(obs) - Called on registration, returns the observer's Slot
+///		@li detach(obs, slot) - Called on unregistration.  No notification
+///			may reach the observer once this returns.
+///		@li signal, notify and notifyBatch(obs, slot, ...) - Deliver a
+///			notification
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SyncDispatch {
+public:
+	struct Slot {};
+
+	Slot attach(Observer<T>*)
+	{
+		return Slot();
+	}
+	void detach(Observer<T>*, Slot&)
+	{}
+	void signal(Observer<T>* obs, Slot&)
+	{
+		ObserverAccess<T>::signal(obs);
+	}
+	void notify(Observer<T>* obs, Slot&, const T& data)
+	{
+		ObserverAccess<T>::notify(obs, data);
+	}
+	void notifyBatch(Observer<T>* obs, Slot&, const T* const* data, size_t count)
+	{
+		ObserverAccess<T>::notifyBatch(obs, data, count);
+	}
+}; // end class SyncDispatch
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @class Observable Observable.h <Observable.h>
@@ -180,9 +248,20 @@ private:
 /// @details This class is a part of the Observer pattern.  Observers can
 ///		register with an Observable object to receive notifications.
 /// @tparam T The data type that is passed for notifications
+/// @tparam D The dispatch policy, which delivers the notifications.
+///		SyncDispatch calls the observers in the notifying thread;
+///		QueuedDispatch queues them for a ThreadPool.
+/// @note Observers are kept in a dense list, in no particular order.
+///		Registering and unregistering are O(1); an unregistered Observer's
+///		place is taken by the last one.  An Observer may be registered with
+///		one Observable at a time.
+///
+///		An Observer may unregister itself or others, or register new
+///		ones, from inside a notification.  Unregistered Observers take no
+///		further part in it, and new ones wait for the next.
 ///////////////////////////////////////////////////////////////////////////////
-template <typename T>
-class Observable {
+template <typename T, typename D>
+class Observable : public ObservableBase<T> {
 public:
 
 	///////////////////////////////////////////////////////////////////////////
@@ -192,72 +271,154 @@ public:
 	typedef typename ObserverType::NotifyDataType NotifyDataType;
 	typedef typename ObserverType::ObserverID ObserverID;
 	static const ObserverID InvalidID = ObserverType::InvalidID;
+	typedef D DispatchPolicy;
 
-	Observable()
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Constructor
+	/// @param[in] dispatch The dispatch policy, copied
+	///////////////////////////////////////////////////////////////////////////
+	explicit Observable(const DispatchPolicy& dispatch = DispatchPolicy())
+	: m_NotifyDepth(0),
+	  m_Dispatch(dispatch)
 	{
 		m_FreeIDs.push_back(InvalidID + 1);
 	}
 
 	virtual ~Observable()
 	{
-		typename ObserverList::reverse_iterator end(m_ObserverList.begin());
-		for(typename ObserverList::reverse_iterator it(m_ObserverList.end()); it != end; ++it)
+		for(size_t i = m_ObserverList.size(); i > 0; --i)
 		{
-			unregisterObs(*it);
+			ObserverType* obs = m_ObserverList[i-1];
+			if(obs)
+			{
+				m_Dispatch.detach(obs, m_Slots[i-1]);
+				obs->m_ID = InvalidID;
+				obs->m_Observable = 0;
+			}
 		}
 	} // end ~Observable
 
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Register an Observer
+	/// @param[in] obs The Observer, does nothing if it is already registered
+	///		with this Observable
+	/// @warning Throws an exception if obs is registered with another
+	///		Observable
+	///////////////////////////////////////////////////////////////////////////
 	void registerObs(ObserverType* obs)
 	{
-		// If the observer has been assigned an ID, check to see
-		// if it's already been registered.
-		if(obs->m_ID != ObserverType::InvalidID)
+		if(obs->m_Observable == this)
 		{
-			typename ObserverList::const_iterator it =
-			std::find_if(m_ObserverList.begin(), m_ObserverList.end(), typename ObserverType::EqualPred(obs));
-			if(it == m_ObserverList.end())
-			{
-				return; // it has already been registered
-			}
-		} // end if(observer ID already set
+			return; // it has already been registered
+		}
+		if(obs->m_Observable)
+		{
+			RAISE_EXCEPTION("Observer is registered with another Observable.");
+		}
+		m_Slots.push_back(m_Dispatch.attach(obs));
+		try {
+			m_ObserverList.push_back(obs);
+		}
+		catch(std::exception&)
+		{
+			m_Dispatch.detach(obs, m_Slots.back());
+			m_Slots.pop_back();
+			throw;
+		}
 		obs->m_ID = generateID();
-		m_ObserverList.push_back(obs);
+		obs->m_Observable = this;
+		obs->m_Index = m_ObserverList.size() - 1;
 	} // end registerObs
 
-	void unregisterObs(ObserverType* obs)
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Unregister an Observer
+	/// @details Once this returns the dispatch policy delivers nothing more
+	///		to obs.
+	/// @warning Throws an exception if obs is not registered with this
+	///		Observable
+	///////////////////////////////////////////////////////////////////////////
+	virtual void unregisterObs(ObserverType* obs)
 	{
-		typename ObserverList::iterator it =
-				std::find_if(m_ObserverList.begin(),
-							m_ObserverList.end(),
-							typename ObserverType::EqualPred(obs)
-							);
-		if(it == m_ObserverList.end())
+		if(obs->m_Observable != this)
 		{
 			RAISE_EXCEPTION("Observer has not been registered with this Observable.");
 		}
-
-		(*it)->m_ID = InvalidID;
-		m_ObserverList.erase(it);
+		assert(obs->m_Index < m_ObserverList.size() &&
+			m_ObserverList[obs->m_Index] == obs);
+		removeListed(obs);
 	} // end unregisterObs
 
 protected:
 
-	void notifyAll()
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Unregister an Observer if it is still in the list
+	/// @details For Observables that defer an unregistration: by the time it
+	///		is carried out, unregisterSelf may have cleared the Observer's
+	///		link, or the Observer may have been unregistered already.
+	/// @return true - The Observer was unregistered
+	///			false - The Observer is not in the list
+	///////////////////////////////////////////////////////////////////////////
+	bool removeListed(ObserverType* obs)
 	{
-		std::for_each(
-				m_ObserverList.begin(),
-				m_ObserverList.end(),
-				std::mem_fun(&ObserverType::signal)
-		);
+		size_t index = obs->m_Index;
+		if(index >= m_ObserverList.size() || m_ObserverList[index] != obs)
+		{
+			return false;
+		}
+		m_Dispatch.detach(obs, m_Slots[index]);
+		freeID(obs->m_ID);
+		obs->m_ID = InvalidID;
+		obs->m_Observable = 0;
+		if(m_NotifyDepth.load(std::memory_order_relaxed) > 0)
+		{
+			// Being iterated, leave a hole until the notification is done
+			m_ObserverList[index] = 0;
+			m_Holes.push_back(index);
+		}
+		else
+		{
+			removeAt(index);
+		}
+		return true;
+	} // end removeListed
 
+	void notifyAll()
+	{
+		NotifyScope scope(*this);
+		for(size_t i = 0; i < scope.m_Count; ++i)
+		{
+			if(m_ObserverList[i])
+			{
+				m_Dispatch.signal(m_ObserverList[i], m_Slots[i]);
+			}
+		}
 	}
 	void notifyAll(const NotifyDataType& data)
 	{
-		std::for_each(
-				m_ObserverList.begin(),
-				m_ObserverList.end(),
-				typename ObserverType::Notifier(data)
-				);
+		NotifyScope scope(*this);
+		for(size_t i = 0; i < scope.m_Count; ++i)
+		{
+			if(m_ObserverList[i])
+			{
+				m_Dispatch.notify(m_ObserverList[i], m_Slots[i], data);
+			}
+		}
+	}
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify every Observer of a batch of updates, one call each
+	/// @param[in] data Pointers to the data for each update
+	/// @param[in] count Number of pointers in data
+	///////////////////////////////////////////////////////////////////////////
+	void notifyAll(const NotifyDataType* const* data, size_t count)
+	{
+		NotifyScope scope(*this);
+		for(size_t i = 0; i < scope.m_Count; ++i)
+		{
+			if(m_ObserverList[i])
+			{
+				m_Dispatch.notifyBatch(m_ObserverList[i], m_Slots[i], data, count);
+			}
+		}
 	}
 	ObserverID generateID()
 	{
@@ -276,11 +437,97 @@ protected:
 	}
 private:
 
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Marks a notification in progress
+	/// @details Holds the number of Observers to notify, so those registered
+	///		during the notification are skipped.  The outermost scope fills
+	///		the holes left by Observers unregistered in the meantime.
+	///////////////////////////////////////////////////////////////////////////
+	class NotifyScope {
+	public:
+		explicit NotifyScope(Observable& owner)
+		: m_Owner(owner),
+		  m_Count(owner.m_ObserverList.size())
+		{
+			m_Owner.m_NotifyDepth.fetch_add(1, std::memory_order_relaxed);
+		}
+		~NotifyScope()
+		{
+			if(m_Owner.m_NotifyDepth.fetch_sub(1, std::memory_order_relaxed) == 1 &&
+			   !m_Owner.m_Holes.empty())
+			{
+				m_Owner.fillHoles();
+			}
+		}
+		Observable& m_Owner;
+		const size_t m_Count;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Move the last Observer into index and drop the last entry
+	///////////////////////////////////////////////////////////////////////////
+	void removeAt(size_t index)
+	{
+		size_t last = m_ObserverList.size() - 1;
+		if(index != last)
+		{
+			m_ObserverList[index] = m_ObserverList[last];
+			m_Slots[index] = m_Slots[last];
+			if(m_ObserverList[index])
+			{
+				m_ObserverList[index]->m_Index = index;
+			}
+		}
+		m_ObserverList.pop_back();
+		m_Slots.pop_back();
+	} // end removeAt
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Remove the holes left during a notification
+	/// @details Highest first, so the entry moved into each hole is never
+	///		itself a hole.
+	///////////////////////////////////////////////////////////////////////////
+	void fillHoles()
+	{
+		std::sort(m_Holes.begin(), m_Holes.end(), std::greater<size_t>());
+		for(size_t i = 0; i < m_Holes.size(); ++i)
+		{
+			removeAt(m_Holes[i]);
+		}
+		m_Holes.clear();
+	} // end fillHoles
+
 	typedef std::vector<ObserverType*> ObserverList;
 	typedef std::vector<ObserverID> ObserverIDList;
 	ObserverIDList m_FreeIDs;
 
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief The Observers, 0 for a hole left during a notification
+	///////////////////////////////////////////////////////////////////////////
 	ObserverList m_ObserverList;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Dispatch state of each observer, parallel to m_ObserverList
+	///////////////////////////////////////////////////////////////////////////
+	typedef std::vector<typename DispatchPolicy::Slot> SlotList;
+	SlotList m_Slots;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Indexes of the holes in m_ObserverList
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<size_t> m_Holes;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Number of notifications in progress
+	/// @note Atomic so that several threads may notify at once, as long as
+	///		no Observer is registered or unregistered meanwhile.
+	///////////////////////////////////////////////////////////////////////////
+	std::atomic<unsigned int> m_NotifyDepth;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Delivers the notifications
+	///////////////////////////////////////////////////////////////////////////
+	DispatchPolicy m_Dispatch;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -291,11 +538,7 @@ private:
 template<typename T>
 Observer<T>::~Observer()
 {
-	if(m_Observable)
-	{
-		m_Observable->unregisterObs(this);
-		m_Observable = 0;
-	}
+	unregisterSelf();
 } // end ~Observer
 
 } /* namespace nik */
@@ -0,0 +1,325 @@
+////////////////////////////////////////////////////////////////////////////////
+/// @brief Declaration of FixedPool, PoolAllocator and PoolDestructPolicy
+/// @internal
+///
+/// Oct 14, 2026, nik: initial
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef POOLALLOCATOR_H_
+#define POOLALLOCATOR_H_
+
+#include "generic_utility.h"
+#include "Mutex.h"
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class FixedPool poolallocator.h <posterboard/poolallocator.h>
+/// @brief Thread cached pool of fixed size blocks
+/// @details Each thread keeps a list of free blocks, so allocating and
+///		freeing are a few instructions with no lock.  A thread that runs out
+///		takes a batch of blocks from a shared list, or carves a new chunk; a
+///		thread holding too many gives a batch back.  Blocks may be freed by
+///		any thread.  A thread's blocks go back to the shared list when it
+///		exits.
+/// @tparam BLOCK_SIZE Size of the blocks, a multiple of the largest
+///		fundamental alignment
+/// @note Chunks are never returned to the heap; the pool keeps the most
+///		memory that was ever in use.
+///////////////////////////////////////////////////////////////////////////////
+template <size_t BLOCK_SIZE>
+class FixedPool {
+public:
+
+	static_assert(BLOCK_SIZE % alignof(std::max_align_t) == 0,
+		"Blocks must keep the fundamental alignment");
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Take a block
+	/// @warning Throws std::bad_alloc if there is no memory
+	/// @return A block of BLOCK_SIZE bytes
+	///////////////////////////////////////////////////////////////////////////
+	static void* allocate()
+	{
+		Cache& cache = localCache();
+		if( !cache.m_Free)
+		{
+			refill(cache);
+		}
+		Block* block = cache.m_Free;
+		cache.m_Free = block->m_Next;
+		--cache.m_Count;
+		return block;
+	} // end allocate
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Return a block
+	/// @param[in] memory A block from allocate(), on any thread
+	///////////////////////////////////////////////////////////////////////////
+	static void deallocate(void* memory)
+	{
+		Cache& cache = localCache();
+		Block* block = static_cast<Block*>(memory);
+		block->m_Next = cache.m_Free;
+		cache.m_Free = block;
+		if(++cache.m_Count > LocalLimit || cache.m_Exited)
+		{
+			giveBack(cache, cache.m_Exited ? cache.m_Count : Batch);
+		}
+	} // end deallocate
+
+private:
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Most blocks a thread keeps, and how many move between lists
+	///		at once
+	///////////////////////////////////////////////////////////////////////////
+	static const size_t LocalLimit = 256;
+	static const size_t Batch = 64;
+
+	struct Block {
+		Block* m_Next;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief A thread's free blocks
+	/// @details Trivially destructible, so it can still be used by static
+	///		destructors that run after the thread's Flusher.
+	///////////////////////////////////////////////////////////////////////////
+	struct Cache {
+		Block* m_Free;
+		size_t m_Count;
+		bool m_Exited;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Gives a thread's blocks back when it exits
+	///////////////////////////////////////////////////////////////////////////
+	struct Flusher {
+		~Flusher()
+		{
+			Cache& cache = cacheStorage();
+			cache.m_Exited = true;
+			giveBack(cache, cache.m_Count);
+		}
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Free blocks shared by all threads
+	/// @details Never destroyed, so threads exiting during static destruction
+	///		can still give their blocks back.
+	///////////////////////////////////////////////////////////////////////////
+	struct Shared {
+		Shared() : m_Lock(Mutex::Create("pool.shared")), m_Free(0) {}
+		Mutex* m_Lock;
+		Block* m_Free;
+	};
+
+	static Shared& shared()
+	{
+		static Shared* s = new Shared;
+		return *s;
+	}
+
+	static Cache& cacheStorage()
+	{
+		static thread_local Cache cache = { 0, 0, false };
+		return cache;
+	}
+
+	static Cache& localCache()
+	{
+		static thread_local Flusher flusher;
+		(void)flusher;
+		return cacheStorage();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Take a batch from the shared list, or carve a new chunk
+	///////////////////////////////////////////////////////////////////////////
+	static void refill(Cache& cache)
+	{
+		Shared& s = shared();
+		{
+			std::lock_guard<Mutex> al(*s.m_Lock);
+			for(size_t i = 0; i < Batch && s.m_Free; ++i)
+			{
+				Block* block = s.m_Free;
+				s.m_Free = block->m_Next;
+				block->m_Next = cache.m_Free;
+				cache.m_Free = block;
+				++cache.m_Count;
+			}
+		}
+		if(cache.m_Free)
+		{
+			return;
+		}
+		char* chunk = static_cast<char*>(::operator new(BLOCK_SIZE * Batch));
+		for(size_t i = Batch; i > 0; --i)
+		{
+			Block* block = reinterpret_cast<Block*>(chunk + (i - 1) * BLOCK_SIZE);
+			block->m_Next = cache.m_Free;
+			cache.m_Free = block;
+		}
+		cache.m_Count += Batch;
+	} // end refill
+
+	static void giveBack(Cache& cache, size_t count)
+	{
+		if(count == 0)
+		{
+			return;
+		}
+		Block* first = cache.m_Free;
+		Block* last = first;
+		for(size_t i = 1; i < count; ++i)
+		{
+			last = last->m_Next;
+		}
+		cache.m_Free = last->m_Next;
+		cache.m_Count -= count;
+
+		Shared& s = shared();
+		std::lock_guard<Mutex> al(*s.m_Lock);
+		last->m_Next = s.m_Free;
+		s.m_Free = first;
+	} // end giveBack
+}; // end class FixedPool
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class PoolAllocator poolallocator.h <posterboard/poolallocator.h>
+/// @brief Standard allocator that takes single objects from a FixedPool
+/// @details Stateless; every PoolAllocator of the same block size shares one
+///		pool.  Single objects, such as map nodes, come from the pool; arrays,
+///		such as vector storage, come from the heap.
+/// @tparam T The allocated type
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class PoolAllocator {
+public:
+
+	typedef T value_type;
+
+	template <typename U>
+	struct rebind {
+		typedef PoolAllocator<U> other;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Size of the pool blocks for T
+	///////////////////////////////////////////////////////////////////////////
+	static const size_t BlockSize = (sizeof(T) + alignof(std::max_align_t) - 1)
+			/ alignof(std::max_align_t) * alignof(std::max_align_t);
+
+	typedef FixedPool<BlockSize> PoolType;
+
+	PoolAllocator()
+	{}
+
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U>&)
+	{}
+
+	T* allocate(size_t count)
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t),
+			"Over aligned types are not supported");
+		if(count == 1)
+		{
+			return static_cast<T*>(PoolType::allocate());
+		}
+		return static_cast<T*>(::operator new(count * sizeof(T)));
+	}
+
+	void deallocate(T* memory, size_t count)
+	{
+		if(count == 1)
+		{
+			PoolType::deallocate(memory);
+		}
+		else
+		{
+			::operator delete(memory);
+		}
+	}
+}; // end class PoolAllocator
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&)
+{
+	return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&)
+{
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create an object in its pool
+/// @param[in] args Arguments for the T constructor
+/// @return The object, to be freed with poolDelete or PoolDestructPolicy
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename... ARGS>
+T* poolNew(ARGS&&... args)
+{
+	void* memory = PoolAllocator<T>::PoolType::allocate();
+	try {
+		return new(memory) T(std::forward<ARGS>(args)...);
+	}
+	catch(...)
+	{
+		PoolAllocator<T>::PoolType::deallocate(memory);
+		throw;
+	}
+} // end poolNew
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Destroy an object created by poolNew
+/// @param[in] obj The object, may be 0
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void poolDelete(T* obj)
+{
+	if(obj)
+	{
+		obj->~T();
+		PoolAllocator<T>::PoolType::deallocate(obj);
+	}
+} // end poolDelete
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Ownership policy for Post data created by poolNew
+/// @details Like DestructPolicy<D*>, but returns the data to its pool.
+/// @warning The data must be a D, not a class derived from it, which would
+///		belong to another pool.
+///////////////////////////////////////////////////////////////////////////////
+template <typename D>
+class PoolDestructPolicy;
+
+template <typename D>
+class PoolDestructPolicy<D*> {
+public:
+	enum { isCopyable = false };
+
+	static void destroy(D*& obj)
+	{
+		poolDelete(obj);
+		obj = 0;
+	}
+
+	static void release(D*& obj)
+	{
+		obj = 0;
+	}
+};
+
+} /* namespace nik */
+#endif /* POOLALLOCATOR_H_ */
@@ -3,6 +3,10 @@
 /// @internal
 /// 
 /// Jun 22, 2013, nik: initial
+/// Oct 14, 2026, nik: The ID is no longer const so posts can be assigned
+/// Oct 14, 2026, nik: PostID is 64 bits, leaving room for a wide generation
+/// Oct 14, 2026, nik: Added move and in place construction
+/// Oct 14, 2026, nik: Added Topic_Traits
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifndef POST_H_
@@ -10,6 +14,10 @@
 
 #include "generic_utility.h"
 
+#include <stdint.h>
+#include <utility>
+#include <type_traits>
+
 namespace nik {
 
 template <typename T>
@@ -42,9 +50,41 @@ public:
 
 }; // end class Post_Traits
 
+///////////////////////////////////////////////////////////////////////////////
+/// @class Topic_Traits post.h <posterboard/post.h>
+/// @brief Tells PostBoard which topic a post's data belongs to
+/// @details By default data has no topic.  Specialize for a data type to let
+///		observers subscribe to a topic, e.g.
+/// @code
+/// template <>
+/// class Topic_Traits<Quote> {
+/// public:
+/// 	enum { hasKey = true };
+/// 	typedef std::string KeyType;
+/// 	static const KeyType& key(const Quote& q) { return q.m_Symbol; }
+/// };
+/// @endcode
+///		KeyType must be usable as a std::unordered_map key.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class Topic_Traits {
+public:
+	enum { hasKey = false };
+	typedef NullType KeyType;
+}; // end class Topic_Traits
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tag selecting the Post constructor that builds the data in place
+///////////////////////////////////////////////////////////////////////////////
+struct InPlace {};
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @class Post Post.h <posterboard/post.h>
+/// @details The data's ownership is handled by the destruct policy D.  A
+///		post can always be moved, which hands the data over and releases it
+///		from the source.  A post can only be copied if D::isCopyable, so a
+///		pointer owned through DestructPolicy<T*> is never deleted twice.
 ////////////////////////////////////////////////////////////////////////////////
 template <typename T, typename D =  DestructPolicy<T> >
 class Post
@@ -54,7 +94,7 @@ public:
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Post ID type
 	///////////////////////////////////////////////////////////////////////////
-	typedef unsigned int PostID;
+	typedef uint64_t PostID;
 
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Post traits
@@ -81,6 +121,63 @@ public:
 	  m_PostID(id)
 	{}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Constructor
+	/// @param[in] data The data for the post, moved into the post
+	///////////////////////////////////////////////////////////////////////////
+	Post(PostDataType&& data, PostID id)
+	: m_Data(std::move(data)),
+	  m_PostID(id)
+	{}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Constructor
+	/// @details Constructs the data in place from the arguments.
+	/// @param[in] id The post ID
+	/// @param[in] args Arguments for the PostDataType constructor
+	///////////////////////////////////////////////////////////////////////////
+	template <typename... ARGS>
+	Post(InPlace, PostID id, ARGS&&... args)
+	: m_Data(std::forward<ARGS>(args)...),
+	  m_PostID(id)
+	{}
+
+	Post(const Post& orig)
+	: m_Data(orig.m_Data),
+	  m_PostID(orig.m_PostID)
+	{
+		static_assert(OnDestructPolicy::isCopyable,
+			"Copying this Post would destroy its data twice");
+	}
+
+	Post(Post&& orig) noexcept(std::is_nothrow_move_constructible<T>::value)
+	: m_Data(std::move(orig.m_Data)),
+	  m_PostID(orig.m_PostID)
+	{
+		OnDestructPolicy::release(orig.m_Data);
+	}
+
+	Post& operator=(const Post& rhs)
+	{
+		static_assert(OnDestructPolicy::isCopyable,
+			"Copying this Post would destroy its data twice");
+		m_Data = rhs.m_Data;
+		m_PostID = rhs.m_PostID;
+		return *this;
+	}
+
+	Post& operator=(Post&& rhs)
+	{
+		if(this != &rhs)
+		{
+			OnDestructPolicy::destroy(m_Data);
+			m_Data = std::move(rhs.m_Data);
+			OnDestructPolicy::release(rhs.m_Data);
+			m_PostID = rhs.m_PostID;
+		}
+		return *this;
+	}
+
 	~Post()
 	{
 		OnDestructPolicy::destroy(m_Data);
@@ -109,7 +206,7 @@ public:
 private:
 
 	PostDataType m_Data;
-	const PostID m_PostID;
+	PostID m_PostID;
 
 };
 
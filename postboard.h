@@ -3,6 +3,13 @@
 /// @internal
 /// 
 /// June 22, 2013, nik: initial
+/// Oct 14, 2026, nik: Added the storage policy, slot map by default
+/// Oct 14, 2026, nik: Added remove, get and postBatch
+/// Oct 14, 2026, nik: Added emplace and post(T&&), observers get the stored
+///		post
+/// Oct 14, 2026, nik: Added topic and filter subscriptions
+/// Oct 14, 2026, nik: Added the allocator parameter
+/// Oct 14, 2026, nik: Added latency probes to emplace and postBatch
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifndef POSTBOARD_H_
@@ -15,19 +22,40 @@
 ///		modifying posts, and removing posts.  This class is templated to work
 ///		with a single type.  That type can be polymorphic.
 /// @tparam T Data type for the posts.  There are no requirements on this type.
+/// @tparam A Allocator for the stored posts; PoolAllocator takes map nodes
+///		from a thread cached pool.  For pointer data, Post<T,
+///		PoolDestructPolicy<T> > with poolNew() pools the data as well.
+/// @tparam S Storage for the posts and their IDs.  SlotPostTable gives O(1)
+///		insert, lookup and removal over contiguous memory; MapPostTable keeps
+///		the posts ordered by ID.
+/// @note Observers registered with registerObs() get every post.  An
+///		observer can instead subscribe to the posts of a topic, given by
+///		Topic_Traits<T>, or to the posts that pass a filter.  The board keeps
+///		an index from topic to subscribers, so a post only visits the
+///		observers of its topic.  An observer gets a post once for each of
+///		its registrations and subscriptions that match it.
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "post.h"
 #include "exception.h"
 #include "observer.h"
+#include "posttable.h"
+#include "poolallocator.h"
+#include "Function.h"
+#include "LatencyHistogram.h"
 
 #include <string>
-#include <map>
-#include <stack>
+#include <vector>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 namespace nik{
 
-template <typename T, bool PassData = true, typename P = Post<T> >
+template <typename T, bool PassData = true, typename P = Post<T>,
+		typename A = std::allocator<P>, typename S = SlotPostTable<P, 24, 0, A> >
 class PostBoard : public Observable<P> {
 public:
 
@@ -39,87 +67,304 @@ public:
 
 	typedef typename PostType::PostTraits PostTraits;
 
+	typedef S StorageType;
+
+	typedef A allocator_type;
+
+	typedef typename Observable<P>::ObserverType ObserverType;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Topic of the post data, see Topic_Traits
+	///////////////////////////////////////////////////////////////////////////
+	typedef Topic_Traits<PostDataType> TopicTraits;
+	typedef typename TopicTraits::KeyType TopicKey;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Filter for subscribeIf(), true to deliver the data
+	///////////////////////////////////////////////////////////////////////////
+	typedef Function<bool(const PostDataType&)> Filter;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Subscription handle
+	///////////////////////////////////////////////////////////////////////////
+	typedef unsigned int SubscriptionID;
+	static const SubscriptionID InvalidSubscription = 0;
+
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Constructor
 	///////////////////////////////////////////////////////////////////////////
 	PostBoard()
-	{
-		m_FreeIDs.push(0);
-	}
+	: m_FreeSubscription(NoSubscription)
+	{}
 
 	///////////////////////////////////////////////////////////////////////////
 	/// @brief Post a message to the board
 	/// @details Posts a message to the board.  PostBoard stores its own copy
-	///		of the data.
+	///		of the data.  Observers are notified with the stored post.
 	/// @param[in] data The data to post
 	/// @warning This function throws an exception if it fails to save to the
 	///		post.
+	/// @warning Observers must not post to or remove from this board while
+	///		being notified.
 	/// @return The unique identifier for the post
 	///////////////////////////////////////////////////////////////////////////
 	PostID post(const PostDataType& data)
 	{
-		PostID id = generateID();
+		return emplace(data);
+	} // end Post
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Post a message to the board
+	/// @details Moves the data into the stored post.
+	/// @copydetails post(const PostDataType&)
+	///////////////////////////////////////////////////////////////////////////
+	PostID post(PostDataType&& data)
+	{
+		return emplace(std::move(data));
+	} // end Post
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Post a message constructed in place
+	/// @details Constructs the data of the stored post from the arguments,
+	///		without a temporary post or copy.
+	/// @param[in] args Arguments for the PostDataType constructor
+	/// @warning This function throws an exception if it fails to save to the
+	///		post.
+	/// @return The unique identifier for the post
+	///////////////////////////////////////////////////////////////////////////
+	template <typename... ARGS>
+	PostID emplace(ARGS&&... args)
+	{
+		NIK_LATENCY_SCOPE("postboard.post");
+		const PostType& stored = m_PostsTable.emplace(std::forward<ARGS>(args)...);
+		PostID id = stored.getID();
+		if(PassData)
+		{
+			this->notifyAll(stored);
+		}
+		else
+		{
+			this->notifyAll();
+		}
+		if( !m_Subscriptions.empty())
+		{
+			notifySubscribers(stored);
+		}
+		return id;
+	} // end emplace
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Post several messages to the board
+	/// @details Stores every message, then notifies each observer once for
+	///		the whole batch through Observer::notifyBatch, or signals each
+	///		observer once if PassData is false.  Subscribers are notified
+	///		once per subscription with the posts that match it.
+	/// @param[in] first The first data to post
+	/// @param[in] last One past the last data to post
+	/// @warning This function throws an exception if it fails to save any of
+	///		the posts.  None of the batch is posted in that case.
+	/// @return The identifiers of the posts, in the order of the data
+	///////////////////////////////////////////////////////////////////////////
+	template <typename ForwardIt>
+	std::vector<PostID> postBatch(ForwardIt first, ForwardIt last)
+	{
+		NIK_LATENCY_SCOPE("postboard.post_batch");
+		std::vector<PostID> ids(std::distance(first, last));
+		m_PostsTable.reserve(ids.size());
+		size_t count = 0;
 		try {
-			std::pair<typename PostsTable::iterator, bool> rtn =
-				m_PostsTable.insert(
-						std::make_pair(
-								id,
-								PostType(data,id)
-								)
-						);
-
-			if( !rtn.second)
+			for(; first != last; ++first, ++count)
+			{
+				ids[count] = m_PostsTable.emplace(*first).getID();
+			}
+			if(PassData)
 			{
-				RAISE_EXCEPTION("Failed to add message to board.");
+				m_Batch.resize(ids.size());
 			}
 		} // end try
 		catch(std::exception&)
 		{
-			freeID(id);
+			while(count > 0)
+			{
+				m_PostsTable.erase(ids[--count]);
+			}
 			throw;
 		}
+		if(ids.empty())
+		{
+			return ids;
+		}
 		if(PassData)
 		{
-			this->notifyAll(PostType(data, id));
+			for(size_t i = 0; i < ids.size(); ++i)
+			{
+				m_Batch[i] = m_PostsTable.find(ids[i]);
+			}
+			this->notifyAll(&m_Batch[0], m_Batch.size());
 		}
 		else
 		{
 			this->notifyAll();
 		}
-		return id;
-	} // end Post
+		if( !m_Subscriptions.empty())
+		{
+			notifySubscribers(ids);
+		}
+		return ids;
+	} // end postBatch
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief Destructor
+	/// @brief Remove a post from the board
+	/// @details The post's identifier may be given to a later post.
+	/// @param[in] id The identifier of the post
+	/// @return true - The post was removed
+	///			false - There is no post with the identifier
 	///////////////////////////////////////////////////////////////////////////
-	virtual ~PostBoard()
-	{}
+	bool remove(PostID id)
+	{
+		return m_PostsTable.erase(id);
+	} // end remove
 
-protected:
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Get a post on the board
+	/// @param[in] id The identifier of the post
+	/// @return The post, or 0 if there is no post with the identifier.  The
+	///		pointer is valid until the board is next changed.
+	///////////////////////////////////////////////////////////////////////////
+	const PostType* get(PostID id) const
+	{
+		return m_PostsTable.find(id);
+	} // end get
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief Generate a post identifier
-	/// @return Returns an unused identifier - for this board
+	/// @brief Number of posts on the board
 	///////////////////////////////////////////////////////////////////////////
-	PostID generateID()
+	size_t size() const
 	{
-		PostID id = m_FreeIDs.top();
-		m_FreeIDs.pop();
-		if(m_FreeIDs.empty())
+		return m_PostsTable.size();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Subscribe an observer to the posts of a topic
+	/// @details Only available if Topic_Traits<PostDataType>::hasKey.
+	/// @param[in] obs The observer, notified as if registered
+	/// @param[in] key The topic
+	/// @warning Observers must unsubscribe before they are destroyed, and
+	///		must not subscribe or unsubscribe while being notified.
+	/// @return The handle for unsubscribe()
+	///////////////////////////////////////////////////////////////////////////
+	SubscriptionID subscribe(ObserverType* obs, const TopicKey& key)
+	{
+		static_assert(TopicTraits::hasKey, "The post data has no Topic_Traits");
+		unsigned int slot = takeSubscription();
+		Topic* topic = 0;
+		try {
+			std::pair<typename TopicMap::iterator, bool> rtn =
+				m_Topics.insert(typename TopicMap::value_type(key, Topic()));
+			topic = &rtn.first->second;
+			topic->m_Key = &rtn.first->first;
+			topic->m_Observers.push_back(obs);
+			topic->m_Slots.push_back(slot);
+		} // end try
+		catch(std::exception&)
 		{
-			m_FreeIDs.push(id+1);
+			if(topic)
+			{
+				topic->m_Observers.resize(topic->m_Slots.size());
+				if(topic->m_Slots.empty())
+				{
+					eraseTopic(*topic);
+				}
+			}
+			freeSubscription(slot);
+			throw;
 		}
-		return id;
-	} // end generateID
+		m_Subscriptions[slot].m_Topic = topic;
+		m_Subscriptions[slot].m_Index = topic->m_Slots.size() - 1;
+		return makeSubscriptionID(slot);
+	} // end subscribe
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Subscribe an observer to the posts that pass a filter
+	/// @details The filter is called for every post, so a topic is cheaper
+	///		where one will do.
+	/// @param[in] obs The observer, notified as if registered
+	/// @param[in] filter Called with the data of each post
+	/// @warning See subscribe()
+	/// @return The handle for unsubscribe()
+	///////////////////////////////////////////////////////////////////////////
+	SubscriptionID subscribeIf(ObserverType* obs, Filter filter)
+	{
+		unsigned int slot = takeSubscription();
+		try {
+			m_Filtered.push_back(Filtered());
+		}
+		catch(std::exception&)
+		{
+			freeSubscription(slot);
+			throw;
+		}
+		Filtered& f = m_Filtered.back();
+		f.m_Observer = obs;
+		f.m_Filter = std::move(filter);
+		f.m_Slot = slot;
+		m_Subscriptions[slot].m_Topic = 0;
+		m_Subscriptions[slot].m_Index = m_Filtered.size() - 1;
+		return makeSubscriptionID(slot);
+	} // end subscribeIf
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief Free up a PostID
-	/// @param[in] id ID to free
+	/// @brief End a subscription
+	/// @param[in] id The handle from subscribe() or subscribeIf()
+	/// @return true - The subscription was ended
+	///			false - No subscription has the handle
 	///////////////////////////////////////////////////////////////////////////
-	void freeID(PostID id)
+	bool unsubscribe(SubscriptionID id)
 	{
-		m_FreeIDs.push(id);
-	} // end freeID
+		unsigned int slot = id & SubscriptionIndexMask;
+		if(slot >= m_Subscriptions.size() ||
+		   m_Subscriptions[slot].m_Free ||
+		   m_Subscriptions[slot].m_Generation != (id >> SubscriptionIndexBits))
+		{
+			return false;
+		}
+		Subscription& sub = m_Subscriptions[slot];
+		if(sub.m_Topic)
+		{
+			Topic& topic = *sub.m_Topic;
+			size_t last = topic.m_Slots.size() - 1;
+			if(sub.m_Index != last)
+			{
+				topic.m_Observers[sub.m_Index] = topic.m_Observers[last];
+				topic.m_Slots[sub.m_Index] = topic.m_Slots[last];
+				m_Subscriptions[topic.m_Slots[sub.m_Index]].m_Index = sub.m_Index;
+			}
+			topic.m_Observers.pop_back();
+			topic.m_Slots.pop_back();
+			if(topic.m_Slots.empty())
+			{
+				eraseTopic(topic);
+			}
+		}
+		else
+		{
+			size_t last = m_Filtered.size() - 1;
+			if(sub.m_Index != last)
+			{
+				m_Filtered[sub.m_Index] = std::move(m_Filtered[last]);
+				m_Subscriptions[m_Filtered[sub.m_Index].m_Slot].m_Index = sub.m_Index;
+			}
+			m_Filtered.pop_back();
+		}
+		freeSubscription(slot);
+		return true;
+	} // end unsubscribe
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Destructor
+	///////////////////////////////////////////////////////////////////////////
+	virtual ~PostBoard()
+	{}
 
 private:
 	// Disable copy, and assignment
@@ -127,24 +372,248 @@ private:
 	PostBoard& operator=(const PostBoard&);
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief A stack of PostIDs
+	/// @brief Contained posts
 	///////////////////////////////////////////////////////////////////////////
-	typedef std::stack<PostID> IDStack;
+	StorageType m_PostsTable;
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief Contains the available PostIDs
+	/// @brief The posts of the batch being notified, kept to reuse its memory
 	///////////////////////////////////////////////////////////////////////////
-	IDStack m_FreeIDs;
+	std::vector<const PostType*> m_Batch;
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief Posts table type
+	/// @brief Subscribers to one topic
+	/// @details m_Observers is kept dense for notification, m_Slots holds
+	///		the m_Subscriptions slot of each so a removal can be swapped in.
+	///		m_Key points at the topic's key in m_Topics.
 	///////////////////////////////////////////////////////////////////////////
-	typedef std::map<PostID, PostType> PostsTable;
+	struct Topic {
+		Topic() : m_Key(0) {}
+		const TopicKey* m_Key;
+		std::vector<ObserverType*> m_Observers;
+		std::vector<unsigned int> m_Slots;
+	};
 
 	///////////////////////////////////////////////////////////////////////////
-	/// @brief Contained posts
+	/// @brief A filter subscription
+	///////////////////////////////////////////////////////////////////////////
+	struct Filtered {
+		ObserverType* m_Observer;
+		Filter m_Filter;
+		unsigned int m_Slot;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Where a subscription is
+	/// @details m_Index is the position in m_Topic, or in m_Filtered if
+	///		m_Topic is 0, or the next free slot while the slot is free.
+	///////////////////////////////////////////////////////////////////////////
+	struct Subscription {
+		Topic* m_Topic;
+		unsigned int m_Index;
+		unsigned int m_Generation;
+		bool m_Free;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Hash for boards without topics, never called
+	///////////////////////////////////////////////////////////////////////////
+	struct NullHash {
+		size_t operator()(const TopicKey&) const { return 0; }
+	};
+	typedef typename std::conditional<TopicTraits::hasKey,
+			std::hash<TopicKey>, NullHash>::type TopicHash;
+	typedef std::unordered_map<TopicKey, Topic, TopicHash> TopicMap;
+
+	static const unsigned int SubscriptionIndexBits = 24;
+	static const unsigned int SubscriptionIndexMask = (1u << SubscriptionIndexBits) - 1;
+	static const unsigned int NoSubscription = ~0u;
+
+	SubscriptionID makeSubscriptionID(unsigned int slot) const
+	{
+		return (m_Subscriptions[slot].m_Generation << SubscriptionIndexBits) | slot;
+	}
+
+	unsigned int takeSubscription()
+	{
+		unsigned int slot = m_FreeSubscription;
+		if(slot != NoSubscription)
+		{
+			m_FreeSubscription = m_Subscriptions[slot].m_Index;
+		}
+		else
+		{
+			if(m_Subscriptions.size() > SubscriptionIndexMask)
+			{
+				RAISE_EXCEPTION("Too many subscriptions.");
+			}
+			slot = m_Subscriptions.size();
+			// Generations start at 1 so no handle is InvalidSubscription
+			Subscription sub = { 0, NoSubscription, 1, false };
+			m_Pending.resize(slot + 1);
+			m_Subscriptions.push_back(sub);
+		}
+		m_Subscriptions[slot].m_Free = false;
+		return slot;
+	} // end takeSubscription
+
+	void freeSubscription(unsigned int slot)
+	{
+		Subscription& sub = m_Subscriptions[slot];
+		sub.m_Generation = (sub.m_Generation + 1) & (~0u >> SubscriptionIndexBits);
+		if(sub.m_Generation == 0)
+		{
+			sub.m_Generation = 1;
+		}
+		sub.m_Topic = 0;
+		sub.m_Index = m_FreeSubscription;
+		sub.m_Free = true;
+		m_FreeSubscription = slot;
+	} // end freeSubscription
+
+	void eraseTopic(Topic& topic)
+	{
+		eraseTopic(topic, std::integral_constant<bool, TopicTraits::hasKey>());
+	}
+	void eraseTopic(Topic& topic, std::true_type)
+	{
+		TopicKey key(*topic.m_Key);
+		m_Topics.erase(key);
+	}
+	void eraseTopic(Topic&, std::false_type)
+	{}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Observers of the post's topic, 0 if it has none
+	///////////////////////////////////////////////////////////////////////////
+	Topic* findTopic(const PostType& post)
+	{
+		return findTopic(post, std::integral_constant<bool, TopicTraits::hasKey>());
+	}
+	Topic* findTopic(const PostType& post, std::true_type)
+	{
+		if(m_Topics.empty())
+		{
+			return 0;
+		}
+		typename TopicMap::iterator it = m_Topics.find(TopicTraits::key(post.getData()));
+		return it == m_Topics.end() ? 0 : &it->second;
+	}
+	Topic* findTopic(const PostType&, std::false_type)
+	{
+		return 0;
+	}
+
+	void deliver(ObserverType* obs, const PostType& post)
+	{
+		if(PassData)
+		{
+			ObserverAccess<PostType>::notify(obs, post);
+		}
+		else
+		{
+			ObserverAccess<PostType>::signal(obs);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify the subscribers that match a post
+	///////////////////////////////////////////////////////////////////////////
+	void notifySubscribers(const PostType& post)
+	{
+		if(Topic* topic = findTopic(post))
+		{
+			for(size_t i = 0; i < topic->m_Observers.size(); ++i)
+			{
+				deliver(topic->m_Observers[i], post);
+			}
+		}
+		for(size_t i = 0; i < m_Filtered.size(); ++i)
+		{
+			if(m_Filtered[i].m_Filter(post.getData()))
+			{
+				deliver(m_Filtered[i].m_Observer, post);
+			}
+		}
+	} // end notifySubscribers
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Notify the subscribers that match a batch, one call each
+	/// @details The matching posts are gathered per subscription in
+	///		m_Pending first.
+	///////////////////////////////////////////////////////////////////////////
+	void notifySubscribers(const std::vector<PostID>& ids)
+	{
+		for(size_t i = 0; i < ids.size(); ++i)
+		{
+			const PostType* post = m_PostsTable.find(ids[i]);
+			if(Topic* topic = findTopic(*post))
+			{
+				for(size_t j = 0; j < topic->m_Slots.size(); ++j)
+				{
+					addPending(topic->m_Slots[j], post);
+				}
+			}
+			for(size_t j = 0; j < m_Filtered.size(); ++j)
+			{
+				if(m_Filtered[j].m_Filter(post->getData()))
+				{
+					addPending(m_Filtered[j].m_Slot, post);
+				}
+			}
+		} // end for each post
+
+		for(size_t i = 0; i < m_Touched.size(); ++i)
+		{
+			unsigned int slot = m_Touched[i];
+			const Subscription& sub = m_Subscriptions[slot];
+			ObserverType* obs = sub.m_Topic ? sub.m_Topic->m_Observers[sub.m_Index]
+					: m_Filtered[sub.m_Index].m_Observer;
+			std::vector<const PostType*>& posts = m_Pending[slot];
+			if(PassData)
+			{
+				ObserverAccess<PostType>::notifyBatch(obs, &posts[0], posts.size());
+			}
+			else
+			{
+				ObserverAccess<PostType>::signal(obs);
+			}
+			posts.clear();
+		}
+		m_Touched.clear();
+	} // end notifySubscribers
+
+	void addPending(unsigned int slot, const PostType* post)
+	{
+		if(m_Pending[slot].empty())
+		{
+			m_Touched.push_back(slot);
+		}
+		m_Pending[slot].push_back(post);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Subscribers by topic
+	///////////////////////////////////////////////////////////////////////////
+	TopicMap m_Topics;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Filter subscriptions, dense
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<Filtered> m_Filtered;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Every subscription, indexed by the low bits of its handle
+	///////////////////////////////////////////////////////////////////////////
+	std::vector<Subscription> m_Subscriptions;
+	unsigned int m_FreeSubscription;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Posts of a batch matching each subscription, and the
+	///		subscriptions with any
 	///////////////////////////////////////////////////////////////////////////
-	PostsTable m_PostsTable;
+	std::vector<std::vector<const PostType*> > m_Pending;
+	std::vector<unsigned int> m_Touched;
 
 }; // end class PostBoard
 
@@ -0,0 +1,392 @@
+////////////////////////////////////////////////////////////////////////////////
+/// @brief Declaration of the PostBoard storage policies
+/// @internal
+///
+/// Oct 14, 2026, nik: initial
+/// Oct 14, 2026, nik: SlotPostTable reuses the oldest free slot, with a
+///		generation of up to 32 bits
+/// Oct 14, 2026, nik: Posts are constructed in place
+/// Oct 14, 2026, nik: Added the shard bits to SlotPostTable IDs
+/// Oct 14, 2026, nik: Added the allocator parameter
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef POSTTABLE_H_
+#define POSTTABLE_H_
+
+#include "exception.h"
+#include "post.h"
+
+#include <assert.h>
+#include <map>
+#include <memory>
+#include <stack>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class SlotPostTable posttable.h <posterboard/posttable.h>
+/// @brief Slot map storage for PostBoard
+/// @details Posts are kept in one contiguous vector, in no particular order.
+///		A post ID holds the index of a slot, which holds the post's position
+///		in that vector, plus the slot's generation.  Insert, erase and find
+///		are O(1); erase moves the last post into the hole.
+///
+///		The generation is bumped each time a slot is freed, so a stale ID is
+///		not found once its slot has been reused.  Freed slots are reused
+///		oldest first, so a slot only comes round again after every other
+///		free slot, and the generation wraps after that many reuses again.
+/// @tparam P The post type. P(InPlace(), id, args...) must construct a post
+///		and P::getID() return the id it was given.  P must be movable.
+/// @tparam INDEX_BITS Number of ID bits used for the slot index
+/// @tparam SHARD_BITS Number of ID bits used for the shard number, for
+///		boards that split their posts over several tables
+/// @tparam A Allocator for the posts, rebound for the slots
+/// @note The low SHARD_BITS of an ID are the shard number given to the
+///		constructor, the next INDEX_BITS the slot index and the next bits, up
+///		to 32 and at least 16, the generation.  Any bits above are 0.
+///////////////////////////////////////////////////////////////////////////////
+template <typename P, unsigned int INDEX_BITS = 24, unsigned int SHARD_BITS = 0,
+		typename A = std::allocator<P> >
+class SlotPostTable {
+	struct Slot;
+	typedef std::vector<P, A> PostList;
+	typedef std::vector<Slot,
+		typename std::allocator_traits<A>::template rebind_alloc<Slot> > SlotList;
+public:
+
+	typedef P PostType;
+	typedef typename PostType::PostID PostID;
+	typedef typename PostType::PostDataType PostDataType;
+	typedef A allocator_type;
+
+	typedef typename PostList::iterator iterator;
+	typedef typename PostList::const_iterator const_iterator;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Constructor
+	/// @param[in] shard The shard number put in the low bits of every ID
+	///////////////////////////////////////////////////////////////////////////
+	explicit SlotPostTable(unsigned int shard = 0)
+	: m_FreeHead(NoSlot),
+	  m_FreeTail(NoSlot),
+	  m_Shard(shard)
+	{
+		assert(shard <= ShardMask);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Store a new post
+	/// @details The post is constructed in place with
+	///		P(InPlace(), id, args...).
+	/// @param[in] args Arguments for the post's data
+	/// @warning Throws an exception if every slot is in use
+	/// @return The stored post
+	///////////////////////////////////////////////////////////////////////////
+	template <typename... ARGS>
+	PostType& emplace(ARGS&&... args)
+	{
+		unsigned int slot = takeSlot();
+		PostID id = makeID(slot);
+		try {
+			m_Posts.emplace_back(InPlace(), id, std::forward<ARGS>(args)...);
+		}
+		catch(std::exception&)
+		{
+			freeSlot(slot);
+			throw;
+		}
+		m_Slots[slot].m_Index = m_Posts.size() - 1;
+		return m_Posts.back();
+	} // end emplace
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Remove a post
+	/// @param[in] id The ID of the post
+	/// @return true - The post was removed
+	///			false - No post has the ID
+	///////////////////////////////////////////////////////////////////////////
+	bool erase(PostID id)
+	{
+		if( !find(id))
+		{
+			return false;
+		}
+		unsigned int slot = slotOf(id);
+		unsigned int index = m_Slots[slot].m_Index;
+		if(index != m_Posts.size() - 1)
+		{
+			m_Posts[index] = std::move(m_Posts.back());
+			m_Slots[slotOf(m_Posts[index].getID())].m_Index = index;
+		}
+		m_Posts.pop_back();
+		freeSlot(slot);
+		return true;
+	} // end erase
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Look up a post
+	/// @param[in] id The ID of the post
+	/// @return The post, or 0 if no post has the ID
+	///////////////////////////////////////////////////////////////////////////
+	PostType* find(PostID id)
+	{
+		unsigned int slot = slotOf(id);
+		if((id & ShardMask) != m_Shard ||
+		   slot >= m_Slots.size() ||
+		   m_Slots[slot].m_Free ||
+		   PostID(m_Slots[slot].m_Generation) != (id >> (INDEX_BITS + SHARD_BITS)) ||
+		   m_Slots[slot].m_Index == NoSlot)
+		{
+			return 0;
+		}
+		return &m_Posts[m_Slots[slot].m_Index];
+	} // end find
+
+	const PostType* find(PostID id) const
+	{
+		return const_cast<SlotPostTable*>(this)->find(id);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Make room for more posts
+	/// @param[in] count Number of posts about to be inserted
+	/// @warning Throws an exception if there are not enough free slots
+	///////////////////////////////////////////////////////////////////////////
+	void reserve(size_t count)
+	{
+		size_t total = m_Posts.size() + count;
+		if(total > size_t(IndexMask) + 1)
+		{
+			RAISE_EXCEPTION("Post table is full.");
+		}
+		m_Posts.reserve(total);
+		if(total > m_Slots.size())
+		{
+			m_Slots.reserve(total);
+		}
+	} // end reserve
+
+	size_t size() const { return m_Posts.size(); }
+	bool empty() const { return m_Posts.empty(); }
+
+	iterator begin() { return m_Posts.begin(); }
+	iterator end() { return m_Posts.end(); }
+	const_iterator begin() const { return m_Posts.begin(); }
+	const_iterator end() const { return m_Posts.end(); }
+
+private:
+
+	static const unsigned int IdBits = sizeof(PostID) * 8;
+	static_assert(INDEX_BITS < 32 && INDEX_BITS + SHARD_BITS + 16 <= IdBits,
+		"Too few ID bits left for the generation");
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Width of the generation, the bits left in an ID up to 32
+	///////////////////////////////////////////////////////////////////////////
+	static const unsigned int GenerationBits =
+		IdBits - INDEX_BITS - SHARD_BITS < 32 ? IdBits - INDEX_BITS - SHARD_BITS : 32;
+
+	static const unsigned int IndexMask = (1u << INDEX_BITS) - 1;
+	static const unsigned int ShardMask = (1u << SHARD_BITS) - 1;
+	static const unsigned int GenerationMask = ~0u >> (32 - GenerationBits);
+	static const unsigned int NoSlot = ~0u;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Maps an ID to a post
+	/// @details m_Index is the post's position in m_Posts, NoSlot while the
+	///		slot is being filled, or the next free slot while it is free.
+	///////////////////////////////////////////////////////////////////////////
+	struct Slot {
+		unsigned int m_Index;		///< See above
+		unsigned int m_Generation;	///< Generation of the ID using the slot
+		bool m_Free;				///< On the free list
+	};
+
+	PostID makeID(unsigned int slot) const
+	{
+		return (PostID(m_Slots[slot].m_Generation) << (INDEX_BITS + SHARD_BITS)) |
+			(PostID(slot) << SHARD_BITS) | m_Shard;
+	}
+
+	static unsigned int slotOf(PostID id)
+	{
+		return static_cast<unsigned int>(id >> SHARD_BITS) & IndexMask;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Take the oldest free slot, or add one
+	///////////////////////////////////////////////////////////////////////////
+	unsigned int takeSlot()
+	{
+		unsigned int slot = m_FreeHead;
+		if(slot != NoSlot)
+		{
+			m_FreeHead = m_Slots[slot].m_Index;
+			if(m_FreeHead == NoSlot)
+			{
+				m_FreeTail = NoSlot;
+			}
+		}
+		else
+		{
+			if(m_Slots.size() > IndexMask)
+			{
+				RAISE_EXCEPTION("Post table is full.");
+			}
+			slot = m_Slots.size();
+			Slot s = { NoSlot, 0, false };
+			m_Slots.push_back(s);
+		}
+		m_Slots[slot].m_Index = NoSlot;
+		m_Slots[slot].m_Free = false;
+		return slot;
+	} // end takeSlot
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Put a slot at the back of the free list
+	///////////////////////////////////////////////////////////////////////////
+	void freeSlot(unsigned int slot)
+	{
+		m_Slots[slot].m_Generation = (m_Slots[slot].m_Generation + 1) & GenerationMask;
+		m_Slots[slot].m_Index = NoSlot;
+		m_Slots[slot].m_Free = true;
+		if(m_FreeTail != NoSlot)
+		{
+			m_Slots[m_FreeTail].m_Index = slot;
+		}
+		else
+		{
+			m_FreeHead = slot;
+		}
+		m_FreeTail = slot;
+	} // end freeSlot
+
+	PostList m_Posts;				///< The posts, contiguous
+	SlotList m_Slots;				///< Indexed by the low bits of a PostID
+	unsigned int m_FreeHead;		///< Oldest free slot, taken first
+	unsigned int m_FreeTail;		///< Newest free slot
+	unsigned int m_Shard;			///< Low bits of every ID
+}; // end class SlotPostTable
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class MapPostTable posttable.h <posterboard/posttable.h>
+/// @brief Ordered map storage for PostBoard
+/// @details Posts are kept in a std::map ordered by ID, and freed IDs are
+///		reused most recent first.  One node is allocated per post.
+/// @tparam P The post type, see SlotPostTable
+/// @tparam A Allocator for the posts, rebound for the map nodes.  A
+///		PoolAllocator takes the nodes from a pool.
+///////////////////////////////////////////////////////////////////////////////
+template <typename P, typename A = std::allocator<P> >
+class MapPostTable {
+	typedef std::map<typename P::PostID, P, std::less<typename P::PostID>,
+		typename std::allocator_traits<A>::template
+			rebind_alloc<std::pair<const typename P::PostID, P> > > PostsTable;
+public:
+
+	typedef P PostType;
+	typedef typename PostType::PostID PostID;
+	typedef typename PostType::PostDataType PostDataType;
+	typedef A allocator_type;
+
+	typedef typename PostsTable::iterator iterator;
+	typedef typename PostsTable::const_iterator const_iterator;
+
+	MapPostTable()
+	{
+		m_FreeIDs.push(0);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @copydoc SlotPostTable::emplace
+	///////////////////////////////////////////////////////////////////////////
+	template <typename... ARGS>
+	PostType& emplace(ARGS&&... args)
+	{
+		PostID id = generateID();
+		try {
+			std::pair<iterator, bool> rtn =
+				m_PostsTable.emplace(std::piecewise_construct,
+					std::forward_as_tuple(id),
+					std::forward_as_tuple(InPlace(), id, std::forward<ARGS>(args)...));
+			if( !rtn.second)
+			{
+				RAISE_EXCEPTION("Failed to add message to board.");
+			}
+			return rtn.first->second;
+		} // end try
+		catch(std::exception&)
+		{
+			freeID(id);
+			throw;
+		}
+	} // end emplace
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @copydoc SlotPostTable::erase
+	///////////////////////////////////////////////////////////////////////////
+	bool erase(PostID id)
+	{
+		if(m_PostsTable.erase(id) == 0)
+		{
+			return false;
+		}
+		freeID(id);
+		return true;
+	} // end erase
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @copydoc SlotPostTable::find
+	///////////////////////////////////////////////////////////////////////////
+	PostType* find(PostID id)
+	{
+		iterator it = m_PostsTable.find(id);
+		return it == m_PostsTable.end() ? 0 : &it->second;
+	}
+
+	const PostType* find(PostID id) const
+	{
+		return const_cast<MapPostTable*>(this)->find(id);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Nothing to reserve for a map
+	///////////////////////////////////////////////////////////////////////////
+	void reserve(size_t)
+	{}
+
+	size_t size() const { return m_PostsTable.size(); }
+	bool empty() const { return m_PostsTable.empty(); }
+
+	iterator begin() { return m_PostsTable.begin(); }
+	iterator end() { return m_PostsTable.end(); }
+	const_iterator begin() const { return m_PostsTable.begin(); }
+	const_iterator end() const { return m_PostsTable.end(); }
+
+private:
+
+	PostID generateID()
+	{
+		PostID id = m_FreeIDs.top();
+		m_FreeIDs.pop();
+		if(m_FreeIDs.empty())
+		{
+			m_FreeIDs.push(id+1);
+		}
+		return id;
+	} // end generateID
+
+	void freeID(PostID id)
+	{
+		m_FreeIDs.push(id);
+	} // end freeID
+
+	std::stack<PostID> m_FreeIDs;	///< The available PostIDs
+	PostsTable m_PostsTable;		///< Contained posts
+}; // end class MapPostTable
+
+} /* namespace nik */
+#endif /* POSTTABLE_H_ */
@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////////////////////////
+/// @brief Declaration of QueuedDispatch
+/// @internal
+///
+/// Oct 14, 2026, nik: initial
+/// Oct 14, 2026, nik: An observer may unregister from its own callback
+/// Oct 14, 2026, nik: Documented Observer::unregisterSelf for derived observers
+/// Oct 14, 2026, nik: detach sleeps until a call in progress returns
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QUEUEDDISPATCH_H_
+#define QUEUEDDISPATCH_H_
+
+#include "observer.h"
+#include "Mutex.h"
+#include "ScopeLock.h"
+#include "Event.h"
+#include "Thread.h"
+#include "ThreadPool.h"
+
+#include <assert.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace nik {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @class QueuedDispatch queueddispatch.h
+/// @brief Dispatch policy that queues notifications for a ThreadPool
+/// @details Every observer gets its own bounded queue.  Notifying copies the
+///		data into each observer's queue and returns; the queue is drained by
+///		a task on the pool, one task per observer at a time, so each
+///		observer still sees its notifications in order and is never called
+///		from two threads at once.  A slow observer only backs up its own
+///		queue.
+///
+///		The drain task hands the observer up to batchSize notifications
+///		in one Observer::notifyBatch call, then gives the worker back to the
+///		pool if more are queued.
+///
+///		What happens when a queue is full is set by the Overflow policy.
+/// @tparam T The notification data type, must be copyable
+/// @warning With BLOCK, do not notify from a worker of the same pool; the
+///		notifying thread may be the one that would drain the queue.
+/// @warning A worker may be inside notify or notifyBatch while the observer
+///		is being destroyed.  ~Observer waits for it, but by then the derived
+///		class's members are gone, so a derived observer must call
+///		Observer::unregisterSelf() first thing in its own destructor.
+/// @see nik::Observable
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class QueuedDispatch {
+	class Mailbox;
+public:
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief What to do with a notification for a full queue
+	///////////////////////////////////////////////////////////////////////////
+	enum Overflow {
+		BLOCK,			///< Wait in the notifying thread for room
+		DROP_OLDEST,	///< Drop the oldest queued notification
+		COALESCE		///< Replace the newest queued notification with it
+	};
+
+	typedef Mailbox* Slot;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Constructor
+	/// @param[in] pool The pool that runs the observers, must outlive the
+	///		Observable
+	/// @param[in] capacity Most notifications queued per observer
+	/// @param[in] overflow What to do when a queue is full
+	/// @param[in] batchSize Most notifications per notifyBatch call
+	///////////////////////////////////////////////////////////////////////////
+	explicit QueuedDispatch(ThreadPool& pool, size_t capacity = 1024,
+			Overflow overflow = BLOCK, size_t batchSize = 64)
+	: m_Pool(&pool),
+	  m_Capacity(capacity),
+	  m_Overflow(overflow),
+	  m_BatchSize(batchSize)
+	{
+		assert(capacity > 0 && batchSize > 0);
+	}
+
+	Slot attach(Observer<T>* obs)
+	{
+		return new Mailbox(*this, obs);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief Drops the observer's queue
+	/// @details Waits for a notifyBatch call in progress to return, unless
+	///		the observer is unregistering itself from it.
+	///////////////////////////////////////////////////////////////////////////
+	void detach(Observer<T>*, Slot& slot)
+	{
+		slot->close();
+		slot = 0;
+	}
+
+	void signal(Observer<T>*, Slot& slot)
+	{
+		slot->signal();
+	}
+
+	void notify(Observer<T>*, Slot& slot, const T& data)
+	{
+		slot->push(data);
+	}
+
+	void notifyBatch(Observer<T>*, Slot& slot, const T* const* data, size_t count)
+	{
+		for(size_t i = 0; i < count; ++i)
+		{
+			slot->push(*data[i]);
+		}
+	}
+
+private:
+
+	///////////////////////////////////////////////////////////////////////////
+	/// @brief An observer's queue
+	/// @details Reference counted by the Observable and a scheduled drain
+	///		task.
+	///////////////////////////////////////////////////////////////////////////
+	class Mailbox {
+	public:
+		Mailbox(const QueuedDispatch& owner, Observer<T>* obs)
+		: m_Pool(owner.m_Pool),
+		  m_Capacity(owner.m_Capacity),
+		  m_Overflow(owner.m_Overflow),
+		  m_BatchSize(owner.m_BatchSize),
+		  m_Observer(obs),
+		  m_Lock(Mutex::Create("queueddispatch.mailbox")),
+		  m_SpaceEvent(Event::Create("queueddispatch.space")),
+		  m_IdleEvent(Event::Create("queueddispatch.idle")),
+		  m_Signals(0),
+		  m_Scheduled(false),
+		  m_InCall(false),
+		  m_CallThread(0),
+		  m_Closed(false),
+		  m_Refs(1)
+		{}
+
+		~Mailbox()
+		{
+			delete m_IdleEvent;
+			delete m_SpaceEvent;
+			delete m_Lock;
+		}
+
+		void push(const T& data)
+		{
+			for(;;)
+			{
+				{
+					ScopeLock al(m_Lock);
+					if(m_Closed)
+					{
+						return;
+					}
+					if(m_Queue.size() >= m_Capacity && m_Overflow == DROP_OLDEST)
+					{
+						m_Queue.pop_front();
+					}
+					else if(m_Queue.size() >= m_Capacity && m_Overflow == COALESCE)
+					{
+						m_Queue.back() = data;
+						return;
+					}
+					if(m_Queue.size() < m_Capacity)
+					{
+						m_Queue.push_back(data);
+						schedule();
+						return;
+					}
+					// Cleared under the lock, so a drain that makes room
+					// after this sets it again
+					m_SpaceEvent->ClearEvent();
+				}
+				m_SpaceEvent->WaitForEvent(Event::FOREVER);
+			}
+		} // end push
+
+		void signal()
+		{
+			ScopeLock al(m_Lock);
+			if( !m_Closed)
+			{
+				++m_Signals;
+				schedule();
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/// @brief Stops delivery and releases the Observable's reference
+		///////////////////////////////////////////////////////////////////////
+		void close()
+		{
+			{
+				ScopeLock al(m_Lock);
+				m_Closed = true;
+				m_Queue.clear();
+				m_Signals = 0;
+				m_SpaceEvent->SetEvent();
+			}
+			const size_t self = Thread::GetCurrentId();
+			for(;;)
+			{
+				{
+					ScopeLock al(m_Lock);
+					// An observer unregistering from its own callback is not
+					// waited for
+					if( !m_InCall || m_CallThread == self)
+					{
+						break;
+					}
+					// Cleared under the lock, so the call ending after this
+					// sets it again
+					m_IdleEvent->ClearEvent();
+				}
+				m_IdleEvent->WaitForEvent(Event::FOREVER);
+			}
+			release();
+		} // end close
+
+	private:
+
+		///////////////////////////////////////////////////////////////////////
+		/// @brief Submits a drain task unless one is already scheduled
+		/// @attention m_Lock must be held
+		///////////////////////////////////////////////////////////////////////
+		void schedule()
+		{
+			if(m_Scheduled)
+			{
+				return;
+			}
+			m_Scheduled = true;
+			m_Refs.fetch_add(1, std::memory_order_relaxed);
+			m_Pool->Submit(Drain(this));
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/// @brief Delivers one batch, run on the pool
+		///////////////////////////////////////////////////////////////////////
+		void drain()
+		{
+			size_t signals = 0;
+			bool idle = false;
+			{
+				ScopeLock al(m_Lock);
+				signals = m_Signals;
+				m_Signals = 0;
+				m_Batch.clear();
+				while( !m_Queue.empty() && m_Batch.size() < m_BatchSize)
+				{
+					m_Batch.push_back(m_Queue.front());
+					m_Queue.pop_front();
+				}
+				idle = m_Closed || (signals == 0 && m_Batch.empty());
+				if(idle)
+				{
+					m_Scheduled = false;
+				}
+				else
+				{
+					m_InCall = true;
+					m_CallThread = Thread::GetCurrentId();
+					m_SpaceEvent->SetEvent();
+				}
+			}
+			if(idle)
+			{
+				release();
+				return;
+			}
+
+			for(size_t i = 0; i < signals; ++i)
+			{
+				ObserverAccess<T>::signal(m_Observer);
+			}
+			if( !m_Batch.empty())
+			{
+				m_Pointers.resize(m_Batch.size());
+				for(size_t i = 0; i < m_Batch.size(); ++i)
+				{
+					m_Pointers[i] = &m_Batch[i];
+				}
+				ObserverAccess<T>::notifyBatch(m_Observer, &m_Pointers[0], m_Pointers.size());
+			}
+
+			{
+				ScopeLock al(m_Lock);
+				m_InCall = false;
+				if(m_Closed)
+				{
+					// Wakes a close() waiting for this call to return
+					m_IdleEvent->SetEvent();
+				}
+				else if( !m_Queue.empty() || m_Signals > 0)
+				{
+					// Still scheduled, let other tasks in before the next batch
+					m_Pool->Submit(Drain(this));
+					return;
+				}
+				m_Scheduled = false;
+			}
+			release();
+		} // end drain
+
+		void release()
+		{
+			if(m_Refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				delete this;
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/// @brief The drain task, holds a reference to the mailbox
+		///////////////////////////////////////////////////////////////////////
+		class Drain {
+		public:
+			explicit Drain(Mailbox* box) : m_Box(box) {}
+			void operator()() const { m_Box->drain(); }
+		private:
+			Mailbox* m_Box;
+		};
+
+		ThreadPool* m_Pool;					///< Runs the drain tasks
+		const size_t m_Capacity;			///< Most notifications queued
+		const Overflow m_Overflow;			///< What to do when m_Queue is full
+		const size_t m_BatchSize;			///< Most notifications per call
+		Observer<T>* m_Observer;			///< Observer to deliver to
+		Mutex* m_Lock;						///< Guards the members below
+		Event* m_SpaceEvent;				///< Set when there is room in m_Queue
+		Event* m_IdleEvent;					///< Set when a call ends after close()
+		std::deque<T> m_Queue;				///< Queued notifications
+		size_t m_Signals;					///< Queued signal() calls
+		bool m_Scheduled;					///< A drain task has been submitted
+		bool m_InCall;						///< The observer is being called
+		size_t m_CallThread;				///< Thread calling the observer
+		bool m_Closed;						///< Detached, deliver nothing more
+		std::atomic<int> m_Refs;			///< Observable plus drain task
+		std::vector<T> m_Batch;				///< Batch being delivered
+		std::vector<const T*> m_Pointers;	///< Points into m_Batch
+	}; // end class Mailbox
+
+	ThreadPool* m_Pool;		///< Runs the drain tasks
+	size_t m_Capacity;		///< Most notifications queued per observer
+	Overflow m_Overflow;	///< What to do when a queue is full
+	size_t m_BatchSize;		///< Most notifications per notifyBatch call
+}; // end class QueuedDispatch
+
+} // end namespace nik
+
+#endif /* QUEUEDDISPATCH_H_ */